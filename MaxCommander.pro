@@ -14,8 +14,6 @@ QT                      += quickwidgets
 QT                      += qml quick
 QT                      += widgets
 QT                      += network
-QT                      += webenginewidgets
-QT                      += multimedia
 
 
 macx: {
@@ -61,7 +59,29 @@ SOURCES                 += src/main.cpp \
                         src/dirhistorylistpopup.cpp \
                         src/dirhistorylistmodel.cpp \
                         src/findtextdialog.cpp \
-                        src/comparedialog.cpp
+                        src/comparedialog.cpp \
+                        src/ownernamecache.cpp \
+                        src/mimetypecache.cpp \
+                        src/filenamematcher.cpp \
+                        src/fileselectionset.cpp \
+                        src/filelistquickfilter.cpp \
+                        src/dirsizescanner.cpp \
+                        src/dirsizeindex.cpp \
+                        src/treemapwidget.cpp \
+                        src/treemapdialog.cpp \
+                        src/filesystemstats.cpp \
+                        src/filelistsnapshot.cpp \
+                        src/asynclogger.cpp \
+                        src/dirfrecencydb.cpp \
+                        src/fileiconcache.cpp \
+                        src/iconthemeindex.cpp \
+                        src/thumbnailimageprovider.cpp \
+                        src/imagerequestscheduler.cpp \
+                        src/audiocoverart.cpp \
+                        src/filecopyengine.cpp \
+                        src/transfertelemetry.cpp \
+                        src/throughputgraphwidget.cpp \
+                        src/transferbatch.cpp
 
 # Heders
 HEADERS                 += src/constants.h \
@@ -100,7 +120,29 @@ HEADERS                 += src/constants.h \
                         src/dirhistorylistpopup.h \
                         src/dirhistorylistmodel.h \
                         src/findtextdialog.h \
-                        src/comparedialog.h
+                        src/comparedialog.h \
+                        src/ownernamecache.h \
+                        src/mimetypecache.h \
+                        src/filenamematcher.h \
+                        src/fileselectionset.h \
+                        src/filelistquickfilter.h \
+                        src/dirsizescanner.h \
+                        src/dirsizeindex.h \
+                        src/treemapwidget.h \
+                        src/treemapdialog.h \
+                        src/filesystemstats.h \
+                        src/filelistsnapshot.h \
+                        src/asynclogger.h \
+                        src/dirfrecencydb.h \
+                        src/fileiconcache.h \
+                        src/iconthemeindex.h \
+                        src/thumbnailimageprovider.h \
+                        src/imagerequestscheduler.h \
+                        src/audiocoverart.h \
+                        src/filecopyengine.h \
+                        src/transfertelemetry.h \
+                        src/throughputgraphwidget.h \
+                        src/transferbatch.h
 
 # Include Path
 INCLUDEPATH             += \
@@ -129,7 +171,8 @@ FORMS                   += \
                         ui/selectfilesdialog.ui \
                         ui/dirhistorylistpopup.ui \
                         ui/findtextdialog.ui \
-                        ui/comparedialog.ui
+                        ui/comparedialog.ui \
+                        ui/treemapdialog.ui
 
 # Resources
 RESOURCES               += \
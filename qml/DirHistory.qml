@@ -83,6 +83,23 @@ Rectangle {
                     gotoPageDown();
                 }
             break;
+
+            case Qt.Key_Backspace:
+                // Remove Last Filter Char
+                dirHistoryListController.filterText = dirHistoryListController.filterText.slice(0, -1);
+                // Set Accepted
+                event.accepted = true;
+            break;
+
+            default:
+                // Check Text - Printable Chars Go To The Filter
+                if (event.text.length > 0 && event.text >= " " && event.text !== "\u007f" && !(event.modifiers & (Qt.ControlModifier | Qt.AltModifier | Qt.MetaModifier))) {
+                    // Append Filter Text
+                    dirHistoryListController.filterText += event.text;
+                    // Set Accepted
+                    event.accepted = true;
+                }
+            break;
         }
     }
 
@@ -131,8 +148,16 @@ Rectangle {
             break;
 
             case Qt.Key_Escape:
-                // Select Item
-                dirHistoryListController.dirHistoryListItemSelected(-1);
+                // Check Filter Text
+                if (dirHistoryListController.filterText !== "") {
+                    // Clear Filter Text
+                    dirHistoryListController.filterText = "";
+                } else {
+                    // Select Item
+                    dirHistoryListController.dirHistoryListItemSelected(-1);
+                }
+                // Set Accepted
+                event.accepted = true;
             break;
         }
     }
@@ -240,10 +265,21 @@ Rectangle {
         }
     }
 
+    // Filter Changes
+    Connections {
+        target: dirHistoryListController
+
+        // On Filter Text Changed
+        onFilterTextChanged: {
+            // Reset Current Index
+            dirHistoryList.currentIndex = 0;
+        }
+    }
+
     // Empty Text
     Text {
         id: emptyText
-        visible: dirHistoryList.count <= 0
+        visible: dirHistoryList.count <= 0 && dirHistoryListController.filterText === ""
         anchors.fill: parent
         horizontalAlignment: Text.AlignHCenter
         verticalAlignment: Text.AlignVCenter
@@ -259,6 +295,24 @@ Rectangle {
         }
     }
 
+    // Filter Text
+    Text {
+        id: filterText
+        visible: dirHistoryListController.filterText !== ""
+        anchors.left: parent.left
+        anchors.leftMargin: parent.radius
+        anchors.right: parent.right
+        anchors.rightMargin: parent.radius
+        anchors.bottom: parent.bottom
+        anchors.bottomMargin: parent.radius + parent.border.width
+        height: Const.DEFAULT_DIR_HISTORY_LIST_POPUP_CLEAR_BUTTON_HEIGHT
+        verticalAlignment: Text.AlignVCenter
+        elide: Text.ElideLeft
+        font.italic: true
+        text: dirHistoryList.count > 0 ? dirHistoryListController.filterText : dirHistoryListController.filterText + " - No Match"
+        color: Const.DEFAULT_FONT_COLOR
+    }
+
     // Clear Button
     Rectangle {
         id: clearButton
@@ -277,7 +331,7 @@ Rectangle {
 
         color: clearButtonMouseArea.pressed ? Const.DEFAULT_POPUP_ITEM_SELECT_COLOR : "transparent"
 
-        visible: dirHistoryList.count > 0
+        visible: dirHistoryList.count > 0 && dirHistoryListController.filterText === ""
 
         // Button Text
         Text {
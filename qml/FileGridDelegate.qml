@@ -61,6 +61,8 @@ Rectangle {
         anchors.rightMargin: Const.DEFAULT_MARGIN_WIDTH
         anchors.bottomMargin: Const.DEFAULT_MARGIN_WIDTH + fileNameLabel.height + Const.DEFAULT_MARGIN_WIDTH
         fillMode: Image.PreserveAspectFit
+        sourceSize.width: fileGridDelegateRoot.width
+        sourceSize.height: fileGridDelegateRoot.height
         cache: false
         smooth: false
         asynchronous: true
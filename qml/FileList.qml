@@ -350,6 +350,24 @@ Rectangle {
             updateFileListHeaderLayout();
         }
 
+        // On Content Y Changed
+        onContentYChanged: {
+            // Update Visible Range
+            updateVisibleRange();
+        }
+
+        // On Height Changed
+        onHeightChanged: {
+            // Update Visible Range
+            updateVisibleRange();
+        }
+
+        // On Count Changed
+        onCountChanged: {
+            // Update Visible Range
+            updateVisibleRange();
+        }
+
         // Scroll Bar
         FileListScrollBar {
             id: scrollBar
@@ -394,6 +412,24 @@ Rectangle {
         cellWidth: delegateWidth
         cellHeight: delegateHeight
 
+        // On Content Y Changed
+        onContentYChanged: {
+            // Update Visible Range
+            updateVisibleRange();
+        }
+
+        // On Height Changed
+        onHeightChanged: {
+            // Update Visible Range
+            updateVisibleRange();
+        }
+
+        // On Count Changed
+        onCountChanged: {
+            // Update Visible Range
+            updateVisibleRange();
+        }
+
         // Grid Model
         model: fileListModel
 
@@ -458,7 +494,8 @@ Rectangle {
 
                     // Check File Name
                     if (Utility.isImage(fileFullName, mainController)) {
-                        return Const.DEFAULT_FILE_PREFIX + fileListModel.getFullPath(index);
+                        // Thumbnail Provider
+                        return Const.DEFAULT_GRID_ICON_PREFIX + fileListModel.getFullPath(index);
                     }
 
                     // Image Provider
@@ -468,7 +505,8 @@ Rectangle {
 
                 // Check File Name
                 if (Utility.isImage(fileFullName, mainController)) {
-                    return Const.DEFAULT_FILE_PREFIX + mainController.currentDir + "/" + fileFullName;
+                    // Thumbnail Provider
+                    return Const.DEFAULT_GRID_ICON_PREFIX + mainController.currentDir + "/" + fileFullName;
                 }
 
                 // Image Provider
@@ -938,6 +976,24 @@ Rectangle {
         // ...
     }
 
+    // Update Visible Range - Image Requests For On Screen Rows Go First
+    function updateVisibleRange() {
+        // Get Active View
+        var view = mainController.gridMode ? fileGridView : fileListView;
+        // Get First Visible Index
+        var firstIndex = view.indexAt(1, view.contentY + 1);
+        // Get Last Visible Index
+        var lastIndex = view.indexAt(view.width - 2, view.contentY + view.height - 2);
+
+        // Check Last Index - Blank Area Below The Last Row
+        if (lastIndex < 0) {
+            lastIndex = view.count - 1;
+        }
+
+        // Set Main Controller Visible Range
+        mainController.setVisibleRange(firstIndex, lastIndex);
+    }
+
     // Update File List Header Layout
     function updateFileListHeaderLayout() {
         //console.log("fileListRoot.updateFileListHeaderLayout");
@@ -993,6 +1049,27 @@ Rectangle {
         fileListHeader.setNameHeaderSeparatorPosition(remainingWidth - Const.DEFAULT_FILE_LIST_HEADER_SEPARATOR_WIDTH);
     }
 
+    // Quick Filter Indicator
+    Rectangle {
+        id: quickFilterIndicator
+        anchors.right: parent.right
+        anchors.bottom: parent.bottom
+        anchors.margins: 4
+        width: quickFilterText.width + 16
+        height: quickFilterText.height + 8
+        radius: 4
+        color: globalSettings.currentBGColor
+        visible: fileListModel.quickFilter !== ""
+
+        Text {
+            id: quickFilterText
+            anchors.centerIn: parent
+            color: globalSettings.currentColor
+            font.pixelSize: globalSettings.fontSize
+            text: fileListModel.quickFilter
+        }
+    }
+
     // Connections
     Connections {
         target: mainController
@@ -1106,6 +1183,9 @@ Rectangle {
                 fileListView.focus = true;
             }
 
+            // Update Visible Range
+            updateVisibleRange();
+
             // ...
         }
 
@@ -0,0 +1,414 @@
+#include <QTime>
+#include <QStringList>
+#include <QDebug>
+
+#include <stdio.h>
+
+#include "asynclogger.h"
+#include "constants.h"
+
+
+// Async Logger Singleton
+static AsyncLogger* asyncLoggerSingleton = NULL;
+
+
+//==============================================================================
+// Constructor
+//==============================================================================
+AsyncLoggerSlot::AsyncLoggerSlot()
+    : sequence(0)
+{
+}
+
+
+
+
+
+
+
+//==============================================================================
+// Install
+//==============================================================================
+void AsyncLogger::install(const QString& aFilePath)
+{
+    // Check Singleton
+    if (asyncLoggerSingleton) {
+        return;
+    }
+
+    // Create Singleton
+    asyncLoggerSingleton = new AsyncLogger(aFilePath);
+    // Start Flusher
+    asyncLoggerSingleton->start(QThread::LowPriority);
+
+    // Install Message Handler
+    qInstallMessageHandler(AsyncLogger::messageHandler);
+}
+
+//==============================================================================
+// Uninstall
+//==============================================================================
+void AsyncLogger::uninstall()
+{
+    // Check Singleton
+    if (!asyncLoggerSingleton) {
+        return;
+    }
+
+    // Restore Default Message Handler
+    qInstallMessageHandler(0);
+
+    // Delete Singleton - Drains The Ring Buffer
+    delete asyncLoggerSingleton;
+    asyncLoggerSingleton = NULL;
+}
+
+//==============================================================================
+// Message Handler
+//==============================================================================
+void AsyncLogger::messageHandler(QtMsgType aType, const QMessageLogContext& aContext, const QString& aMessage)
+{
+    // Check Singleton
+    if (asyncLoggerSingleton) {
+        // Log Message
+        asyncLoggerSingleton->log(aType, aContext, aMessage);
+
+        // Check Type - Qt Aborts Right After A Fatal Message
+        if (aType == QtFatalMsg && QThread::currentThread() != asyncLoggerSingleton) {
+            // Stop Flusher
+            asyncLoggerSingleton->running = 0;
+            // Wait For Flusher - Drains The Ring Buffer
+            asyncLoggerSingleton->wait();
+        }
+    }
+}
+
+//==============================================================================
+// Get Level For Message Type
+//==============================================================================
+int AsyncLogger::typeLevel(const QtMsgType& aType)
+{
+    // Switch Type
+    switch (aType) {
+        case QtDebugMsg:    return 0;
+        case QtInfoMsg:     return 1;
+        case QtWarningMsg:  return 2;
+        case QtCriticalMsg: return 3;
+        case QtFatalMsg:    return 4;
+        default:            break;
+    }
+
+    return 0;
+}
+
+//==============================================================================
+// Get Level By Name
+//==============================================================================
+int AsyncLogger::levelByName(const QString& aName)
+{
+    // Get Level Names
+    static const QStringList levelNames = QStringList() << "debug" << "info" << "warning" << "critical" << "fatal" << "off";
+
+    // Get Level
+    int level = levelNames.indexOf(aName.trimmed().toLower());
+
+    return level >= 0 ? level : 0;
+}
+
+//==============================================================================
+// Constructor
+//==============================================================================
+AsyncLogger::AsyncLogger(const QString& aFilePath)
+    : QThread(NULL)
+    , filePath(aFilePath)
+    , ringMask(DEFAULT_LOG_RING_SIZE - 1)
+    , enqueuePos(0)
+    , dequeuePos(0)
+    , dropped(0)
+    , running(1)
+    , defaultLevel(0)
+{
+    // Resize Ring Buffer
+    ring.resize(DEFAULT_LOG_RING_SIZE);
+
+    // Go Thru Ring Buffer
+    for (int i = 0; i < DEFAULT_LOG_RING_SIZE; ++i) {
+        // Set Sequence - Slot i Is Free For Position i
+        ring[i].sequence = (quint32)i;
+    }
+
+    // Load Rules
+    loadRules(QString::fromLocal8Bit(qgetenv(DEFAULT_LOG_RULES_ENV)));
+}
+
+//==============================================================================
+// Log Message
+//==============================================================================
+void AsyncLogger::log(QtMsgType aType, const QMessageLogContext& aContext, const QString& aMessage)
+{
+    // Get Level
+    int level = typeLevel(aType);
+    // Get Category
+    QString category = messageCategory(aContext, aMessage);
+
+    // Check Level - Filtered Messages Cost No Formatting
+    if (level < categoryLevel(category)) {
+        return;
+    }
+
+    // Init Type Text
+    const char* typeText = "Debug";
+
+    // Switch Type
+    switch (aType) {
+        default:
+        case QtDebugMsg:    typeText = "Debug";     break;
+        case QtInfoMsg:     typeText = "Info";      break;
+        case QtWarningMsg:  typeText = "Warning";   break;
+        case QtCriticalMsg: typeText = "Critical";  break;
+        case QtFatalMsg:    typeText = "Fatal";     break;
+    }
+
+    // Format Line
+    QByteArray line = QString("%1 %2: %3\n").arg(QTime::currentTime().toString("hh:mm:ss.zzz")).arg(typeText).arg(aMessage).toUtf8();
+
+    // Push Line
+    if (!push(line)) {
+        // Inc Dropped - Logging Never Blocks The Caller
+        dropped.ref();
+    }
+}
+
+//==============================================================================
+// Load Rules
+//==============================================================================
+void AsyncLogger::loadRules(const QString& aRules)
+{
+    // Go Thru Rules
+    foreach (const QString& rule, aRules.split(';', QString::SkipEmptyParts)) {
+        // Get Rule Parts
+        QStringList ruleParts = rule.split('=');
+
+        // Check Rule Parts
+        if (ruleParts.count() != 2) {
+            continue;
+        }
+
+        // Get Rule Category
+        QString ruleCategory = ruleParts[0].trimmed();
+
+        // Check Rule Category
+        if (ruleCategory == QString("*")) {
+            // Set Default Level
+            defaultLevel = levelByName(ruleParts[1]);
+        } else {
+            // Set Category Level
+            categoryLevels[ruleCategory] = levelByName(ruleParts[1]);
+        }
+    }
+}
+
+//==============================================================================
+// Get Category
+//==============================================================================
+QString AsyncLogger::messageCategory(const QMessageLogContext& aContext, const QString& aMessage)
+{
+    // Check Context Category
+    if (aContext.category && qstrcmp(aContext.category, "default") != 0) {
+        return QString::fromLatin1(aContext.category);
+    }
+
+    // Get Class Separator - Messages Start With "Class::method"
+    int separator = aMessage.leftRef(DEFAULT_LOG_CATEGORY_MAX_LENGTH).indexOf(QString("::"));
+
+    // Check Separator
+    if (separator > 0) {
+        return aMessage.left(separator);
+    }
+
+    return QString("");
+}
+
+//==============================================================================
+// Get Category Level
+//==============================================================================
+int AsyncLogger::categoryLevel(const QString& aCategory)
+{
+    return categoryLevels.value(aCategory, defaultLevel);
+}
+
+//==============================================================================
+// Push Line
+//==============================================================================
+bool AsyncLogger::push(const QByteArray& aLine)
+{
+    // Get Position
+    quint32 pos = enqueuePos.loadAcquire();
+
+    forever {
+        // Get Slot
+        AsyncLoggerSlot& slot = ring[pos & ringMask];
+        // Get Sequence Difference - Unsigned Subtraction, Read As Signed
+        qint32 diff = (qint32)(slot.sequence.loadAcquire() - pos);
+
+        // Check Difference
+        if (diff == 0) {
+            // Claim Position
+            if (enqueuePos.testAndSetOrdered(pos, pos + 1)) {
+                // Set Line
+                slot.line = aLine;
+                // Publish Slot To The Flusher
+                slot.sequence.storeRelease(pos + 1);
+
+                return true;
+            }
+
+            // Another Producer Won, Retry
+            pos = enqueuePos.loadAcquire();
+
+        } else if (diff < 0) {
+            // Ring Buffer Full
+            return false;
+
+        } else {
+            // Slot Taken, Reload Position
+            pos = enqueuePos.loadAcquire();
+        }
+    }
+}
+
+//==============================================================================
+// Pop Line
+//==============================================================================
+bool AsyncLogger::pop(QByteArray& aLine)
+{
+    // Get Slot
+    AsyncLoggerSlot& slot = ring[dequeuePos & ringMask];
+
+    // Check Sequence - Not Published Yet
+    if ((qint32)(slot.sequence.loadAcquire() - (dequeuePos + 1)) != 0) {
+        return false;
+    }
+
+    // Take Line
+    aLine.swap(slot.line);
+    // Clear Slot Line
+    slot.line.clear();
+    // Free Slot For The Next Round
+    slot.sequence.storeRelease(dequeuePos + ringMask + 1);
+
+    // Inc Dequeue Position
+    dequeuePos++;
+
+    return true;
+}
+
+//==============================================================================
+// Drain Ring Buffer To Log File
+//==============================================================================
+void AsyncLogger::drain()
+{
+    // Init Line
+    QByteArray line;
+    // Init Written
+    bool written = false;
+
+    // Go Thru Lines
+    while (pop(line)) {
+        // Check Log File - Lines Are Discarded If It Couldn't Be Opened
+        if (logFile.isOpen()) {
+            // Write Line
+            logFile.write(line);
+            // Set Written
+            written = true;
+        }
+    }
+
+    // Get Dropped Count
+    int droppedCount = dropped.fetchAndStoreOrdered(0);
+
+    // Check Dropped Count
+    if (droppedCount > 0 && logFile.isOpen()) {
+        // Write Dropped Line
+        logFile.write(QString("%1 Warning: AsyncLogger - %2 lines dropped!!\n").arg(QTime::currentTime().toString("hh:mm:ss.zzz")).arg(droppedCount).toUtf8());
+        // Set Written
+        written = true;
+    }
+
+    // Check Written
+    if (written) {
+        // Flush Log File
+        logFile.flush();
+
+        // Check Log File Size
+        if (logFile.size() > DEFAULT_LOG_MAX_FILE_SIZE) {
+            // Rotate Log File
+            rotate();
+        }
+    }
+}
+
+//==============================================================================
+// Rotate Log File
+//==============================================================================
+void AsyncLogger::rotate()
+{
+    // Close Log File
+    logFile.close();
+
+    // Remove Oldest Log File
+    QFile::remove(QString("%1.%2").arg(filePath).arg(DEFAULT_LOG_MAX_FILES));
+
+    // Go Thru Old Log Files - log.txt.1 -> log.txt.2 ...
+    for (int i = DEFAULT_LOG_MAX_FILES - 1; i > 0; --i) {
+        // Rename Log File
+        QFile::rename(QString("%1.%2").arg(filePath).arg(i), QString("%1.%2").arg(filePath).arg(i + 1));
+    }
+
+    // Rename Current Log File
+    QFile::rename(filePath, QString("%1.1").arg(filePath));
+
+    // Open New Log File
+    if (!logFile.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+        fprintf(stderr, "AsyncLogger::rotate - ERROR OPENING LOG FILE!!\n");
+    }
+}
+
+//==============================================================================
+// Run
+//==============================================================================
+void AsyncLogger::run()
+{
+    // Set Log File Name
+    logFile.setFileName(filePath);
+
+    // Open Log File
+    if (!logFile.open(QIODevice::WriteOnly | QIODevice::Append)) {
+        fprintf(stderr, "AsyncLogger::run - ERROR OPENING LOG FILE!!\n");
+    }
+
+    // Flusher Loop
+    while (running.loadAcquire()) {
+        // Drain Ring Buffer
+        drain();
+        // Sleep - Producers Never Wake The Flusher, No Locks On The Logging Path
+        msleep(DEFAULT_LOG_FLUSH_INTERVAL);
+    }
+
+    // Drain Remaining Lines
+    drain();
+
+    // Close Log File
+    logFile.close();
+}
+
+//==============================================================================
+// Destructor
+//==============================================================================
+AsyncLogger::~AsyncLogger()
+{
+    // Stop Flusher
+    running = 0;
+    // Wait For Flusher
+    wait();
+}
@@ -0,0 +1,116 @@
+#ifndef ASYNCLOGGER_H
+#define ASYNCLOGGER_H
+
+#include <QThread>
+#include <QFile>
+#include <QString>
+#include <QByteArray>
+#include <QHash>
+#include <QVector>
+#include <QAtomicInt>
+#include <QAtomicInteger>
+
+
+//==============================================================================
+// Async Logger Slot Class - One Ring Buffer Entry
+//==============================================================================
+class AsyncLoggerSlot
+{
+public:
+    // Constructor
+    explicit AsyncLoggerSlot();
+
+    // Sequence - Tells Producers And The Flusher Who Owns The Slot, Wraps Around
+    QAtomicInteger<quint32> sequence;
+    // Line
+    QByteArray      line;
+};
+
+
+
+
+//==============================================================================
+// Async Logger Class - Lock Free Ring Buffer, Flushed To File On Its Own Thread
+//==============================================================================
+class AsyncLogger : public QThread
+{
+public:
+
+    // Install - Replaces The Qt Message Handler
+    static void install(const QString& aFilePath);
+    // Uninstall - Drains The Ring Buffer And Restores The Default Handler
+    static void uninstall();
+
+protected:
+
+    // Message Handler
+    static void messageHandler(QtMsgType aType, const QMessageLogContext& aContext, const QString& aMessage);
+
+    // Get Level For Message Type - Debug 0 .. Fatal 4
+    static int typeLevel(const QtMsgType& aType);
+    // Get Level By Name
+    static int levelByName(const QString& aName);
+
+protected: // Constructor/Destructor
+
+    // Constructor
+    explicit AsyncLogger(const QString& aFilePath);
+
+    // Destructor
+    virtual ~AsyncLogger();
+
+protected: // From QThread
+
+    // Run - Flusher Loop
+    virtual void run();
+
+protected:
+
+    // Log Message
+    void log(QtMsgType aType, const QMessageLogContext& aContext, const QString& aMessage);
+
+    // Load Rules - "*=info;FileListModel=debug"
+    void loadRules(const QString& aRules);
+    // Get Category - QLoggingCategory Or 'Class' Of "Class::method - ..."
+    QString messageCategory(const QMessageLogContext& aContext, const QString& aMessage);
+    // Get Category Level
+    int categoryLevel(const QString& aCategory);
+
+    // Push Line - Returns False If The Ring Buffer Is Full
+    bool push(const QByteArray& aLine);
+    // Pop Line - Flusher Thread Only
+    bool pop(QByteArray& aLine);
+
+    // Drain Ring Buffer To Log File
+    void drain();
+    // Rotate Log File
+    void rotate();
+
+protected:
+
+    // Log File Path
+    QString                 filePath;
+    // Log File - Flusher Thread Only
+    QFile                   logFile;
+
+    // Ring Buffer
+    QVector<AsyncLoggerSlot> ring;
+    // Ring Buffer Mask - Size Is A Power Of 2
+    quint32                 ringMask;
+    // Enqueue Position - Unsigned, Wraps Around Without Overflow
+    QAtomicInteger<quint32> enqueuePos;
+    // Dequeue Position - Flusher Thread Only
+    quint32                 dequeuePos;
+
+    // Dropped Lines - Ring Buffer Was Full
+    QAtomicInt              dropped;
+    // Running
+    QAtomicInt              running;
+
+    // Default Level
+    int                     defaultLevel;
+    // Category Levels - Read Only Once Installed
+    QHash<QString, int>     categoryLevels;
+};
+
+#endif // ASYNCLOGGER_H
@@ -0,0 +1,656 @@
+#include <QDebug>
+
+#include <string.h>
+
+#include "audiocoverart.h"
+#include "constants.h"
+
+
+// Picture Type Front Cover - Shared By ID3v2 And FLAC
+#define AUDIO_PICTURE_TYPE_FRONT_COVER      3
+// FLAC Picture Block Type
+#define AUDIO_FLAC_BLOCK_PICTURE            6
+// FLAC Invalid Block Type
+#define AUDIO_FLAC_BLOCK_INVALID            127
+
+
+//==============================================================================
+// Extract Cover Art
+//==============================================================================
+QByteArray AudioCoverArt::extract(const QString& aFilePath)
+{
+    // Init File
+    QFile file(aFilePath);
+
+    // Open File
+    if (!file.open(QIODevice::ReadOnly)) {
+        return QByteArray();
+    }
+
+    // Read Header
+    QByteArray header = file.read(12);
+
+    // Check Header
+    if (header.size() < 12) {
+        return QByteArray();
+    }
+
+    // Check ID3v2 Tag
+    if (header.startsWith("ID3")) {
+        // Extract From ID3v2 Tag
+        QByteArray coverArt = extractID3v2(file);
+
+        // Check Cover Art
+        if (!coverArt.isEmpty()) {
+            return coverArt;
+        }
+
+        // Get Tag End - FLAC Files Are Sometimes Prefixed With An ID3v2 Tag
+        qint64 tagEnd = 10 + readSyncSafe((const uchar*)header.constData() + 6) + ((header[5] & 0x10) ? 10 : 0);
+
+        // Seek To Tag End
+        if (file.seek(tagEnd) && file.read(4) == "fLaC") {
+            return extractFLAC(file, tagEnd + 4);
+        }
+
+        return QByteArray();
+    }
+
+    // Check FLAC Stream
+    if (header.startsWith("fLaC")) {
+        return extractFLAC(file, 4);
+    }
+
+    // Check MP4 File Type Atom
+    if (header.mid(4, 4) == "ftyp") {
+        return extractMP4(file);
+    }
+
+    return QByteArray();
+}
+
+//==============================================================================
+// Extract From ID3v2 Tag
+//==============================================================================
+QByteArray AudioCoverArt::extractID3v2(QFile& aFile)
+{
+    // Seek To Start
+    aFile.seek(0);
+
+    // Read Header
+    QByteArray header = aFile.read(10);
+
+    // Check Header
+    if (header.size() < 10) {
+        return QByteArray();
+    }
+
+    // Get Version
+    int version = (uchar)header[3];
+    // Get Flags
+    int flags = (uchar)header[5];
+    // Get Tag Size - Without Header
+    qint64 tagSize = qMin((qint64)readSyncSafe((const uchar*)header.constData() + 6), aFile.size() - 10);
+
+    // Check Version & Tag Size
+    if (version < 2 || version > 4 || tagSize <= 0 || tagSize > DEFAULT_AUDIO_TAG_MAX_REGION_SIZE) {
+        return QByteArray();
+    }
+
+    // Init Buffer
+    QByteArray buffer;
+    // Map Tag Region
+    const uchar* data = mapRegion(aFile, 10, tagSize, buffer);
+
+    // Check Data
+    if (!data) {
+        return QByteArray();
+    }
+
+    // Init Frames
+    const uchar* frames = data;
+    // Init Frames Size
+    qint64 framesSize = tagSize;
+    // Init Unsync Buffer
+    QByteArray unsyncBuffer;
+
+    // Check Unsynchronisation - Tag Wide Before 2.4
+    if ((flags & 0x80) && version < 4) {
+        // Remove Unsynchronisation
+        unsyncBuffer = removeUnsync(frames, framesSize);
+        // Set Frames
+        frames = (const uchar*)unsyncBuffer.constData();
+        // Set Frames Size
+        framesSize = unsyncBuffer.size();
+    }
+
+    // Init Cover Art
+    QByteArray coverArt;
+
+    // Check Extended Header
+    if ((flags & 0x40) && version >= 3 && framesSize >= 4) {
+        // Get Extended Header Size - Excludes Its Size Field Before 2.4
+        qint64 extSize = version == 3 ? (qint64)readUInt32(frames) + 4 : (qint64)readSyncSafe(frames);
+
+        // Check Extended Header Size
+        if (extSize < framesSize) {
+            // Skip Extended Header
+            coverArt = findID3v2Picture(frames + extSize, framesSize - extSize, version);
+        }
+    } else {
+        // Find Picture
+        coverArt = findID3v2Picture(frames, framesSize, version);
+    }
+
+    // Check Buffer - Unmap Only What Was Mapped
+    if (buffer.isEmpty()) {
+        // Unmap
+        aFile.unmap((uchar*)data);
+    }
+
+    return coverArt;
+}
+
+//==============================================================================
+// Find ID3v2 Picture Frame
+//==============================================================================
+QByteArray AudioCoverArt::findID3v2Picture(const uchar* aData, const qint64& aSize, const int& aVersion)
+{
+    // Get Frame Header Size
+    qint64 headerSize = aVersion == 2 ? 6 : 10;
+    // Init Position
+    qint64 pos = 0;
+
+    // Init Best Picture
+    QByteArray bestPicture;
+    // Init Best Picture Type
+    int bestType = -1;
+
+    // Go Thru Frames
+    while (pos + headerSize <= aSize && bestType != AUDIO_PICTURE_TYPE_FRONT_COVER) {
+        // Check Padding
+        if (aData[pos] == 0) {
+            break;
+        }
+
+        // Get Frame Size
+        qint64 frameSize = aVersion == 2 ? readUInt24(aData + pos + 3) : aVersion == 3 ? readUInt32(aData + pos + 4) : readSyncSafe(aData + pos + 4);
+        // Get Frame Flags
+        int frameFlags = aVersion == 2 ? 0 : (aData[pos + 8] << 8) | aData[pos + 9];
+        // Get Frame Start
+        qint64 frameStart = pos + headerSize;
+
+        // Check Frame Size
+        if (frameSize > aSize - frameStart) {
+            break;
+        }
+
+        // Check Frame ID
+        if (aVersion == 2 ? memcmp(aData + pos, "PIC", 3) == 0 : memcmp(aData + pos, "APIC", 4) == 0) {
+            // Init Frame Data
+            const uchar* frameData = aData + frameStart;
+            // Init Frame Data Size
+            qint64 frameDataSize = frameSize;
+            // Init Frame Buffer
+            QByteArray frameBuffer;
+            // Init Supported - Compressed And Encrypted Frames Are Skipped
+            bool supported = aVersion == 2 || (aVersion == 3 ? !(frameFlags & 0x00C0) : !(frameFlags & 0x000C));
+
+            // Check Grouping Identity
+            if (supported && (aVersion == 3 ? (frameFlags & 0x0020) : (frameFlags & 0x0040)) && frameDataSize > 1) {
+                // Skip Group ID
+                frameData += 1;
+                frameDataSize -= 1;
+            }
+
+            // Check Data Length Indicator
+            if (supported && aVersion == 4 && (frameFlags & 0x0001) && frameDataSize > 4) {
+                // Skip Data Length
+                frameData += 4;
+                frameDataSize -= 4;
+            }
+
+            // Check Frame Unsynchronisation
+            if (supported && aVersion == 4 && (frameFlags & 0x0002)) {
+                // Remove Unsynchronisation
+                frameBuffer = removeUnsync(frameData, frameDataSize);
+                // Set Frame Data
+                frameData = (const uchar*)frameBuffer.constData();
+                // Set Frame Data Size
+                frameDataSize = frameBuffer.size();
+            }
+
+            // Init Picture Type
+            int pictureType = -1;
+            // Get Picture Data
+            QByteArray picture = supported ? id3v2PictureData(frameData, frameDataSize, aVersion, &pictureType) : QByteArray();
+
+            // Check Picture - Front Cover Wins, Otherwise The First One
+            if (!picture.isEmpty() && (bestPicture.isEmpty() || pictureType == AUDIO_PICTURE_TYPE_FRONT_COVER)) {
+                // Set Best Picture
+                bestPicture = picture;
+                // Set Best Type
+                bestType = pictureType;
+            }
+        }
+
+        // Next Frame
+        pos = frameStart + frameSize;
+    }
+
+    return bestPicture;
+}
+
+//==============================================================================
+// Get ID3v2 Picture Data From APIC/PIC Frame
+//==============================================================================
+QByteArray AudioCoverArt::id3v2PictureData(const uchar* aData, const qint64& aSize, const int& aVersion, int* aPictureType)
+{
+    // Check Size
+    if (aSize < 4) {
+        return QByteArray();
+    }
+
+    // Get Text Encoding
+    int encoding = aData[0];
+    // Init Position
+    qint64 pos = 1;
+
+    // Check Version
+    if (aVersion == 2) {
+        // Skip Image Format - 3 Chars
+        pos += 3;
+    } else {
+        // Skip MIME Type - Latin1, Zero Terminated
+        while (pos < aSize && aData[pos] != 0) {
+            pos++;
+        }
+        // Skip Terminator
+        pos++;
+    }
+
+    // Check Position
+    if (pos >= aSize) {
+        return QByteArray();
+    }
+
+    // Get Picture Type
+    *aPictureType = aData[pos++];
+
+    // Check Encoding - UTF-16 Descriptions Are Terminated By Two Zeros
+    if (encoding == 1 || encoding == 2) {
+        // Skip Description
+        while (pos + 1 < aSize && (aData[pos] != 0 || aData[pos + 1] != 0)) {
+            pos += 2;
+        }
+        // Skip Terminator
+        pos += 2;
+    } else {
+        // Skip Description
+        while (pos < aSize && aData[pos] != 0) {
+            pos++;
+        }
+        // Skip Terminator
+        pos++;
+    }
+
+    // Check Position
+    if (pos >= aSize) {
+        return QByteArray();
+    }
+
+    return QByteArray((const char*)aData + pos, aSize - pos);
+}
+
+//==============================================================================
+// Extract From FLAC Metadata Blocks
+//==============================================================================
+QByteArray AudioCoverArt::extractFLAC(QFile& aFile, const qint64& aOffset)
+{
+    // Get File Size
+    qint64 fileSize = aFile.size();
+    // Init Position
+    qint64 pos = aOffset;
+    // Init Last Block
+    bool lastBlock = false;
+
+    // Init Best Picture
+    QByteArray bestPicture;
+    // Init Best Picture Type
+    int bestType = -1;
+
+    // Go Thru Metadata Blocks - Block Headers Only, Audio Frames Are Never Read
+    while (!lastBlock && bestType != AUDIO_PICTURE_TYPE_FRONT_COVER && aFile.seek(pos)) {
+        // Read Block Header
+        QByteArray blockHeader = aFile.read(4);
+
+        // Check Block Header
+        if (blockHeader.size() < 4) {
+            break;
+        }
+
+        // Get Last Block
+        lastBlock = (uchar)blockHeader[0] & 0x80;
+        // Get Block Type
+        int blockType = (uchar)blockHeader[0] & 0x7F;
+        // Get Block Size
+        qint64 blockSize = readUInt24((const uchar*)blockHeader.constData() + 1);
+
+        // Inc Position
+        pos += 4;
+
+        // Check Block
+        if (blockType == AUDIO_FLAC_BLOCK_INVALID || blockSize > fileSize - pos) {
+            break;
+        }
+
+        // Check Block Type
+        if (blockType == AUDIO_FLAC_BLOCK_PICTURE && blockSize >= 32) {
+            // Init Buffer
+            QByteArray buffer;
+            // Map Block
+            const uchar* data = mapRegion(aFile, pos, blockSize, buffer);
+
+            // Check Data
+            if (data) {
+                // Get Picture Type
+                int pictureType = readUInt32(data);
+                // Get Offset - Skip MIME Type
+                qint64 offset = 8 + (qint64)readUInt32(data + 4);
+
+                // Check Offset
+                if (offset + 4 <= blockSize) {
+                    // Skip Description, Width, Height, Depth And Colors
+                    offset += 4 + (qint64)readUInt32(data + offset) + 16;
+                }
+
+                // Check Offset
+                if (offset + 4 <= blockSize) {
+                    // Get Picture Size
+                    qint64 pictureSize = readUInt32(data + offset);
+                    // Inc Offset
+                    offset += 4;
+
+                    // Check Picture - Front Cover Wins, Otherwise The First One
+                    if (pictureSize > 0 && pictureSize <= blockSize - offset && (bestPicture.isEmpty() || pictureType == AUDIO_PICTURE_TYPE_FRONT_COVER)) {
+                        // Set Best Picture
+                        bestPicture = QByteArray((const char*)data + offset, pictureSize);
+                        // Set Best Type
+                        bestType = pictureType;
+                    }
+                }
+
+                // Check Buffer - Unmap Only What Was Mapped
+                if (buffer.isEmpty()) {
+                    // Unmap
+                    aFile.unmap((uchar*)data);
+                }
+            }
+        }
+
+        // Next Block
+        pos += blockSize;
+    }
+
+    return bestPicture;
+}
+
+//==============================================================================
+// Extract From MP4 Atoms
+//==============================================================================
+QByteArray AudioCoverArt::extractMP4(QFile& aFile)
+{
+    // Get File Size
+    qint64 fileSize = aFile.size();
+    // Init Position
+    qint64 pos = 0;
+
+    // Go Thru Top Level Atoms - moov May Follow mdat, So Only Headers Are Read
+    while (pos + 8 <= fileSize && aFile.seek(pos)) {
+        // Read Atom Header
+        QByteArray atomHeader = aFile.read(16);
+
+        // Check Atom Header
+        if (atomHeader.size() < 8) {
+            break;
+        }
+
+        // Get Header Data
+        const uchar* headerData = (const uchar*)atomHeader.constData();
+        // Get Atom Size
+        qint64 atomSize = readUInt32(headerData);
+        // Init Header Size
+        qint64 headerSize = 8;
+
+        // Check Atom Size - 64 Bit Size Follows The Type
+        if (atomSize == 1 && atomHeader.size() >= 16) {
+            // Get Atom Size
+            atomSize = ((qint64)readUInt32(headerData + 8) << 32) | (qint64)readUInt32(headerData + 12);
+            // Set Header Size
+            headerSize = 16;
+        } else if (atomSize == 0) {
+            // Set Atom Size - Extends To The End Of File
+            atomSize = fileSize - pos;
+        }
+
+        // Check Atom Size
+        if (atomSize < headerSize || atomSize > fileSize - pos) {
+            break;
+        }
+
+        // Check Atom Type
+        if (memcmp(headerData + 4, "moov", 4) == 0) {
+            // Get Movie Size
+            qint64 moovSize = atomSize - headerSize;
+
+            // Check Movie Size
+            if (moovSize <= 0 || moovSize > DEFAULT_AUDIO_TAG_MAX_REGION_SIZE) {
+                break;
+            }
+
+            // Init Buffer
+            QByteArray buffer;
+            // Map Movie Atom
+            const uchar* data = mapRegion(aFile, pos + headerSize, moovSize, buffer);
+
+            // Check Data
+            if (!data) {
+                break;
+            }
+
+            // Init Cover Art
+            QByteArray coverArt;
+            // Init Size
+            qint64 size = moovSize;
+            // Find moov/udta
+            qint64 offset = findMP4Atom(data, size, "udta", &size);
+
+            // Check Offset
+            if (offset >= 0) {
+                // Find udta/meta
+                qint64 metaOffset = findMP4Atom(data + offset, size, "meta", &size);
+                // Set Offset
+                offset = metaOffset >= 0 ? offset + metaOffset : -1;
+            }
+
+            // Check Offset - meta Is A Full Box In iTunes Files
+            if (offset >= 0 && size >= 4 && readUInt32(data + offset) == 0) {
+                // Skip Version & Flags
+                offset += 4;
+                size -= 4;
+            }
+
+            // Check Offset
+            if (offset >= 0) {
+                // Find meta/ilst
+                qint64 ilstOffset = findMP4Atom(data + offset, size, "ilst", &size);
+                // Set Offset
+                offset = ilstOffset >= 0 ? offset + ilstOffset : -1;
+            }
+
+            // Check Offset
+            if (offset >= 0) {
+                // Find ilst/covr
+                qint64 covrOffset = findMP4Atom(data + offset, size, "covr", &size);
+                // Set Offset
+                offset = covrOffset >= 0 ? offset + covrOffset : -1;
+            }
+
+            // Check Offset
+            if (offset >= 0) {
+                // Find covr/data
+                qint64 dataOffset = findMP4Atom(data + offset, size, "data", &size);
+                // Set Offset
+                offset = dataOffset >= 0 ? offset + dataOffset : -1;
+            }
+
+            // Check Offset - Type Indicator And Locale Precede The Image
+            if (offset >= 0 && size > 8) {
+                // Set Cover Art
+                coverArt = QByteArray((const char*)data + offset + 8, size - 8);
+            }
+
+            // Check Buffer - Unmap Only What Was Mapped
+            if (buffer.isEmpty()) {
+                // Unmap
+                aFile.unmap((uchar*)data);
+            }
+
+            return coverArt;
+        }
+
+        // Next Atom
+        pos += atomSize;
+    }
+
+    return QByteArray();
+}
+
+//==============================================================================
+// Find MP4 Atom
+//==============================================================================
+qint64 AudioCoverArt::findMP4Atom(const uchar* aData, const qint64& aSize, const char* aType, qint64* aAtomSize)
+{
+    // Init Position
+    qint64 pos = 0;
+
+    // Go Thru Atoms
+    while (pos + 8 <= aSize) {
+        // Get Atom Size
+        qint64 atomSize = readUInt32(aData + pos);
+        // Init Header Size
+        qint64 headerSize = 8;
+
+        // Check Atom Size - 64 Bit Size Follows The Type
+        if (atomSize == 1 && pos + 16 <= aSize) {
+            // Get Atom Size
+            atomSize = ((qint64)readUInt32(aData + pos + 8) << 32) | (qint64)readUInt32(aData + pos + 12);
+            // Set Header Size
+            headerSize = 16;
+        } else if (atomSize == 0) {
+            // Set Atom Size - Extends To The End Of The Parent
+            atomSize = aSize - pos;
+        }
+
+        // Check Atom Size
+        if (atomSize < headerSize || atomSize > aSize - pos) {
+            break;
+        }
+
+        // Check Atom Type
+        if (memcmp(aData + pos + 4, aType, 4) == 0) {
+            // Set Atom Size - Content Only
+            *aAtomSize = atomSize - headerSize;
+
+            return pos + headerSize;
+        }
+
+        // Next Atom
+        pos += atomSize;
+    }
+
+    return -1;
+}
+
+//==============================================================================
+// Map Region
+//==============================================================================
+const uchar* AudioCoverArt::mapRegion(QFile& aFile, const qint64& aOffset, const qint64& aSize, QByteArray& aBuffer)
+{
+    // Map Region
+    const uchar* data = aFile.map(aOffset, aSize);
+
+    // Check Data
+    if (data) {
+        return data;
+    }
+
+    qDebug() << "AudioCoverArt::mapRegion - fileName: " << aFile.fileName() << " - error: " << aFile.errorString();
+
+    // Seek To Offset
+    if (!aFile.seek(aOffset)) {
+        return NULL;
+    }
+
+    // Read Region
+    aBuffer = aFile.read(aSize);
+
+    // Check Buffer
+    if (aBuffer.size() != aSize) {
+        // Clear Buffer
+        aBuffer.clear();
+
+        return NULL;
+    }
+
+    return (const uchar*)aBuffer.constData();
+}
+
+//==============================================================================
+// Remove Unsynchronisation
+//==============================================================================
+QByteArray AudioCoverArt::removeUnsync(const uchar* aData, const qint64& aSize)
+{
+    // Init Result
+    QByteArray result;
+    // Reserve
+    result.reserve(aSize);
+
+    // Go Thru Data
+    for (qint64 i = 0; i < aSize; ++i) {
+        // Append Byte
+        result.append((char)aData[i]);
+
+        // Check Byte - 0xFF 0x00 Stands For 0xFF
+        if (aData[i] == 0xFF && i + 1 < aSize && aData[i + 1] == 0x00) {
+            // Skip Zero
+            ++i;
+        }
+    }
+
+    return result;
+}
+
+//==============================================================================
+// Read Big Endian 32 Bit Value
+//==============================================================================
+quint32 AudioCoverArt::readUInt32(const uchar* aData)
+{
+    return ((quint32)aData[0] << 24) | ((quint32)aData[1] << 16) | ((quint32)aData[2] << 8) | (quint32)aData[3];
+}
+
+//==============================================================================
+// Read Big Endian 24 Bit Value
+//==============================================================================
+quint32 AudioCoverArt::readUInt24(const uchar* aData)
+{
+    return ((quint32)aData[0] << 16) | ((quint32)aData[1] << 8) | (quint32)aData[2];
+}
+
+//==============================================================================
+// Read Sync Safe 32 Bit Value
+//==============================================================================
+quint32 AudioCoverArt::readSyncSafe(const uchar* aData)
+{
+    return ((quint32)(aData[0] & 0x7F) << 21) | ((quint32)(aData[1] & 0x7F) << 14) | ((quint32)(aData[2] & 0x7F) << 7) | (quint32)(aData[3] & 0x7F);
+}
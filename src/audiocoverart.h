@@ -0,0 +1,48 @@
+#ifndef AUDIOCOVERART_H
+#define AUDIOCOVERART_H
+
+#include <QString>
+#include <QByteArray>
+#include <QFile>
+
+
+//==============================================================================
+// Audio Cover Art Class - Embedded Artwork From ID3v2, FLAC And MP4 Tags
+//==============================================================================
+class AudioCoverArt
+{
+public:
+
+    // Extract Cover Art - Encoded Image Data, Only The Tag Region Is Mapped
+    static QByteArray extract(const QString& aFilePath);
+
+protected:
+
+    // Extract From ID3v2 Tag
+    static QByteArray extractID3v2(QFile& aFile);
+    // Extract From FLAC Metadata Blocks
+    static QByteArray extractFLAC(QFile& aFile, const qint64& aOffset);
+    // Extract From MP4 Atoms
+    static QByteArray extractMP4(QFile& aFile);
+
+    // Find ID3v2 Picture Frame
+    static QByteArray findID3v2Picture(const uchar* aData, const qint64& aSize, const int& aVersion);
+    // Get ID3v2 Picture Data From APIC/PIC Frame
+    static QByteArray id3v2PictureData(const uchar* aData, const qint64& aSize, const int& aVersion, int* aPictureType);
+    // Find MP4 Atom - Returns Offset Of The Atom Content Or -1
+    static qint64 findMP4Atom(const uchar* aData, const qint64& aSize, const char* aType, qint64* aAtomSize);
+
+    // Map Region - Falls Back To Reading When Mapping Fails
+    static const uchar* mapRegion(QFile& aFile, const qint64& aOffset, const qint64& aSize, QByteArray& aBuffer);
+    // Remove Unsynchronisation
+    static QByteArray removeUnsync(const uchar* aData, const qint64& aSize);
+
+    // Read Big Endian 32 Bit Value
+    static quint32 readUInt32(const uchar* aData);
+    // Read Big Endian 24 Bit Value
+    static quint32 readUInt24(const uchar* aData);
+    // Read Sync Safe 32 Bit Value
+    static quint32 readSyncSafe(const uchar* aData);
+};
+
+#endif // AUDIOCOVERART_H
@@ -1,8 +1,22 @@
+#include <QFileInfo>
+#include <QDateTime>
+#include <QDir>
+#include <QBuffer>
+#include <QImageReader>
+#include <QMutexLocker>
 #include <QDebug>
 
 #include "audiotagimageprovider.h"
+#include "audiocoverart.h"
 #include "constants.h"
 
+
+// Cover Cache Mutex
+QMutex AudioTagImageProvider::coverCacheMutex;
+// Cover Cache - Shared By All Viewer Windows
+QCache<QString, QImage> AudioTagImageProvider::coverCache(DEFAULT_AUDIO_TAG_CACHE_MAX_COST);
+
+
 //==============================================================================
 // Constructor
 //==============================================================================
@@ -21,17 +35,110 @@ AudioTagImageProvider::AudioTagImageProvider()
 //==============================================================================
 QImage AudioTagImageProvider::requestImage(const QString& aID, QSize* aSize, const QSize& aRequestedSize)
 {
-    Q_UNUSED(aID);
-    Q_UNUSED(aSize);
-    Q_UNUSED(aRequestedSize);
+    //qDebug() << "AudioTagImageProvider::requestImage - aID: " << aID << " - aRequestedSize: " << aRequestedSize;
+
+    // Init File Info
+    QFileInfo fileInfo(aID);
+    // Init Target Size
+    QSize targetSize(aRequestedSize.width() > 0 ? aRequestedSize.width() : imageWidth, aRequestedSize.height() > 0 ? aRequestedSize.height() : imageHeight);
+    // Init Cache Key - Changed Files Get New Keys
+    QString cacheKey = QString("%1:%2:%3:%4x%5").arg(QDir::cleanPath(fileInfo.absoluteFilePath()))
+                                                  .arg(fileInfo.lastModified().toMSecsSinceEpoch())
+                                                  .arg(fileInfo.size())
+                                                  .arg(targetSize.width())
+                                                  .arg(targetSize.height());
+    // Init Image
+    QImage image;
+    // Init Cached
+    bool cached = false;
+
+    // Lock
+    coverCacheMutex.lock();
+
+    // Get Cached Image
+    QImage* cachedImage = coverCache.object(cacheKey);
+
+    // Check Cached Image
+    if (cachedImage) {
+        // Set Image
+        image = *cachedImage;
+        // Set Cached
+        cached = true;
+    }
+
+    // Unlock
+    coverCacheMutex.unlock();
+
+    // Check Cached
+    if (!cached && fileInfo.isFile()) {
+        // Extract Cover Art - Only The Tag Region Is Mapped
+        QByteArray coverArt = AudioCoverArt::extract(fileInfo.absoluteFilePath());
+
+        // Check Cover Art
+        if (!coverArt.isEmpty()) {
+            // Decode Cover Art
+            image = decodeCoverArt(coverArt, targetSize);
+        }
+
+        QMutexLocker locker(&coverCacheMutex);
+
+        // Insert Image - Files Without Cover Art Are Remembered Too
+        coverCache.insert(cacheKey, new QImage(image), qMax(1, image.byteCount() / 1024));
+    }
+
+    // Check Image
+    if (image.isNull()) {
+        // Set Default Image
+        image = QImage(DEFAULT_AUDIO_TAG_DEFAULT_IMAGE);
+    }
+
+    // Check Size
+    if (aSize) {
+        // Set Size
+        *aSize = image.size();
+    }
+
+    return image;
+}
+
+//==============================================================================
+// Decode Cover Art
+//==============================================================================
+QImage AudioTagImageProvider::decodeCoverArt(const QByteArray& aCoverArt, const QSize& aTargetSize)
+{
+    // Init Buffer
+    QBuffer buffer;
+    // Set Data
+    buffer.setData(aCoverArt);
+
+    // Init Image Reader
+    QImageReader reader(&buffer);
 
-    qDebug() << "FileListImageProvider::requestImage - aID: " << aID << " - aRequestedSize: " << aRequestedSize;
+    // Get Image Size - Read From The Header Only
+    QSize imageSize = reader.size();
 
-    // Init File Name
-    QString fileName = aID;
+    // Check Image Size
+    if (imageSize.isValid() && (imageSize.width() > aTargetSize.width() || imageSize.height() > aTargetSize.height())) {
+        // Set Scaled Size - Decoders Like JPEG Skip Most Of The Full Resolution Work
+        reader.setScaledSize(imageSize.scaled(aTargetSize, Qt::KeepAspectRatio));
+    }
 
+    // Read Image
+    QImage image = reader.read();
 
-    return QImage(":/resources/images/default-audio-icon.png");
+    // Check Image
+    if (image.isNull()) {
+        qDebug() << "AudioTagImageProvider::decodeCoverArt - error: " << reader.errorString();
+        return image;
+    }
+
+    // Check Image Size - Size Was Unknown Before Decoding
+    if (image.width() > aTargetSize.width() || image.height() > aTargetSize.height()) {
+        // Scale Image
+        image = image.scaled(aTargetSize, Qt::KeepAspectRatio, Qt::SmoothTransformation);
+    }
+
+    return image;
 }
 
 //==============================================================================
@@ -44,4 +151,3 @@ AudioTagImageProvider::~AudioTagImageProvider()
 
     qDebug() << "AudioTagImageProvider::~AudioTagImageProvider";
 }
-
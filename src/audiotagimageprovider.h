@@ -2,10 +2,12 @@
 #define AUDIOTAGIMAGEPROVIDER_H
 
 #include <QQuickImageProvider>
+#include <QCache>
+#include <QMutex>
 
 
 //==============================================================================
-// Audio Tag Image Provider Class
+// Audio Tag Image Provider Class - Embedded Cover Art
 //==============================================================================
 class AudioTagImageProvider : public QQuickImageProvider
 {
@@ -22,13 +24,20 @@ protected:
     // Request Image
     virtual QImage requestImage(const QString& aID, QSize* aSize, const QSize& aRequestedSize);
 
+    // Decode Cover Art - Scaled Decode To Fit The Target Size
+    static QImage decodeCoverArt(const QByteArray& aCoverArt, const QSize& aTargetSize);
+
 protected:
 
     // Image Width
-    int                 imageWidth;
+    int                             imageWidth;
     // Image Height
-    int                 imageHeight;
+    int                             imageHeight;
 
+    // Cover Cache Mutex
+    static QMutex                   coverCacheMutex;
+    // Cover Cache - Keyed By File Path, MTime, Size And Target Size, Cost Is KB
+    static QCache<QString, QImage>  coverCache;
 };
 
 #endif // AUDIOTAGIMAGEPROVIDER_H
@@ -111,6 +111,12 @@
 
 #define SETTINGS_KEY_PANEL_COPY_HIDDEN_FILES                SETTINGS_GROUP_PANEL_COMMON"/copyHidden"
 
+#define SETTINGS_KEY_DIR_SCAN_THREADS                       SETTINGS_GROUP_PANEL_COMMON"/dirScanThreads"
+#define SETTINGS_KEY_DIR_SCAN_DEVICE_THREADS                SETTINGS_GROUP_PANEL_COMMON"/dirScanDeviceThreads"
+#define SETTINGS_KEY_TRANSFER_THREADS                       SETTINGS_GROUP_PANEL_COMMON"/transferThreads"
+#define SETTINGS_KEY_TRANSFER_DEVICE_THREADS                SETTINGS_GROUP_PANEL_COMMON"/transferDeviceThreads"
+#define SETTINGS_KEY_TRANSFER_BATCH_THRESHOLD               SETTINGS_GROUP_PANEL_COMMON"/transferBatchThreshold"
+
 #define SETTINGS_KEY_PANEL_USE_DEFAULT_ICONS                SETTINGS_GROUP_UI"/defaultIcons"
 #define SETTINGS_KEY_SHOW_FULL_SIZES                        SETTINGS_GROUP_UI"/showFullSizes"
 
@@ -282,6 +288,7 @@
 
 #define DEFAULT_AUDIO_TAG_IMAGE_WIDTH                       256
 #define DEFAULT_AUDIO_TAG_IMAGE_HEIGHT                      256
+#define DEFAULT_AUDIO_TAG_DEFAULT_IMAGE                     ":/resources/images/default-audio-icon.png"
 
 
 #define DEFAULT_STATUS_BAR_MESSAGE_TIMEOUT                  3000
@@ -357,10 +364,28 @@
 #define DEFAULT_ICON_WARNING                                ":/resources/images/warning.png"
 #define DEFAULT_ICON_ERROR                                  ":/resources/images/error.png"
 
+#define DEFAULT_ICONS_PATH_LINUX                            "/usr/share/icons"
+#define DEFAULT_ICONS_MIMETYPES_DIR                         "mimetypes"
+#define DEFAULT_ICONS_MIMES_DIR                             "mimes"
+#define DEFAULT_ICONS_FALLBACK_THEME                        "hicolor"
+
 #define DEFAULT_DIR_HISTORY_LIST_ITEMS_MAX                  16
 
 #define DEFAULT_FILE_LIST_DIR_HSITORY_FILENAME              ".dirHistory%1.list"
 
+#define DEFAULT_DIR_SIZE_INDEX_FILENAME                     ".dirSizeIndex.db"
+
+#define DEFAULT_DIR_FRECENCY_FILENAME                       ".dirFrecency.log"
+
+#define DEFAULT_ICON_THEME_INDEX_FILENAME                   ".iconThemeIndex.db"
+
+#define DEFAULT_THUMBNAIL_CACHE_DIR                         "thumbnails"
+
+#define DEFAULT_LISTING_SNAPSHOT_FILENAME                   ".listing%1.snap"
+
+#define DEFAULT_LOG_FILENAME                                "log.txt"
+#define DEFAULT_LOG_RULES_ENV                               "MAXCOMMANDER_LOG_RULES"
+
 #define DEFAULT_FILE_LIST_DIR_HISTORY_ITEM_HEIGHT           24
 #define DEFAULT_FILE_LIST_DIR_HISTORY_RADIUS                8
 #define DEFAULT_FILE_LIST_DIR_HISTORY_EMPTY_HEIGHT          46
@@ -383,6 +408,136 @@
 #define DEFAULT_DROP_COMMAND_COPY                           1
 #define DEFAULT_DROP_COMMAND_MOVE                           2
 
+// Owner Name Cache Time To Live - msecs
+#define DEFAULT_OWNER_NAME_CACHE_TTL                        600000
+// Owner Name Resolver Threads
+#define DEFAULT_OWNER_NAME_RESOLVER_THREADS                 2
+// Owner Name Lookup Buffer Size
+#define DEFAULT_OWNER_NAME_BUFFER_SIZE                      16384
+
+// Mime Type Resolver Threads
+#define DEFAULT_MIME_TYPE_RESOLVER_THREADS                  2
+// Mime Type Cache Max Items
+#define DEFAULT_MIME_TYPE_CACHE_MAX_ITEMS                   65536
+// Mime Type Column Refresh Delay - msecs
+#define DEFAULT_MIME_TYPE_REFRESH_DELAY                     100
+
+// Dir Size Scanner Threads - 0 Uses The Ideal Thread Count
+#define DEFAULT_DIR_SCAN_THREADS                            0
+// Dir Size Scanner Concurrent Dirs Per Device
+#define DEFAULT_DIR_SCAN_DEVICE_THREADS                     4
+// Dir Size Scanner Progress Interval - msecs
+#define DEFAULT_DIR_SCAN_PROGRESS_INTERVAL                  200
+// Dir Size Index Max Items
+#define DEFAULT_DIR_SIZE_INDEX_MAX_ITEMS                    500000
+// Dir Size Index Save Delay - msecs
+#define DEFAULT_DIR_SIZE_INDEX_SAVE_DELAY                   5000
+
+// File System Stats Time To Live - msecs
+#define DEFAULT_FS_STATS_TTL                                5000
+// File System Stats Refresh Interval - msecs
+#define DEFAULT_FS_STATS_REFRESH_INTERVAL                   10000
+// File System Stats Watch Time - Mounts Queried Within Are Kept Fresh - msecs
+#define DEFAULT_FS_STATS_WATCH_TIME                         60000
+// File System Stats Mount Table Time To Live - msecs
+#define DEFAULT_FS_STATS_MOUNT_TABLE_TTL                    2000
+// File System Stats Threads
+#define DEFAULT_FS_STATS_THREADS                            4
+// File System Stats Shutdown Timeout - msecs
+#define DEFAULT_FS_STATS_SHUTDOWN_TIMEOUT                   500
+
+// Listing Snapshot Max Items - Larger Dirs Are Not Snapshotted
+#define DEFAULT_LISTING_SNAPSHOT_MAX_ITEMS                  50000
+
+// Settings Flush Delay - msecs
+#define DEFAULT_SETTINGS_FLUSH_DELAY                        1000
+
+// Log Ring Buffer Size - Power Of 2
+#define DEFAULT_LOG_RING_SIZE                               8192
+// Log Flush Interval - msecs
+#define DEFAULT_LOG_FLUSH_INTERVAL                          100
+// Log Max File Size - Rotated Above
+#define DEFAULT_LOG_MAX_FILE_SIZE                           (8 * 1024 * 1024)
+// Log Max Rotated Files
+#define DEFAULT_LOG_MAX_FILES                               3
+// Log Category Max Length - Longer Prefixes Are Not Class Names
+#define DEFAULT_LOG_CATEGORY_MAX_LENGTH                     40
+
+// Dir Frecency Max Total Rank - Ranks Are Aged Above
+#define DEFAULT_DIR_FRECENCY_MAX_RANK                       10000
+// Dir Frecency Aging Factor
+#define DEFAULT_DIR_FRECENCY_AGING                          0.9
+// Dir Frecency Min Rank - Aged Dirs Below Are Forgotten
+#define DEFAULT_DIR_FRECENCY_MIN_RANK                       1.0
+// Dir Frecency Compact Slack - Extra Log Records Allowed Before Compacting
+#define DEFAULT_DIR_FRECENCY_COMPACT_SLACK                  1000
+
+// Icon Cache Max Cost - KB
+#define DEFAULT_ICON_CACHE_MAX_COST                         (16 * 1024)
+// Icon Cache Stats Interval - Lookups Between Hit Rate Traces
+#define DEFAULT_ICON_CACHE_STATS_INTERVAL                   1000
+
+// Thumbnail Sizes - Freedesktop Thumbnail Spec Flavors
+#define DEFAULT_THUMBNAIL_SIZE_NORMAL                       128
+#define DEFAULT_THUMBNAIL_SIZE_LARGE                        256
+#define DEFAULT_THUMBNAIL_SIZE_XLARGE                       512
+// Thumbnail Threads
+#define DEFAULT_THUMBNAIL_THREADS                           4
+
+// Icon Request Threads - QFileIconProvider Is Not Reentrant
+#define DEFAULT_ICON_REQUEST_THREADS                        1
+// Image Request Latency Weight - Exponential Moving Average
+#define DEFAULT_IMAGE_REQUEST_LATENCY_WEIGHT                0.1
+// Image Request Stats Interval - Requests Between Queue Traces
+#define DEFAULT_IMAGE_REQUEST_STATS_INTERVAL                500
+
+// Audio Tag Cache Max Cost - KB
+#define DEFAULT_AUDIO_TAG_CACHE_MAX_COST                    (8 * 1024)
+// Audio Tag Max Region Size - Larger Tags Are Not Mapped
+#define DEFAULT_AUDIO_TAG_MAX_REGION_SIZE                   (64 * 1024 * 1024)
+
+// Transfer Concurrent Copies - File Server Clients
+#define DEFAULT_TRANSFER_THREADS                            4
+// Transfer Concurrent Copies Per Device
+#define DEFAULT_TRANSFER_DEVICE_THREADS                     4
+// Transfer Rename Batch - Same Device Moves Renamed Per Event Loop Pass
+#define DEFAULT_TRANSFER_RENAME_BATCH                       256
+// Transfer Speed EWMA Weight - Per 1 sec Sample
+#define DEFAULT_TRANSFER_SPEED_EWMA_WEIGHT                  0.3
+// Transfer Throughput Graph Samples
+#define DEFAULT_TRANSFER_GRAPH_SAMPLES                      120
+// Transfer Trace Default File Name
+#define DEFAULT_TRANSFER_TRACE_FILENAME                     "transfer-trace.csv"
+// Transfer Trace File Filter
+#define DEFAULT_TRANSFER_TRACE_FILTER                       "CSV Files (*.csv)"
+// Transfer Batch Threshold - Files Up To This Size Are Copied In Batches, 0 Disables
+#define DEFAULT_TRANSFER_BATCH_THRESHOLD                    (64 * 1024)
+// Transfer Batch Max Files
+#define DEFAULT_TRANSFER_BATCH_MAX_FILES                    256
+// Transfer Batch Benchmark Dir
+#define DEFAULT_TRANSFER_BATCH_BENCH_DIR                    ".mcBatchBenchmark"
+// Transfer Batch Benchmark File Count
+#define DEFAULT_TRANSFER_BATCH_BENCH_FILES                  1000000
+// Transfer Batch Benchmark Files Per Dir
+#define DEFAULT_TRANSFER_BATCH_BENCH_DIR_FILES              1000
+// Transfer Batch Benchmark Command Line Argument
+#define DEFAULT_ARGUMENT_BATCH_BENCHMARK                    "--batch-benchmark"
+
+// File Copy Chunk Size - Per Kernel Call, Abort Is Checked In Between
+#define DEFAULT_FILE_COPY_CHUNK_SIZE                        (8 * 1024 * 1024)
+// File Copy Buffer Size - Read/Write Fallback
+#define DEFAULT_FILE_COPY_BUFFER_SIZE                       (1024 * 1024)
+// File Copy Benchmark Dir
+#define DEFAULT_FILE_COPY_BENCH_DIR                         ".mcCopyBenchmark"
+// File Copy Benchmark Large File Size
+#define DEFAULT_FILE_COPY_BENCH_LARGE_SIZE                  (256 * 1024 * 1024)
+// File Copy Benchmark Small File Size
+#define DEFAULT_FILE_COPY_BENCH_SMALL_SIZE                  (4 * 1024)
+// File Copy Benchmark Small File Count
+#define DEFAULT_FILE_COPY_BENCH_SMALL_COUNT                 2000
+// File Copy Benchmark Command Line Argument
+#define DEFAULT_ARGUMENT_COPY_BENCHMARK                     "--copy-benchmark"
+
 
 
 
@@ -492,6 +647,17 @@
 
 #define DEFAULT_LABEL_CURRENT_FILE_TITLE                    "Current File:"
 #define DEFAULT_LABEL_CURRENT_FILE_TITLE_FINISHED           "Finished"
+#define DEFAULT_LABEL_OVERALL_PROGRESS_TITLE                "Overall Progress:"
+#define DEFAULT_LABEL_OVERALL_PROGRESS_TOTALS               "Overall Progress: %1 Files, %2"
+#define DEFAULT_LABEL_OVERALL_PROGRESS_SCANNING             " - Scanning..."
+
+#define DEFAULT_TRANSFER_TELEMETRY_TEXT_TEMPLATE            "%1/s - %2 Files/s"
+#define DEFAULT_TRANSFER_TELEMETRY_ETA_TEMPLATE             " - ETA %1:%2:%3"
+#define DEFAULT_TRANSFER_TELEMETRY_DEVICE_TEMPLATE          "Device %1: %2/s"
+
+#define DEFAULT_BUTTON_TEXT_EXPORT_TRACE                    "Export Trace"
+#define DEFAULT_TITLE_EXPORT_TRACE                          "Export Transfer Trace"
+#define DEFAULT_WARNING_TEXT_CANT_EXPORT_TRACE              "Could not Export Transfer Trace!"
 
 
 #define DEFAULT_TITLE_SELECT_LINK_TARGET                    "Select Link Target"
@@ -15,6 +15,7 @@
 #include "confirmdialog.h"
 #include "busyindicator.h"
 #include "remotefileutilclient.h"
+#include "filelistmodel.h"
 #include "filelistimageprovider.h"
 #include "settingscontroller.h"
 #include "constants.h"
@@ -132,13 +133,10 @@ void DeleteProgressDialog::init()
 //==============================================================================
 // Build Queue
 //==============================================================================
-bool DeleteProgressDialog::buildQueue(const QString& aDirPath, const QStringList& aSelectedFiles)
+bool DeleteProgressDialog::buildQueue(const QString& aDirPath, const FileListSelection& aSelection)
 {
-    // Get Selected Files Count
-    int sfCount = aSelectedFiles.count();
-
-    // Check Selected Files Count
-    if (sfCount <= 0) {
+    // Check Selection
+    if (aSelection.isEmpty()) {
         qDebug() << "DeleteProgressDialog::buildQueue - aDirPath: " << aDirPath << " - NO SELECTED FILES TO DELETE!";
 
         return false;
@@ -151,12 +149,12 @@ bool DeleteProgressDialog::buildQueue(const QString& aDirPath, const QStringList
         return false;
     }
 
-    qDebug() << "DeleteProgressDialog::buildQueue - aDirPath: " << aDirPath << " - sfCount: " << sfCount;
+    qDebug() << "DeleteProgressDialog::buildQueue - aDirPath: " << aDirPath << " - count: " << aSelection.count();
 
-    // Go Thru Selected Files
-    for (int i=0; i<sfCount; ++i) {
+    // Go Thru Selected Rows
+    for (int row = aSelection.first(); row >= 0; row = aSelection.next(row)) {
         // Add To Queue Model
-        queueModel->addItem(aSelectedFiles[i]);
+        queueModel->addItem(aSelection.filePath(row));
     }
 
     return true;
@@ -338,9 +336,9 @@ void DeleteProgressDialog::setArchiveMode(const bool& aArchiveMode)
 //==============================================================================
 // Launch Progress Dialog
 //==============================================================================
-void DeleteProgressDialog::launch(const QString& aDirPath, const QStringList& aSelectedFiles)
+void DeleteProgressDialog::launch(const QString& aDirPath, const FileListSelection& aSelection)
 {
-    qDebug() << "DeleteProgressDialog::launch - aDirPath: " << aDirPath << " - count: " << aSelectedFiles.count();
+    qDebug() << "DeleteProgressDialog::launch - aDirPath: " << aDirPath << " - count: " << aSelection.count();
 
     // Set Dir Path
     dirPath = aDirPath;
@@ -355,8 +353,8 @@ void DeleteProgressDialog::launch(const QString& aDirPath, const QStringList& aS
     // Reset Need Queue
     needQueue = false;
 
-    // Build Queue
-    if (buildQueue(aDirPath, aSelectedFiles)) {
+    // Build Queue - Resolves The Selected Paths One By One
+    if (buildQueue(aDirPath, aSelection)) {
         // Set Queue Index
         setQueueIndex(0);
 
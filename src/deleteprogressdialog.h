@@ -17,6 +17,7 @@ class SettingsController;
 class DeleteProgressModel;
 class RemoteFileUtilClient;
 class ConfirmDialog;
+class FileListSelection;
 
 
 
@@ -43,7 +44,7 @@ public:
     void setCurrentProgress(const int& aProgress);
 
     // Launch Progress Dialog
-    void launch(const QString& aDirPath, const QStringList& aSelectedFiles);
+    void launch(const QString& aDirPath, const FileListSelection& aSelection);
     // Launch Progress Dialog
     void launch(const QString& aDirPath, const QString& aPattern);
     // Get Dir Path
@@ -95,7 +96,7 @@ protected slots:
     void init();
 
     // Build Queue
-    bool buildQueue(const QString& aDirPath, const QStringList& aSelectedFiles);
+    bool buildQueue(const QString& aDirPath, const FileListSelection& aSelection);
     // Process Queue
     void processQueue();
     // Clear Queue
@@ -0,0 +1,626 @@
+#include <QMutex>
+#include <QMutexLocker>
+#include <QSaveFile>
+#include <QDateTime>
+#include <QVector>
+#include <QPair>
+#include <QDir>
+#include <QDebug>
+
+#include <algorithm>
+
+#include "dirfrecencydb.h"
+#include "constants.h"
+
+
+// Dir Frecency DB Singleton
+static DirFrecencyDB* dirFrecencyDBSingleton = NULL;
+// Singleton Mutex
+static QMutex dirFrecencyDBMutex;
+
+// Match Weight - Last Keyword Found In The Last Path Component
+#define DIR_FRECENCY_MATCH_NAME_WEIGHT      4.0
+// Match Weight - Keywords Found As Substrings
+#define DIR_FRECENCY_MATCH_WORD_WEIGHT      2.0
+// Match Weight - Keywords Found As Subsequences Only
+#define DIR_FRECENCY_MATCH_FUZZY_WEIGHT     1.0
+
+
+//==============================================================================
+// Get Current Time - secs Since Epoch
+//==============================================================================
+static qint64 dirFrecencyNow()
+{
+    return QDateTime::currentMSecsSinceEpoch() / 1000;
+}
+
+//==============================================================================
+// Get Normalized Dir Path
+//==============================================================================
+static QString dirFrecencyPath(const QString& aDirPath)
+{
+    // Init Local Dir Path
+    QString localDirPath = aDirPath;
+
+    // Check Local Dir Path
+    if (localDirPath != QString("/") && localDirPath.endsWith("/")) {
+        // Truncate
+        localDirPath.truncate(localDirPath.length() - 1);
+    }
+
+    return localDirPath;
+}
+
+//==============================================================================
+// Candidate Less Than - Higher Scores, Then More Recent Visits First
+//==============================================================================
+static bool dirFrecencyCandidateLessThan(const QPair<double, const DirFrecencyItem*>& aLeft, const QPair<double, const DirFrecencyItem*>& aRight)
+{
+    // Compare Scores
+    if (aLeft.first != aRight.first) {
+        return aLeft.first > aRight.first;
+    }
+
+    return aLeft.second->lastVisit > aRight.second->lastVisit;
+}
+
+//==============================================================================
+// Constructor
+//==============================================================================
+DirFrecencyItem::DirFrecencyItem(const QString& aDirPath, const double& aRank, const qint64& aLastVisit)
+    : dirPath(aDirPath)
+    , rank(aRank)
+    , lastVisit(aLastVisit)
+    , lowerPath(aDirPath.toLower())
+    , nameStart(lowerPath.lastIndexOf('/') + 1)
+    , charMask(DirFrecencyDB::charMask(lowerPath))
+{
+}
+
+//==============================================================================
+// Get Score
+//==============================================================================
+double DirFrecencyItem::score(const qint64& aNow) const
+{
+    // Get Elapsed Time
+    qint64 elapsed = aNow - lastVisit;
+
+    // Check Elapsed Time - Within An Hour
+    if (elapsed < 3600) {
+        return rank * 4.0;
+    }
+
+    // Check Elapsed Time - Within A Day
+    if (elapsed < 86400) {
+        return rank * 2.0;
+    }
+
+    // Check Elapsed Time - Within A Week
+    if (elapsed < 604800) {
+        return rank * 0.5;
+    }
+
+    return rank * 0.25;
+}
+
+
+
+
+
+
+
+//==============================================================================
+// Get Instance - Static Constructor
+//==============================================================================
+DirFrecencyDB* DirFrecencyDB::getInstance()
+{
+    QMutexLocker locker(&dirFrecencyDBMutex);
+
+    // Check Singleton
+    if (!dirFrecencyDBSingleton) {
+        // Create Singleton
+        dirFrecencyDBSingleton = new DirFrecencyDB();
+    } else {
+        // Inc Ref Count
+        dirFrecencyDBSingleton->refCount++;
+    }
+
+    return dirFrecencyDBSingleton;
+}
+
+//==============================================================================
+// Constructor
+//==============================================================================
+DirFrecencyDB::DirFrecencyDB()
+    : refCount(1)
+    , totalRank(0.0)
+    , logRecords(0)
+{
+    // Load
+    load();
+}
+
+//==============================================================================
+// Release
+//==============================================================================
+void DirFrecencyDB::release()
+{
+    QMutexLocker locker(&dirFrecencyDBMutex);
+
+    // Dec Ref Count
+    refCount--;
+
+    // Check Ref Count
+    if (refCount <= 0 && dirFrecencyDBSingleton) {
+        // Delete Singleton
+        delete dirFrecencyDBSingleton;
+        dirFrecencyDBSingleton = NULL;
+    }
+}
+
+//==============================================================================
+// Get DB File Path
+//==============================================================================
+QString DirFrecencyDB::dbFilePath()
+{
+    return QDir::homePath() + "/" + DEFAULT_DIR_FRECENCY_FILENAME;
+}
+
+//==============================================================================
+// Get Char Mask
+//==============================================================================
+quint64 DirFrecencyDB::charMask(const QString& aText)
+{
+    // Init Mask
+    quint64 mask = 0;
+
+    // Get Text Length
+    int tLength = aText.length();
+
+    // Go Thru Text
+    for (int i = 0; i < tLength; ++i) {
+        // Get Char Code
+        ushort code = aText[i].unicode();
+
+        // Check Char Code
+        if (code >= 'a' && code <= 'z') {
+            // Set Letter Bit
+            mask |= Q_UINT64_C(1) << (code - 'a');
+        } else if (code >= '0' && code <= '9') {
+            // Set Digit Bit
+            mask |= Q_UINT64_C(1) << (26 + code - '0');
+        } else if (code != '/' && code != ' ') {
+            // Set Shared Bit For Everything Else
+            mask |= Q_UINT64_C(1) << (36 + code % 28);
+        }
+    }
+
+    return mask;
+}
+
+//==============================================================================
+// Load - Replays The Log
+//==============================================================================
+void DirFrecencyDB::load()
+{
+    // Set File Name
+    logFile.setFileName(dbFilePath());
+
+    // Init Torn - Last Record Cut Short By A Crash
+    bool torn = false;
+
+    // Open Log File
+    if (logFile.open(QIODevice::ReadOnly)) {
+        // Go Thru Log Records
+        while (!logFile.atEnd()) {
+            // Read Record
+            QString record = QString::fromUtf8(logFile.readLine());
+
+            // Check Record
+            if (record.endsWith('\n')) {
+                // Chop New Line
+                record.chop(1);
+            } else {
+                // Set Torn - Record Is Ignored
+                torn = true;
+                continue;
+            }
+
+            // Inc Log Records
+            logRecords++;
+
+            // Get Record Type
+            QString recordType = record.section('\t', 0, 0);
+
+            // Check Record Type
+            if (recordType == QString("v")) {
+                // Get Dir Path
+                QString dirPath = record.section('\t', 2);
+                // Set Item
+                setItem(dirPath, items.value(dirPath).rank + 1.0, record.section('\t', 1, 1).toLongLong());
+
+            } else if (recordType == QString("e")) {
+                // Set Item
+                setItem(record.section('\t', 3), record.section('\t', 2, 2).toDouble(), record.section('\t', 1, 1).toLongLong());
+
+            } else if (recordType == QString("d")) {
+                // Get Dir Path
+                QString dirPath = record.section('\t', 1);
+                // Update Total Rank
+                totalRank -= items.value(dirPath).rank;
+                // Remove Item
+                items.remove(dirPath);
+
+            } else if (recordType == QString("c")) {
+                // Clear Items
+                items.clear();
+                // Reset Total Rank
+                totalRank = 0.0;
+            }
+        }
+
+        // Close Log File
+        logFile.close();
+    }
+
+    qDebug() << "DirFrecencyDB::load - items: " << items.count() << " - logRecords: " << logRecords;
+
+    // Check Log Records
+    if (torn || logRecords > items.count() * 2 + DEFAULT_DIR_FRECENCY_COMPACT_SLACK) {
+        // Compact
+        compact();
+    } else {
+        // Open Log File For Appending
+        if (!logFile.open(QIODevice::WriteOnly | QIODevice::Append)) {
+            qWarning() << "DirFrecencyDB::load - ERROR OPENING LOG FILE!!";
+        }
+    }
+}
+
+//==============================================================================
+// Compact - Rewrites The Log With One Record Per Dir
+//==============================================================================
+void DirFrecencyDB::compact()
+{
+    qDebug() << "DirFrecencyDB::compact - items: " << items.count() << " - logRecords: " << logRecords;
+
+    // Close Log File
+    logFile.close();
+
+    // Init Compacted File - Written Atomically
+    QSaveFile compactedFile(dbFilePath());
+
+    // Open Compacted File
+    if (compactedFile.open(QIODevice::WriteOnly)) {
+        // Init Records
+        QByteArray records;
+
+        // Go Thru Items
+        foreach (const DirFrecencyItem& item, items) {
+            // Add Entry Record
+            records += QString("e\t%1\t%2\t%3\n").arg(item.lastVisit).arg(item.rank, 0, 'f', 3).arg(item.dirPath).toUtf8();
+        }
+
+        // Write Records
+        compactedFile.write(records);
+
+        // Commit
+        if (compactedFile.commit()) {
+            // Reset Log Records
+            logRecords = items.count();
+        }
+    } else {
+        qWarning() << "DirFrecencyDB::compact - ERROR OPENING FILE!!";
+    }
+
+    // Reopen Log File For Appending
+    if (!logFile.open(QIODevice::WriteOnly | QIODevice::Append)) {
+        qWarning() << "DirFrecencyDB::compact - ERROR OPENING LOG FILE!!";
+    }
+}
+
+//==============================================================================
+// Append Log Record
+//==============================================================================
+void DirFrecencyDB::appendRecord(const QString& aRecord)
+{
+    // Check Log File
+    if (logFile.isOpen()) {
+        // Write Record
+        logFile.write(QString(aRecord + "\n").toUtf8());
+        // Flush Log File
+        logFile.flush();
+    }
+
+    // Inc Log Records
+    logRecords++;
+
+    // Check Log Records
+    if (logRecords > items.count() * 2 + DEFAULT_DIR_FRECENCY_COMPACT_SLACK) {
+        // Compact
+        compact();
+    }
+}
+
+//==============================================================================
+// Set Item
+//==============================================================================
+void DirFrecencyDB::setItem(const QString& aDirPath, const double& aRank, const qint64& aLastVisit)
+{
+    // Check Dir Path
+    if (aDirPath.isEmpty()) {
+        return;
+    }
+
+    // Find Item
+    QHash<QString, DirFrecencyItem>::iterator it = items.find(aDirPath);
+
+    // Check Item
+    if (it != items.end()) {
+        // Update Total Rank
+        totalRank += aRank - it.value().rank;
+        // Update Rank
+        it.value().rank = aRank;
+        // Update Last Visit
+        it.value().lastVisit = aLastVisit;
+    } else {
+        // Update Total Rank
+        totalRank += aRank;
+        // Insert Item - Match Data Is Built Once Here
+        items.insert(aDirPath, DirFrecencyItem(aDirPath, aRank, aLastVisit));
+    }
+}
+
+//==============================================================================
+// Age Ranks
+//==============================================================================
+void DirFrecencyDB::age()
+{
+    qDebug() << "DirFrecencyDB::age - totalRank: " << totalRank;
+
+    // Reset Total Rank
+    totalRank = 0.0;
+
+    // Init Iterator
+    QHash<QString, DirFrecencyItem>::iterator it = items.begin();
+
+    // Go Thru Items
+    while (it != items.end()) {
+        // Age Rank
+        it.value().rank *= DEFAULT_DIR_FRECENCY_AGING;
+
+        // Check Rank
+        if (it.value().rank < DEFAULT_DIR_FRECENCY_MIN_RANK) {
+            // Forget Item
+            it = items.erase(it);
+        } else {
+            // Update Total Rank
+            totalRank += it.value().rank;
+            // Next Item
+            ++it;
+        }
+    }
+
+    // Compact - Aged Ranks Are Only Recorded By Compaction
+    compact();
+}
+
+//==============================================================================
+// Add Visit
+//==============================================================================
+void DirFrecencyDB::addVisit(const QString& aDirPath)
+{
+    // Get Dir Path
+    QString dirPath = dirFrecencyPath(aDirPath);
+
+    // Check Dir Path - Records Are Line Based
+    if (dirPath.isEmpty() || dirPath.contains('\n')) {
+        return;
+    }
+
+    // Get Now
+    qint64 now = dirFrecencyNow();
+
+    // Set Item
+    setItem(dirPath, items.value(dirPath).rank + 1.0, now);
+    // Append Visit Record
+    appendRecord(QString("v\t%1\t%2").arg(now).arg(dirPath));
+
+    // Check Total Rank
+    if (totalRank > DEFAULT_DIR_FRECENCY_MAX_RANK) {
+        // Age Ranks
+        age();
+    }
+}
+
+//==============================================================================
+// Remove Dir
+//==============================================================================
+void DirFrecencyDB::remove(const QString& aDirPath)
+{
+    // Get Dir Path
+    QString dirPath = dirFrecencyPath(aDirPath);
+
+    // Check Item
+    if (!items.contains(dirPath)) {
+        return;
+    }
+
+    qDebug() << "DirFrecencyDB::remove - aDirPath: " << aDirPath;
+
+    // Update Total Rank
+    totalRank -= items.value(dirPath).rank;
+    // Remove Item
+    items.remove(dirPath);
+    // Append Delete Record
+    appendRecord(QString("d\t%1").arg(dirPath));
+}
+
+//==============================================================================
+// Clear
+//==============================================================================
+void DirFrecencyDB::clear()
+{
+    qDebug() << "DirFrecencyDB::clear";
+
+    // Clear Items
+    items.clear();
+    // Reset Total Rank
+    totalRank = 0.0;
+    // Compact - Leaves An Empty Log
+    compact();
+}
+
+//==============================================================================
+// Get Count
+//==============================================================================
+int DirFrecencyDB::count()
+{
+    return items.count();
+}
+
+//==============================================================================
+// Match Item
+//==============================================================================
+double DirFrecencyDB::matchItem(const DirFrecencyItem& aItem, const QStringList& aKeywords)
+{
+    // Get Keywords Count
+    int kCount = aKeywords.count();
+
+    // Check Keywords Count
+    if (kCount <= 0) {
+        return DIR_FRECENCY_MATCH_FUZZY_WEIGHT;
+    }
+
+    // Init Substring Match
+    bool substringMatch = true;
+    // Init Position
+    int pos = 0;
+
+    // Go Thru Keywords - In Order, As Substrings
+    for (int i = 0; i < kCount && substringMatch; ++i) {
+        // Find Keyword
+        int kPos = aItem.lowerPath.indexOf(aKeywords[i], pos);
+
+        // Check Keyword Position
+        if (kPos < 0) {
+            // Reset Substring Match
+            substringMatch = false;
+        } else {
+            // Set Position
+            pos = kPos + aKeywords[i].length();
+        }
+    }
+
+    // Check Substring Match
+    if (substringMatch) {
+        // Check Last Keyword In Last Path Component
+        if (aItem.lowerPath.indexOf(aKeywords.last(), qMax(aItem.nameStart, pos - aKeywords.last().length())) >= 0) {
+            return DIR_FRECENCY_MATCH_NAME_WEIGHT;
+        }
+
+        return DIR_FRECENCY_MATCH_WORD_WEIGHT;
+    }
+
+    // Get Path Length
+    int pLength = aItem.lowerPath.length();
+    // Reset Position
+    pos = 0;
+
+    // Go Thru Keywords - In Order, As Subsequences
+    for (int i = 0; i < kCount; ++i) {
+        // Get Keyword Length
+        int kLength = aKeywords[i].length();
+
+        // Go Thru Keyword Chars
+        for (int j = 0; j < kLength; ++j) {
+            // Find Char
+            while (pos < pLength && aItem.lowerPath[pos] != aKeywords[i][j]) {
+                // Inc Position
+                pos++;
+            }
+
+            // Check Position
+            if (pos >= pLength) {
+                return 0.0;
+            }
+
+            // Inc Position
+            pos++;
+        }
+    }
+
+    return DIR_FRECENCY_MATCH_FUZZY_WEIGHT;
+}
+
+//==============================================================================
+// Query
+//==============================================================================
+QStringList DirFrecencyDB::query(const QString& aQuery, const int& aMaxResults)
+{
+    // Get Lower Query
+    QString lowerQuery = aQuery.toLower();
+    // Get Keywords
+    QStringList keywords = lowerQuery.split(' ', QString::SkipEmptyParts);
+    // Get Query Mask
+    quint64 queryMask = charMask(lowerQuery);
+    // Get Now
+    qint64 now = dirFrecencyNow();
+
+    // Init Candidates
+    QVector<QPair<double, const DirFrecencyItem*> > candidates;
+
+    // Reserve Candidates
+    candidates.reserve(items.count());
+
+    // Go Thru Items
+    QHash<QString, DirFrecencyItem>::const_iterator it = items.constBegin();
+    while (it != items.constEnd()) {
+        // Get Item
+        const DirFrecencyItem& item = it.value();
+
+        // Check Char Mask - Most Items Are Rejected Here
+        if ((item.charMask & queryMask) == queryMask) {
+            // Match Item
+            double weight = matchItem(item, keywords);
+
+            // Check Weight
+            if (weight > 0.0) {
+                // Add Candidate
+                candidates << qMakePair(item.score(now) * weight, &item);
+            }
+        }
+
+        // Next Item
+        ++it;
+    }
+
+    // Get Results Count
+    int rCount = qMin(aMaxResults, candidates.count());
+
+    // Sort Best Candidates Only
+    std::partial_sort(candidates.begin(), candidates.begin() + rCount, candidates.end(), dirFrecencyCandidateLessThan);
+
+    // Init Results
+    QStringList results;
+
+    // Go Thru Best Candidates
+    for (int i = 0; i < rCount; ++i) {
+        // Add Result
+        results << candidates[i].second->dirPath;
+    }
+
+    return results;
+}
+
+//==============================================================================
+// Destructor
+//==============================================================================
+DirFrecencyDB::~DirFrecencyDB()
+{
+    // Close Log File
+    logFile.close();
+
+    // Clear Items
+    items.clear();
+}
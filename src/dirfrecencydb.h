@@ -0,0 +1,114 @@
+#ifndef DIRFRECENCYDB_H
+#define DIRFRECENCYDB_H
+
+#include <QString>
+#include <QStringList>
+#include <QHash>
+#include <QFile>
+
+
+//==============================================================================
+// Dir Frecency Item Class
+//==============================================================================
+class DirFrecencyItem
+{
+public:
+    // Constructor
+    explicit DirFrecencyItem(const QString& aDirPath = QString(""), const double& aRank = 0.0, const qint64& aLastVisit = 0);
+
+    // Get Score - Rank Weighted By How Recently The Dir Was Visited
+    double score(const qint64& aNow) const;
+
+    // Dir Path
+    QString         dirPath;
+    // Rank - Decayed Visit Count
+    double          rank;
+    // Last Visit - secs Since Epoch
+    qint64          lastVisit;
+
+    // Lower Case Path - Prebuilt For Matching
+    QString         lowerPath;
+    // Last Component Start In Lower Case Path
+    int             nameStart;
+    // Char Mask - Rejects Items Missing Query Chars Without Scanning
+    quint64         charMask;
+};
+
+
+
+
+//==============================================================================
+// Dir Frecency DB Class - Shared Visited Dirs, Append Only Log On Disk
+//==============================================================================
+class DirFrecencyDB
+{
+public:
+
+    // Get Instance - Static Constructor
+    static DirFrecencyDB* getInstance();
+
+    // Release
+    void release();
+
+    // Add Visit
+    void addVisit(const QString& aDirPath);
+    // Remove Dir
+    void remove(const QString& aDirPath);
+    // Clear
+    void clear();
+
+    // Get Count
+    int count();
+
+    // Query - Keywords Separated By Space, Matched In Order, Best First
+    QStringList query(const QString& aQuery, const int& aMaxResults);
+
+    // Get Char Mask
+    static quint64 charMask(const QString& aText);
+
+protected: // Constructor/Destructor
+
+    // Constructor
+    explicit DirFrecencyDB();
+
+    // Destructor
+    virtual ~DirFrecencyDB();
+
+protected:
+
+    // Get DB File Path
+    QString dbFilePath();
+
+    // Load - Replays The Log
+    void load();
+    // Compact - Rewrites The Log With One Record Per Dir
+    void compact();
+    // Append Log Record
+    void appendRecord(const QString& aRecord);
+
+    // Age Ranks - Keeps Total Rank Bounded, Forgets Rarely Visited Dirs
+    void age();
+
+    // Set Item
+    void setItem(const QString& aDirPath, const double& aRank, const qint64& aLastVisit);
+
+    // Match Item - Returns Match Weight, 0 If No Match
+    static double matchItem(const DirFrecencyItem& aItem, const QStringList& aKeywords);
+
+protected:
+
+    // Int Ref Counter
+    int                                 refCount;
+
+    // Items By Dir Path
+    QHash<QString, DirFrecencyItem>     items;
+    // Total Rank
+    double                              totalRank;
+
+    // Log File - Kept Open For Appending
+    QFile                               logFile;
+    // Log Records
+    int                                 logRecords;
+};
+
+#endif // DIRFRECENCYDB_H
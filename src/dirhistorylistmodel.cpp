@@ -4,6 +4,7 @@
 #include <QTextStream>
 
 #include "dirhistorylistmodel.h"
+#include "dirfrecencydb.h"
 #include "constants.h"
 
 //==============================================================================
@@ -12,6 +13,7 @@
 DirHistoryListModel::DirHistoryListModel(const QString& aPanelName, QObject* aParent)
     : QAbstractListModel(aParent)
     , panelName(aPanelName)
+    , frecencyDB(DirFrecencyDB::getInstance())
 {
     // Init
     init();
@@ -22,78 +24,73 @@ DirHistoryListModel::DirHistoryListModel(const QString& aPanelName, QObject* aPa
 //==============================================================================
 void DirHistoryListModel::init()
 {
-    // Load History
-    loadHistory();
+    // Import History
+    importHistory();
+    // Refresh Items
+    refresh();
 }
 
 //==============================================================================
-// Load History
+// Import History
 //==============================================================================
-void DirHistoryListModel::loadHistory()
+void DirHistoryListModel::importHistory()
 {
-    // Clear Items
-    clear();
-
-    qDebug() << "DirHistoryListModel::loadHistory";
-
     // Init Dir History List File
     QFile dhlFile(QDir::homePath() + "/" + QString(DEFAULT_FILE_LIST_DIR_HSITORY_FILENAME).arg(panelName));
 
     // Open File
     if (dhlFile.open(QIODevice::ReadOnly)) {
+        qDebug() << "DirHistoryListModel::importHistory - panelName: " << panelName;
+
         // Init Text Stream
         QTextStream dhlStream(&dhlFile);
-
-        // Begin Reset Model
-        beginResetModel();
+        // Init Lines
+        QStringList lines;
 
         // Go Thru Item List
         while (!dhlStream.atEnd()) {
             // Read Line
-            QString line = dhlStream.readLine();
-            // Append To List
-            items << line;
+            lines << dhlStream.readLine();
         }
 
-        // End Reset Model
-        endResetModel();
-
         // Close File
         dhlFile.close();
+
+        // Go Thru Lines - Oldest First
+        for (int i = lines.count() - 1; i >= 0; --i) {
+            // Add Visit
+            frecencyDB->addVisit(lines[i]);
+        }
+
+        // Remove File - Imported
+        dhlFile.remove();
     }
 }
 
 //==============================================================================
-// Save History
+// Refresh Items
 //==============================================================================
-void DirHistoryListModel::saveHistory()
+void DirHistoryListModel::refresh()
 {
-    qDebug() << "DirHistoryListModel::saveHistory";
-
-    // Init Dir History List File
-    QFile dhlFile(QDir::homePath() + "/" + QString(DEFAULT_FILE_LIST_DIR_HSITORY_FILENAME).arg(panelName));
-
-    // Open File
-    if (dhlFile.open(QIODevice::WriteOnly)) {
-        // Init Text Stream
-        QTextStream dhlStream(&dhlFile);
+    // Begin Reset Model
+    beginResetModel();
+    // Query Items
+    items = frecencyDB->query(filter, DEFAULT_DIR_HISTORY_LIST_ITEMS_MAX);
+    // End Reset Model
+    endResetModel();
+}
 
-        // Get Items Count
-        int dhlCount = items.count();
-
-        // Go Thru File Search Patterns
-        for (int i=0; i<dhlCount; ++i) {
-            // Get Item Text
-            QString itemText = items[i];
-            // Write Item
-            dhlStream << itemText;
-            // Write New Line
-            dhlStream << "\n";
-        }
+//==============================================================================
+// Set Filter
+//==============================================================================
+void DirHistoryListModel::setFilter(const QString& aFilter)
+{
+    //qDebug() << "DirHistoryListModel::setFilter - aFilter: " << aFilter;
 
-        // Close File
-        dhlFile.close();
-    }
+    // Set Filter
+    filter = aFilter;
+    // Refresh Items
+    refresh();
 }
 
 //==============================================================================
@@ -101,10 +98,13 @@ void DirHistoryListModel::saveHistory()
 //==============================================================================
 void DirHistoryListModel::clear()
 {
+    qDebug() << "DirHistoryListModel::clear";
+
+    // Clear Frecency DB
+    frecencyDB->clear();
+
     // Check Items Count
     if (items.count() > 0) {
-        qDebug() << "DirHistoryListModel::clear";
-
         // Begin Reset Model
         beginResetModel();
         // Clear Items
@@ -121,42 +121,21 @@ void DirHistoryListModel::addNewHistoryItem(const QString& aDirPath)
 {
     qDebug() << "DirHistoryListModel::addNewHistoryItem - aDirPath: " << aDirPath;
 
+    // Add Visit - Items Are Refreshed When The Popup Sets Its Filter
+    frecencyDB->addVisit(aDirPath);
+}
 
-    // Init Local Dir Path
-    QString localDirPath = aDirPath;
-    // Check Local Dir Path
-    if (localDirPath != QString("/") && localDirPath.endsWith("/")) {
-        // Truncate
-        localDirPath.truncate(localDirPath.length() - 1);
-    }
-
-    // Get Index Of Item
-    int itemIndex = items.indexOf(aDirPath);
-
-    // Check Item Index
-    if (itemIndex >= 0) {
-        // Begin Item REmoval
-        beginRemoveRows(QModelIndex(), itemIndex, itemIndex);
-        // Remove Previous Occurence
-        items.removeAt(itemIndex);
-        // End Remove Rows
-        endRemoveRows();
-    }
-
-    // Begin Insert Rows
-    beginInsertRows(QModelIndex(), 0, 0);
-    // Insert New Item
-    items.insert(0, localDirPath);
-    // End Insert Rows
-    endInsertRows();
-
-    // ...
+//==============================================================================
+// Remove History Item
+//==============================================================================
+void DirHistoryListModel::removeHistoryItem(const QString& aDirPath)
+{
+    qDebug() << "DirHistoryListModel::removeHistoryItem - aDirPath: " << aDirPath;
 
-    // Clear Old Items
-    while (items.count() > DEFAULT_DIR_HISTORY_LIST_ITEMS_MAX) {
-        // Remove Last
-        items.removeLast();
-    }
+    // Remove Dir
+    frecencyDB->remove(aDirPath);
+    // Refresh Items
+    refresh();
 }
 
 //==============================================================================
@@ -243,11 +222,12 @@ bool DirHistoryListModel::setData(const QModelIndex& aIndex, const QVariant& aVa
 //==============================================================================
 DirHistoryListModel::~DirHistoryListModel()
 {
-    // Save History
-    saveHistory();
+    // Clear Items
+    items.clear();
 
-    // CLear
-    clear();
+    // Release Frecency DB
+    frecencyDB->release();
+    frecencyDB = NULL;
 
     // ...
 }
@@ -4,6 +4,8 @@
 #include <QAbstractListModel>
 #include <QStringList>
 
+class DirFrecencyDB;
+
 
 //==============================================================================
 // Dir History List Model Class
@@ -17,6 +19,11 @@ public:
 
     // Add New History Item
     void addNewHistoryItem(const QString& aDirPath);
+    // Remove History Item
+    void removeHistoryItem(const QString& aDirPath);
+
+    // Set Filter - Refreshes Items From The Frecency DB
+    void setFilter(const QString& aFilter);
 
     // Get History Item
     QString getItem(const int& aIndex);
@@ -44,10 +51,10 @@ protected:
 
     // Init
     void init();
-    // Load History
-    void loadHistory();
-    // Save History
-    void saveHistory();
+    // Import History - Old Per Panel History File Is Merged Into The Frecency DB Once
+    void importHistory();
+    // Refresh Items
+    void refresh();
 
 protected:
 
@@ -61,7 +68,12 @@ protected:
     // Panel Name
     QString         panelName;
 
-    // Model Items
+    // Dir Frecency DB - Shared By Panels
+    DirFrecencyDB*  frecencyDB;
+    // Filter
+    QString         filter;
+
+    // Model Items - Best Matches Of The Filter
     QStringList     items;
 };
 
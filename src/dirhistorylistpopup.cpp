@@ -1,4 +1,5 @@
 #include <QDebug>
+#include <QDir>
 #include <QQmlEngine>
 #include <QQmlContext>
 
@@ -15,6 +16,7 @@ DirHistoryListPopup::DirHistoryListPopup(DirHistoryListModel* aModel, QWidget* a
     , ui(new Ui::DirHistoryListPopup)
     , historyModel(aModel)
     , currentIndex(-1)
+    , filterText("")
 {
     // Setup UI
     ui->setupUi(this);
@@ -48,6 +50,17 @@ DirHistoryListPopup::DirHistoryListPopup(DirHistoryListModel* aModel, QWidget* a
 //==============================================================================
 void DirHistoryListPopup::launchPopup(const QPoint& aPos, const int& aWidth)
 {
+    // Reset Filter Text
+    filterText = "";
+    // Emit Filter Text Changed
+    emit filterTextChanged(filterText);
+
+    // Check History Model
+    if (historyModel) {
+        // Reset Filter - Picks Up Visits Made Since The Last Launch
+        historyModel->setFilter(filterText);
+    }
+
     // Get Item Count
     int hmCount = historyModel ? historyModel->rowCount() + 1 : 0;
     // Calculate Popup Height
@@ -95,6 +108,35 @@ void DirHistoryListPopup::setCurrentIndex(const int& aCurrentIndex)
     }
 }
 
+//==============================================================================
+// Get Filter Text
+//==============================================================================
+QString DirHistoryListPopup::getFilterText()
+{
+    return filterText;
+}
+
+//==============================================================================
+// Set Filter Text
+//==============================================================================
+void DirHistoryListPopup::setFilterText(const QString& aFilterText)
+{
+    // Check Filter Text
+    if (filterText != aFilterText) {
+        // Set Filter Text
+        filterText = aFilterText;
+
+        // Check History Model
+        if (historyModel) {
+            // Set Filter
+            historyModel->setFilter(filterText);
+        }
+
+        // Emit Signal
+        emit filterTextChanged(filterText);
+    }
+}
+
 //==============================================================================
 // Dir History List Item Selected
 //==============================================================================
@@ -104,8 +146,17 @@ void DirHistoryListPopup::dirHistoryListItemSelected(const int& aIndex)
 
     // Check Index
     if (historyModel) {
-        // Emit
-        emit dirHistoryItemSelected(historyModel->getItem(aIndex));
+        // Get Dir Path
+        QString dirPath = historyModel->getItem(aIndex);
+
+        // Check Dir Path - Dirs Removed Since The Visit Are Forgotten
+        if (!dirPath.isEmpty() && !QDir(dirPath).exists()) {
+            // Remove History Item
+            historyModel->removeHistoryItem(dirPath);
+        } else {
+            // Emit
+            emit dirHistoryItemSelected(dirPath);
+        }
     }
 
     // Close
@@ -171,8 +222,14 @@ void DirHistoryListPopup::keyReleaseEvent(QKeyEvent* aEvent)
         // Switch Key
         switch (aEvent->key()) {
             case Qt::Key_Escape:
-                // Close
-                close();
+                // Check Filter Text
+                if (!filterText.isEmpty()) {
+                    // Clear Filter Text
+                    setFilterText("");
+                } else {
+                    // Close
+                    close();
+                }
             break;
 
             case Qt::Key_Enter:
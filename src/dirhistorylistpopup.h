@@ -18,6 +18,7 @@ class DirHistoryListPopup : public QWidget
     Q_OBJECT
 
     Q_PROPERTY(int currentIndex READ getCurrentIndex WRITE setCurrentIndex NOTIFY currentIndexChanged)
+    Q_PROPERTY(QString filterText READ getFilterText WRITE setFilterText NOTIFY filterTextChanged)
 
 public:
 
@@ -34,6 +35,11 @@ public:
     // Set Current Index
     void setCurrentIndex(const int& aCurrentIndex);
 
+    // Get Filter Text
+    QString getFilterText();
+    // Set Filter Text
+    void setFilterText(const QString& aFilterText);
+
     // Destructor
     virtual ~DirHistoryListPopup();
 
@@ -46,6 +52,8 @@ signals:
 
     void currentIndexChanged(const int& aCurrentIndex);
 
+    void filterTextChanged(const QString& aFilterText);
+
 public slots:
 
     // Dir History List Item Selected
@@ -74,6 +82,8 @@ private:
 
     // Current Index
     int                         currentIndex;
+    // Filter Text
+    QString                     filterText;
 };
 
 
@@ -0,0 +1,745 @@
+#include <QDir>
+#include <QFile>
+#include <QSaveFile>
+#include <QDataStream>
+#include <QSet>
+#include <QPair>
+#include <QMutexLocker>
+#include <QTimerEvent>
+#include <QDebug>
+
+#include <algorithm>
+
+#include "dirsizeindex.h"
+#include "constants.h"
+
+
+// Dir Size Index Singleton
+static DirSizeIndex* dirSizeIndexSingleton = NULL;
+// Singleton Mutex
+static QMutex dirSizeIndexMutex;
+
+// Index File Magic
+#define DIR_SIZE_INDEX_MAGIC        0x4d434455
+// Index File Version
+#define DIR_SIZE_INDEX_VERSION      1
+
+
+//==============================================================================
+// Get Path Depth
+//==============================================================================
+static int pathDepth(const QString& aDirPath)
+{
+    return aDirPath == QString("/") ? 0 : aDirPath.count('/');
+}
+
+
+//==============================================================================
+// Constructor
+//==============================================================================
+DirSizeIndexItem::DirSizeIndexItem(const quint64& aSize, const quint64& aNumDirs, const quint64& aNumFiles, const qint64& aModified)
+    : size(aSize)
+    , numDirs(aNumDirs)
+    , numFiles(aNumFiles)
+    , modified(aModified)
+    , dirty(false)
+{
+}
+
+
+
+
+
+
+
+//==============================================================================
+// Constructor
+//==============================================================================
+DirSizeScanRecord::DirSizeScanRecord(const QString& aDirPath, const DirSizeIndexItem& aItem, const bool& aReused)
+    : dirPath(aDirPath)
+    , item(aItem)
+    , reused(aReused)
+{
+}
+
+
+
+
+
+
+
+//==============================================================================
+// Get Instance - Static Constructor
+//==============================================================================
+DirSizeIndex* DirSizeIndex::getInstance()
+{
+    QMutexLocker locker(&dirSizeIndexMutex);
+
+    // Check Singleton
+    if (!dirSizeIndexSingleton) {
+        // Create Singleton
+        dirSizeIndexSingleton = new DirSizeIndex();
+    } else {
+        // Inc Ref Count
+        dirSizeIndexSingleton->refCount++;
+    }
+
+    return dirSizeIndexSingleton;
+}
+
+//==============================================================================
+// Constructor
+//==============================================================================
+DirSizeIndex::DirSizeIndex(QObject* aParent)
+    : QObject(aParent)
+    , refCount(1)
+    , modified(false)
+    , saveTimerID(-1)
+{
+    qDebug() << "DirSizeIndex::DirSizeIndex";
+
+    // Load Index
+    load();
+}
+
+//==============================================================================
+// Release
+//==============================================================================
+void DirSizeIndex::release()
+{
+    QMutexLocker locker(&dirSizeIndexMutex);
+
+    // Dec Ref Count
+    refCount--;
+
+    // Check Ref Count
+    if (refCount <= 0 && dirSizeIndexSingleton) {
+        // Delete Singleton
+        delete dirSizeIndexSingleton;
+        dirSizeIndexSingleton = NULL;
+    }
+}
+
+//==============================================================================
+// Lookup
+//==============================================================================
+bool DirSizeIndex::lookup(const QString& aDirPath, const qint64& aModified, DirSizeIndexItem& aItem)
+{
+    QMutexLocker locker(&indexMutex);
+
+    // Find Item
+    QHash<QString, DirSizeIndexItem>::const_iterator it = items.constFind(aDirPath);
+
+    // Check Item
+    if (it == items.constEnd() || it.value().dirty || it.value().modified != aModified) {
+        return false;
+    }
+
+    // Set Item
+    aItem = it.value();
+
+    return true;
+}
+
+//==============================================================================
+// Check If Dir Is Indexed
+//==============================================================================
+bool DirSizeIndex::contains(const QString& aDirPath)
+{
+    QMutexLocker locker(&indexMutex);
+
+    return items.contains(aDirPath);
+}
+
+//==============================================================================
+// Store Scan
+//==============================================================================
+void DirSizeIndex::storeScan(const QString& aRootPath, const QList<DirSizeScanRecord>& aRecords)
+{
+    // Init Scanned Items
+    QHash<QString, DirSizeIndexItem> scanned;
+    // Init Read Dirs - Their Sub Dir Lists Are Complete
+    QSet<QString> readDirs;
+    // Init Sorted Paths
+    QList<QPair<int, QString> > sortedPaths;
+
+    // Get Records Count
+    int rCount = aRecords.count();
+
+    // Reserve
+    scanned.reserve(rCount);
+    sortedPaths.reserve(rCount);
+
+    // Go Thru Records
+    for (int i = 0; i < rCount; ++i) {
+        // Get Record
+        const DirSizeScanRecord& record = aRecords[i];
+        // Add Scanned Item
+        scanned[record.dirPath] = record.item;
+        // Add Sorted Path
+        sortedPaths << qMakePair(pathDepth(record.dirPath), record.dirPath);
+
+        // Check If Reused
+        if (!record.reused) {
+            // Add Read Dir
+            readDirs << record.dirPath;
+        }
+    }
+
+    // Sort Paths - Deepest Last
+    std::sort(sortedPaths.begin(), sortedPaths.end());
+
+    // Go Thru Sorted Paths Deepest First - Children Are Complete Before Their Parent Is Added Up
+    for (int i = sortedPaths.count() - 1; i >= 0; --i) {
+        // Get Path
+        const QString& path = sortedPaths[i].second;
+
+        // Check Root
+        if (path == aRootPath) {
+            continue;
+        }
+
+        // Get Item
+        DirSizeIndexItem item = scanned.value(path);
+        // Find Parent Item
+        QHash<QString, DirSizeIndexItem>::iterator parent = scanned.find(parentPath(path));
+
+        // Check Parent Item
+        if (parent != scanned.end()) {
+            // Add To Parent
+            parent.value().size += item.size;
+            parent.value().numDirs += item.numDirs;
+            parent.value().numFiles += item.numFiles;
+        }
+    }
+
+    // Check Root Item
+    if (!scanned.contains(aRootPath)) {
+        return;
+    }
+
+    QMutexLocker locker(&indexMutex);
+
+    // Get Old Root Item
+    DirSizeIndexItem oldRoot = items.value(aRootPath);
+    // Get Old Root Valid
+    bool oldValid = items.contains(aRootPath) && !oldRoot.dirty;
+
+    // Init Stale Dirs
+    QStringList staleDirs;
+
+    // Go Thru Read Dirs - Only Their Indexed Child Dirs Can Be Gone Since Last Scan
+    foreach (const QString& readDir, readDirs) {
+        // Find Child Dirs
+        QHash<QString, QSet<QString> >::const_iterator cit = childDirs.constFind(readDir);
+
+        // Check Child Dirs
+        if (cit == childDirs.constEnd()) {
+            continue;
+        }
+
+        // Go Thru Child Dirs
+        foreach (const QString& childDir, cit.value()) {
+            // Check If Child Dir Is Gone
+            if (!scanned.contains(childDir)) {
+                // Add Stale Dir
+                staleDirs << childDir;
+            }
+        }
+    }
+
+    // Init Removed Count
+    int removed = 0;
+
+    // Go Thru Stale Dirs
+    foreach (const QString& staleDir, staleDirs) {
+        // Remove Stale Dir And Its Sub Dirs
+        removed += removeTree(staleDir);
+    }
+
+    // Go Thru Scanned Items
+    QHash<QString, DirSizeIndexItem>::const_iterator nit = scanned.constBegin();
+    while (nit != scanned.constEnd()) {
+        // Store Item
+        insertItem(nit.key(), nit.value());
+        ++nit;
+    }
+
+    // Update Ancestors
+    updateAncestors(aRootPath, oldRoot, scanned[aRootPath], oldValid);
+
+    // Trim Index
+    trim();
+
+    qDebug() << "DirSizeIndex::storeScan - aRootPath: " << aRootPath << " - records: " << rCount <<  - removed: " << removed << " - items: " << items.count();
+
+    // Schedule Save
+    scheduleSave();
+}
+
+//==============================================================================
+// Invalidate
+//==============================================================================
+void DirSizeIndex::invalidate(const QString& aDirPath)
+{
+    QMutexLocker locker(&indexMutex);
+
+    // Init Path
+    QString path = aDirPath;
+    // Init Changed
+    bool changed = false;
+
+    // Go Thru Path And Its Ancestors
+    while (!path.isEmpty()) {
+        // Find Item
+        QHash<QString, DirSizeIndexItem>::iterator it = items.find(path);
+
+        // Check Item
+        if (it != items.end() && !it.value().dirty) {
+            // Set Dirty
+            it.value().dirty = true;
+            // Set Changed
+            changed = true;
+        }
+
+        // Get Parent Path
+        QString parent = parentPath(path);
+
+        // Check Parent Path
+        if (parent == path) {
+            break;
+        }
+
+        // Set Path
+        path = parent;
+    }
+
+    // Check Changed
+    if (changed) {
+        //qDebug() << "DirSizeIndex::invalidate - aDirPath: " << aDirPath;
+
+        // Schedule Save
+        scheduleSave();
+    }
+}
+
+//==============================================================================
+// Remove Dir And All Indexed Sub Dirs
+//==============================================================================
+void DirSizeIndex::remove(const QString& aDirPath)
+{
+    QMutexLocker locker(&indexMutex);
+
+    // Init Path
+    QString path = aDirPath;
+
+    // Check Path - Index Keys Have No Trailing Separator
+    if (path.length() > 1 && path.endsWith("/")) {
+        // Adjust Path
+        path.chop(1);
+    }
+
+    // Remove Dir And Its Sub Dirs
+    removeTree(path);
+
+    // Schedule Save
+    scheduleSave();
+}
+
+//==============================================================================
+// Clear Index
+//==============================================================================
+void DirSizeIndex::clear()
+{
+    QMutexLocker locker(&indexMutex);
+
+    // Clear Items
+    items.clear();
+    // Clear Child Dirs
+    childDirs.clear();
+
+    // Schedule Save
+    scheduleSave();
+}
+
+//==============================================================================
+// Load Index
+//==============================================================================
+void DirSizeIndex::load()
+{
+    // Init Index File
+    QFile indexFile(indexFilePath());
+
+    // Open File
+    if (!indexFile.open(QIODevice::ReadOnly)) {
+        return;
+    }
+
+    // Init Data Stream
+    QDataStream indexStream(&indexFile);
+
+    // Init Magic
+    quint32 magic = 0;
+    // Init Version
+    quint32 version = 0;
+    // Init Count
+    quint32 count = 0;
+
+    // Read Header
+    indexStream >> magic >> version >> count;
+
+    // Check Header
+    if (magic != DIR_SIZE_INDEX_MAGIC || version != DIR_SIZE_INDEX_VERSION) {
+        qWarning() << "DirSizeIndex::load - INVALID INDEX FILE!!";
+
+        return;
+    }
+
+    QMutexLocker locker(&indexMutex);
+
+    // Reserve Items
+    items.reserve(count);
+
+    // Go Thru Items
+    for (quint32 i = 0; i < count && indexStream.status() == QDataStream::Ok; ++i) {
+        // Init Path
+        QString path;
+        // Init Item
+        DirSizeIndexItem item;
+
+        // Read Item
+        indexStream >> path >> item.size >> item.numDirs >> item.numFiles >> item.modified >> item.dirty;
+
+        // Check Stream Status
+        if (indexStream.status() == QDataStream::Ok) {
+            // Add Item
+            insertItem(path, item);
+        }
+    }
+
+    // Close File
+    indexFile.close();
+
+    qDebug() << "DirSizeIndex::load - items: " << items.count();
+}
+
+//==============================================================================
+// Save Index
+//==============================================================================
+void DirSizeIndex::save()
+{
+    // Init Items Snapshot
+    QHash<QString, DirSizeIndexItem> snapshot;
+
+    {
+        QMutexLocker locker(&indexMutex);
+
+        // Check Modified
+        if (!modified) {
+            return;
+        }
+
+        // Get Snapshot - Implicitly Shared
+        snapshot = items;
+        // Reset Modified
+        modified = false;
+    }
+
+    qDebug() << "DirSizeIndex::save - items: " << snapshot.count();
+
+    // Init Index File - Written Atomically
+    QSaveFile indexFile(indexFilePath());
+
+    // Open File
+    if (!indexFile.open(QIODevice::WriteOnly)) {
+        qWarning() << "DirSizeIndex::save - ERROR OPENING INDEX FILE!!";
+
+        return;
+    }
+
+    // Init Data Stream
+    QDataStream indexStream(&indexFile);
+
+    // Write Header
+    indexStream << (quint32)DIR_SIZE_INDEX_MAGIC << (quint32)DIR_SIZE_INDEX_VERSION << (quint32)snapshot.count();
+
+    // Go Thru Items
+    QHash<QString, DirSizeIndexItem>::const_iterator it = snapshot.constBegin();
+    while (it != snapshot.constEnd()) {
+        // Get Item
+        const DirSizeIndexItem& item = it.value();
+        // Write Item
+        indexStream << it.key() << item.size << item.numDirs << item.numFiles << item.modified << item.dirty;
+        ++it;
+    }
+
+    // Commit File
+    indexFile.commit();
+}
+
+//==============================================================================
+// Schedule Save
+//==============================================================================
+void DirSizeIndex::scheduleSave()
+{
+    // Set Modified
+    modified = true;
+
+    // Check Save Timer ID
+    if (saveTimerID == -1) {
+        // Start Save Timer
+        saveTimerID = startTimer(DEFAULT_DIR_SIZE_INDEX_SAVE_DELAY);
+    }
+}
+
+//==============================================================================
+// Insert Item
+//==============================================================================
+void DirSizeIndex::insertItem(const QString& aDirPath, const DirSizeIndexItem& aItem)
+{
+    // Store Item
+    items[aDirPath] = aItem;
+
+    // Init Path
+    QString path = aDirPath;
+
+    // Go Thru Path And Its Ancestors - Stops At The First Node Already Linked
+    while (true) {
+        // Get Parent Path
+        QString parent = parentPath(path);
+
+        // Check Parent Path
+        if (parent == path) {
+            break;
+        }
+
+        // Find Parent Node
+        QHash<QString, QSet<QString> >::iterator it = childDirs.find(parent);
+
+        // Check Parent Node
+        if (it != childDirs.end()) {
+            // Add Child Dir
+            it.value().insert(path);
+
+            break;
+        }
+
+        // Add Parent Node
+        childDirs[parent].insert(path);
+
+        // Set Path
+        path = parent;
+    }
+}
+
+//==============================================================================
+// Remove Item And Its Indexed Sub Dirs
+//==============================================================================
+int DirSizeIndex::removeTree(const QString& aDirPath)
+{
+    // Init Removed Count
+    int removed = 0;
+    // Init Pending Dirs
+    QStringList pendingDirs;
+
+    // Add Dir
+    pendingDirs << aDirPath;
+
+    // Go Thru Pending Dirs - Only The Removed Sub Tree Is Visited
+    while (!pendingDirs.isEmpty()) {
+        // Get Path
+        QString path = pendingDirs.takeLast();
+
+        // Remove Item
+        removed += items.remove(path);
+
+        // Take Child Dirs
+        foreach (const QString& childDir, childDirs.take(path)) {
+            // Add Pending Dir
+            pendingDirs << childDir;
+        }
+    }
+
+    // Unlink Dir
+    unlinkDir(aDirPath);
+
+    return removed;
+}
+
+//==============================================================================
+// Unlink Dir From The Child Dirs Map
+//==============================================================================
+void DirSizeIndex::unlinkDir(const QString& aDirPath)
+{
+    // Init Path
+    QString path = aDirPath;
+
+    // Go Thru Path And Its Ancestors - Stops At The First Node Still In Use
+    while (!items.contains(path) && !childDirs.contains(path)) {
+        // Get Parent Path
+        QString parent = parentPath(path);
+
+        // Check Parent Path
+        if (parent == path) {
+            break;
+        }
+
+        // Find Parent Node
+        QHash<QString, QSet<QString> >::iterator it = childDirs.find(parent);
+
+        // Check Parent Node
+        if (it == childDirs.end()) {
+            break;
+        }
+
+        // Remove Child Dir
+        it.value().remove(path);
+
+        // Check Parent Node
+        if (!it.value().isEmpty()) {
+            break;
+        }
+
+        // Remove Parent Node
+        childDirs.erase(it);
+
+        // Set Path
+        path = parent;
+    }
+}
+
+//==============================================================================
+// Apply Size Delta To Indexed Ancestors
+//==============================================================================
+void DirSizeIndex::updateAncestors(const QString& aDirPath, const DirSizeIndexItem& aOldItem, const DirSizeIndexItem& aNewItem, const bool& aValid)
+{
+    // Get Parent Path
+    QString path = parentPath(aDirPath);
+
+    // Go Thru Ancestors
+    while (path != aDirPath) {
+        // Find Item
+        QHash<QString, DirSizeIndexItem>::iterator it = items.find(path);
+
+        // Check Item
+        if (it != items.end()) {
+            // Check If Delta Can Be Applied
+            if (aValid && !it.value().dirty) {
+                // Apply Delta - Unsigned Wrap Around Cancels Out
+                it.value().size += aNewItem.size - aOldItem.size;
+                it.value().numDirs += aNewItem.numDirs - aOldItem.numDirs;
+                it.value().numFiles += aNewItem.numFiles - aOldItem.numFiles;
+            } else {
+                // Set Dirty
+                it.value().dirty = true;
+            }
+        }
+
+        // Get Parent Path
+        QString parent = parentPath(path);
+
+        // Check Parent Path
+        if (parent == path) {
+            break;
+        }
+
+        // Set Path
+        path = parent;
+    }
+}
+
+//==============================================================================
+// Trim Index
+//==============================================================================
+void DirSizeIndex::trim()
+{
+    // Check Items Count
+    if (items.count() <= DEFAULT_DIR_SIZE_INDEX_MAX_ITEMS) {
+        return;
+    }
+
+    // Init Sorted Paths
+    QList<QPair<int, QString> > sortedPaths;
+    // Reserve
+    sortedPaths.reserve(items.count());
+
+    // Go Thru Items
+    QHash<QString, DirSizeIndexItem>::const_iterator it = items.constBegin();
+    while (it != items.constEnd()) {
+        // Add Sorted Path
+        sortedPaths << qMakePair(pathDepth(it.key()), it.key());
+        ++it;
+    }
+
+    // Sort Paths - Deepest Last
+    std::sort(sortedPaths.begin(), sortedPaths.end());
+
+    // Remove Deepest Items - Shallow Dirs Are The Ones Shown In Panels
+    while (items.count() > DEFAULT_DIR_SIZE_INDEX_MAX_ITEMS && !sortedPaths.isEmpty()) {
+        // Get Path
+        QString path = sortedPaths.takeLast().second;
+        // Remove Item
+        items.remove(path);
+        // Unlink Dir - Deeper Dirs Are Already Gone
+        unlinkDir(path);
+    }
+}
+
+//==============================================================================
+// Get Parent Path
+//==============================================================================
+QString DirSizeIndex::parentPath(const QString& aDirPath)
+{
+    // Get Last Separator Index
+    int lastSeparator = aDirPath.lastIndexOf('/');
+
+    // Check Last Separator Index
+    if (lastSeparator <= 0) {
+        return QString("/");
+    }
+
+    return aDirPath.left(lastSeparator);
+}
+
+//==============================================================================
+// Get Index File Path
+//==============================================================================
+QString DirSizeIndex::indexFilePath()
+{
+    return QDir::homePath() + "/" + DEFAULT_DIR_SIZE_INDEX_FILENAME;
+}
+
+//==============================================================================
+// Timer Event
+//==============================================================================
+void DirSizeIndex::timerEvent(QTimerEvent* aEvent)
+{
+    // Check Event
+    if (aEvent && aEvent->timerId() == saveTimerID) {
+        // Kill Save Timer
+        killTimer(saveTimerID);
+        // Reset Save Timer ID
+        saveTimerID = -1;
+
+        // Save Index
+        save();
+    }
+}
+
+//==============================================================================
+// Destructor
+//==============================================================================
+DirSizeIndex::~DirSizeIndex()
+{
+    // Check Save Timer ID
+    if (saveTimerID != -1) {
+        // Kill Save Timer
+        killTimer(saveTimerID);
+        saveTimerID = -1;
+    }
+
+    // Save Index
+    save();
+
+    qDebug() << "DirSizeIndex::~DirSizeIndex";
+}
@@ -0,0 +1,153 @@
+#ifndef DIRSIZEINDEX_H
+#define DIRSIZEINDEX_H
+
+#include <QObject>
+#include <QString>
+#include <QStringList>
+#include <QList>
+#include <QHash>
+#include <QSet>
+#include <QMutex>
+
+
+//==============================================================================
+// Dir Size Index Item Class
+//==============================================================================
+class DirSizeIndexItem
+{
+public:
+    // Constructor
+    explicit DirSizeIndexItem(const quint64& aSize = 0, const quint64& aNumDirs = 0, const quint64& aNumFiles = 0, const qint64& aModified = 0);
+
+    // Aggregated Size
+    quint64         size;
+    // Aggregated Number Of Dirs - Including The Dir Itself
+    quint64         numDirs;
+    // Aggregated Number Of Files
+    quint64         numFiles;
+    // Dir Last Modified - secs Since Epoch
+    qint64          modified;
+    // Dirty - Contents Changed Since Last Scan
+    bool            dirty;
+};
+
+
+
+
+//==============================================================================
+// Dir Size Scan Record Class - Result Of Reading One Dir
+//==============================================================================
+class DirSizeScanRecord
+{
+public:
+    // Constructor
+    explicit DirSizeScanRecord(const QString& aDirPath = "", const DirSizeIndexItem& aItem = DirSizeIndexItem(), const bool& aReused = false);
+
+    // Dir Path
+    QString             dirPath;
+    // Own Entries For Read Dirs, Aggregated Values For Reused Index Items
+    DirSizeIndexItem    item;
+    // Reused From Index - Sub Dirs Were Not Read
+    bool                reused;
+};
+
+
+
+
+//==============================================================================
+// Dir Size Index Class - Persistent Disk Usage Index
+//==============================================================================
+class DirSizeIndex : public QObject
+{
+    Q_OBJECT
+
+public:
+
+    // Get Instance - Static Constructor
+    static DirSizeIndex* getInstance();
+
+    // Release
+    void release();
+
+    // Lookup - Returns True If An Up To Date Item Exists For aModified
+    bool lookup(const QString& aDirPath, const qint64& aModified, DirSizeIndexItem& aItem);
+
+    // Check If Dir Is Indexed
+    bool contains(const QString& aDirPath);
+
+    // Store Scan - Aggregates Records Of A Finished Scan Under aRootPath
+    void storeScan(const QString& aRootPath, const QList<DirSizeScanRecord>& aRecords);
+
+    // Invalidate - Marks Dir And Its Indexed Ancestors Dirty
+    void invalidate(const QString& aDirPath);
+
+    // Remove Dir And All Indexed Sub Dirs
+    void remove(const QString& aDirPath);
+
+    // Clear Index
+    void clear();
+
+    // Save Index
+    void save();
+
+protected: // From QObject
+
+    // Timer Event
+    virtual void timerEvent(QTimerEvent* aEvent);
+
+protected: // Constructor/Destructor
+
+    // Constructor
+    explicit DirSizeIndex(QObject* aParent = NULL);
+
+    // Destructor
+    virtual ~DirSizeIndex();
+
+protected:
+
+    // Load Index
+    void load();
+
+    // Schedule Save
+    void scheduleSave();
+
+    // Insert Item - Links It Into The Child Dirs Map
+    void insertItem(const QString& aDirPath, const DirSizeIndexItem& aItem);
+    // Remove Item And Its Indexed Sub Dirs - Returns Number Of Removed Items
+    int removeTree(const QString& aDirPath);
+    // Unlink Dir From The Child Dirs Map - Drops Ancestor Nodes Left Empty
+    void unlinkDir(const QString& aDirPath);
+
+    // Apply Size Delta To Indexed Ancestors
+    void updateAncestors(const QString& aDirPath, const DirSizeIndexItem& aOldItem, const DirSizeIndexItem& aNewItem, const bool& aValid);
+
+    // Trim Index - Drops Deepest Dirs First
+    void trim();
+
+    // Get Parent Path
+    static QString parentPath(const QString& aDirPath);
+
+    // Get Index File Path
+    static QString indexFilePath();
+
+protected:
+
+    // Int Ref Counter
+    int                                 refCount;
+
+    // Index Mutex
+    QMutex                              indexMutex;
+
+    // Index Items
+    QHash<QString, DirSizeIndexItem>    items;
+    // Child Dirs By Parent Path - Covers Indexed Dirs And All Their Ancestors
+    QHash<QString, QSet<QString> >      childDirs;
+
+    // Modified Since Last Save
+    bool                                modified;
+
+    // Save Timer ID
+    int                                 saveTimerID;
+};
+
+#endif // DIRSIZEINDEX_H
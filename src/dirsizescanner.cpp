@@ -0,0 +1,648 @@
+#include <QFile>
+#include <QFileInfo>
+#include <QDirIterator>
+#include <QMutexLocker>
+#include <QTimerEvent>
+#include <QThread>
+#include <QDateTime>
+#include <QDebug>
+
+#if defined(Q_OS_UNIX)
+
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <dirent.h>
+#include <fcntl.h>
+#include <string.h>
+
+#endif // Q_OS_UNIX
+
+#include "dirsizescanner.h"
+#include "constants.h"
+
+
+//==============================================================================
+// Constructor
+//==============================================================================
+DirSizeScanRoot::DirSizeScanRoot(const QString& aDirPath, const bool& aUseIndex)
+    : dirPath(aDirPath)
+    , scannedSize(0)
+    , numDirs(0)
+    , numFiles(0)
+    , numErrors(0)
+    , pendingTasks(0)
+    , aborted(0)
+    , reportedSize(0)
+    , useIndex(aUseIndex)
+    , watchedRecords(0)
+{
+}
+
+
+
+
+
+
+
+//==============================================================================
+// Constructor
+//==============================================================================
+DirSizeScanner::DirSizeScanner(const int& aMaxThreads, const int& aMaxPerDevice, QObject* aParent)
+    : QObject(aParent)
+    , maxPerDevice(aMaxPerDevice > 0 ? aMaxPerDevice : DEFAULT_DIR_SCAN_DEVICE_THREADS)
+    , progressTimerID(-1)
+    , index(DirSizeIndex::getInstance())
+{
+    // Set Max Thread Count
+    scannerPool.setMaxThreadCount(aMaxThreads > 0 ? aMaxThreads : QThread::idealThreadCount());
+
+    qDebug() << "DirSizeScanner::DirSizeScanner - threads: " << scannerPool.maxThreadCount() << " - maxPerDevice: " << maxPerDevice;
+}
+
+//==============================================================================
+// Scan Dir
+//==============================================================================
+void DirSizeScanner::scanDir(const QString& aDirPath, const bool& aUseIndex)
+{
+    qDebug() << "DirSizeScanner::scanDir - aDirPath: " << aDirPath << " - aUseIndex: " << aUseIndex;
+
+    // Init Device
+    quint64 device = 0;
+    // Init Modified
+    qint64 modified = 0;
+
+#if defined(Q_OS_UNIX)
+
+    // Init Stat
+    struct stat st;
+    // Get Stat
+    if (lstat(QFile::encodeName(aDirPath).constData(), &st) == 0) {
+        // Set Device
+        device = (quint64)st.st_dev;
+        // Set Modified
+        modified = (qint64)st.st_mtime;
+    }
+
+#else // Q_OS_UNIX
+
+    // Set Modified
+    modified = QFileInfo(aDirPath).lastModified().toMSecsSinceEpoch() / 1000;
+
+#endif // Q_OS_UNIX
+
+    // Create Root
+    DirSizeScanRoot* root = new DirSizeScanRoot(aDirPath, aUseIndex);
+    // Set Pending Tasks
+    root->pendingTasks = 1;
+    // Add To Roots
+    roots << root;
+
+    // Check Progress Timer
+    if (progressTimerID == -1) {
+        // Start Progress Timer
+        progressTimerID = startTimer(DEFAULT_DIR_SCAN_PROGRESS_INTERVAL);
+    }
+
+    // Schedule Root Task
+    schedule(new DirSizeScanTask(this, root, aDirPath, device, modified, 0));
+}
+
+//==============================================================================
+// Watch Dir
+//==============================================================================
+bool DirSizeScanner::watchDir(const QString& aDirPath)
+{
+    // Go Thru Roots
+    foreach (DirSizeScanRoot* root, roots) {
+        // Check Root Path - Reported By The Root Itself
+        if (root->dirPath == aDirPath) {
+            return true;
+        }
+
+        // Get Root Prefix
+        QString rootPrefix = root->dirPath.endsWith("/") ? root->dirPath : root->dirPath + "/";
+
+        // Check If Root Covers Dir
+        if (aDirPath.startsWith(rootPrefix)) {
+            qDebug() << "DirSizeScanner::watchDir - aDirPath: " << aDirPath << " - root: " << root->dirPath;
+
+            // Add Watch
+            root->watches[aDirPath] = DirSizeIndexItem(0, 0, 0);
+
+            // Reset Watches - Records So Far Are Added Up Again On The Next Report
+            QHash<QString, DirSizeIndexItem>::iterator it = root->watches.begin();
+            while (it != root->watches.end()) {
+                // Reset Watch
+                it.value() = DirSizeIndexItem(0, 0, 0);
+                ++it;
+            }
+
+            // Reset Watched Records
+            root->watchedRecords = 0;
+
+            return true;
+        }
+    }
+
+    return false;
+}
+
+//==============================================================================
+// Clear Watched Dirs
+//==============================================================================
+void DirSizeScanner::clearWatches()
+{
+    // Go Thru Roots
+    foreach (DirSizeScanRoot* root, roots) {
+        // Clear Watches
+        root->watches.clear();
+    }
+}
+
+//==============================================================================
+// Abort All Scans
+//==============================================================================
+void DirSizeScanner::abort()
+{
+    // Check Roots
+    if (roots.isEmpty()) {
+        return;
+    }
+
+    qDebug() << "DirSizeScanner::abort";
+
+    // Go Thru Roots
+    foreach (DirSizeScanRoot* root, roots) {
+        // Set Aborted
+        root->aborted = 1;
+    }
+
+    {
+        QMutexLocker locker(&schedulerMutex);
+
+        // Go Thru Pending Lists
+        foreach (const QList<DirSizeScanTask*>& pending, devicePending) {
+            // Delete Pending Tasks
+            qDeleteAll(pending);
+        }
+
+        // Clear Pending Tasks
+        devicePending.clear();
+    }
+
+    // Drop Queued Tasks
+    scannerPool.clear();
+    // Wait For Running Tasks - Each Reads A Single Dir
+    scannerPool.waitForDone();
+
+    {
+        QMutexLocker locker(&schedulerMutex);
+        // Clear Active Tasks
+        deviceActive.clear();
+    }
+
+    // Delete Roots
+    qDeleteAll(roots);
+    // Clear Roots
+    roots.clear();
+
+    {
+        QMutexLocker locker(&inodeMutex);
+        // Clear Seen Inodes
+        seenInodes.clear();
+    }
+
+    // Check Progress Timer
+    if (progressTimerID != -1) {
+        // Kill Progress Timer
+        killTimer(progressTimerID);
+        progressTimerID = -1;
+    }
+}
+
+//==============================================================================
+// Is Busy
+//==============================================================================
+bool DirSizeScanner::isBusy()
+{
+    return !roots.isEmpty();
+}
+
+//==============================================================================
+// Schedule Task
+//==============================================================================
+void DirSizeScanner::schedule(DirSizeScanTask* aTask)
+{
+    QMutexLocker locker(&schedulerMutex);
+
+    // Check If Aborted
+    if (aTask->root->aborted.load()) {
+        // Dec Pending Tasks
+        aTask->root->pendingTasks.deref();
+        // Delete Task
+        delete aTask;
+
+        return;
+    }
+
+    // Get Active Tasks For Device
+    int active = deviceActive.value(aTask->device);
+
+    // Check Device Limit
+    if (active < maxPerDevice) {
+        // Inc Active Tasks
+        deviceActive[aTask->device] = active + 1;
+        // Start Task - Deeper Dirs First Keeps The Queue Short
+        scannerPool.start(aTask, aTask->depth);
+    } else {
+        // Add To Pending
+        devicePending[aTask->device] << aTask;
+    }
+}
+
+//==============================================================================
+// Task Done
+//==============================================================================
+void DirSizeScanner::taskDone(DirSizeScanTask* aTask)
+{
+    QMutexLocker locker(&schedulerMutex);
+
+    // Get Pending Tasks For Device
+    QList<DirSizeScanTask*>& pending = devicePending[aTask->device];
+
+    // Check Pending Tasks
+    if (!pending.isEmpty()) {
+        // Get Next Task - Takes Over The Device Slot
+        DirSizeScanTask* nextTask = pending.takeLast();
+        // Start Next Task
+        scannerPool.start(nextTask, nextTask->depth);
+
+        return;
+    }
+
+    // Remove Empty Pending List
+    devicePending.remove(aTask->device);
+
+    // Dec Active Tasks
+    if (--deviceActive[aTask->device] <= 0) {
+        // Remove Device
+        deviceActive.remove(aTask->device);
+    }
+}
+
+//==============================================================================
+// Check If File Already Counted
+//==============================================================================
+bool DirSizeScanner::alreadyCounted(const quint64& aDevice, const quint64& aInode)
+{
+    QMutexLocker locker(&inodeMutex);
+
+    // Init Key
+    QPair<quint64, quint64> key(aDevice, aInode);
+
+    // Check Seen Inodes
+    if (seenInodes.contains(key)) {
+        return true;
+    }
+
+    // Add To Seen Inodes
+    seenInodes << key;
+
+    return false;
+}
+
+//==============================================================================
+// Update Watched Sub Dirs Of Root
+//==============================================================================
+void DirSizeScanner::updateWatches(DirSizeScanRoot* aRoot)
+{
+    QMutexLocker locker(&aRoot->recordsMutex);
+
+    // Get Records Count
+    int rCount = aRoot->records.count();
+
+    // Check Watches
+    if (aRoot->watches.isEmpty()) {
+        // Set Watched Records
+        aRoot->watchedRecords = rCount;
+
+        return;
+    }
+
+    // Go Thru New Records
+    for (int i = aRoot->watchedRecords; i < rCount; ++i) {
+        // Get Record
+        const DirSizeScanRecord& record = aRoot->records[i];
+        // Init Path
+        QString path = record.dirPath;
+
+        // Go Thru Record Path And Its Ancestors Below The Root
+        while (path.length() > aRoot->dirPath.length()) {
+            // Find Watch
+            QHash<QString, DirSizeIndexItem>::iterator it = aRoot->watches.find(path);
+
+            // Check Watch
+            if (it != aRoot->watches.end()) {
+                // Add Record Values
+                it.value().size += record.item.size;
+                it.value().numDirs += record.item.numDirs;
+                it.value().numFiles += record.item.numFiles;
+            }
+
+            // Get Parent Path
+            path.truncate(path.lastIndexOf('/'));
+        }
+    }
+
+    // Set Watched Records
+    aRoot->watchedRecords = rCount;
+}
+
+//==============================================================================
+// Report Progress
+//==============================================================================
+void DirSizeScanner::reportProgress()
+{
+    // Go Thru Roots
+    for (int i = roots.count() - 1; i >= 0; --i) {
+        // Get Root
+        DirSizeScanRoot* root = roots[i];
+        // Get Scanned Size
+        quint64 scannedSize = root->scannedSize.load();
+        // Get Finished - Before Adding Up Watches, No Records Come After The Last Task
+        bool finished = root->pendingTasks.load() <= 0;
+
+        // Update Watches
+        updateWatches(root);
+
+        // Check Finished
+        if (finished) {
+            qDebug() << "DirSizeScanner::reportProgress - FINISHED - dirPath: " << root->dirPath << " - size: " << scannedSize << " - errors: " << root->numErrors.load();
+
+            // Store Scan Records In Index
+            index->storeScan(root->dirPath, root->records);
+
+            // Emit Scan Finished Signal
+            emit scanFinished(root->dirPath, root->numDirs.load(), root->numFiles.load(), scannedSize);
+
+            // Go Thru Watches - Finished Along With Their Root
+            QHash<QString, DirSizeIndexItem>::const_iterator it = root->watches.constBegin();
+            while (it != root->watches.constEnd()) {
+                // Emit Scan Finished Signal
+                emit scanFinished(it.key(), it.value().numDirs, it.value().numFiles, it.value().size);
+                ++it;
+            }
+
+            // Remove Root
+            roots.removeAt(i);
+            // Delete Root
+            delete root;
+
+            continue;
+        }
+
+        // Check Reported Size
+        if (root->reportedSize != scannedSize) {
+            // Set Reported Size
+            root->reportedSize = scannedSize;
+            // Emit Scan Progress Signal
+            emit scanProgress(root->dirPath, root->numDirs.load(), root->numFiles.load(), scannedSize);
+
+            // Go Thru Watches
+            QHash<QString, DirSizeIndexItem>::const_iterator it = root->watches.constBegin();
+            while (it != root->watches.constEnd()) {
+                // Emit Scan Progress Signal
+                emit scanProgress(it.key(), it.value().numDirs, it.value().numFiles, it.value().size);
+                ++it;
+            }
+        }
+    }
+
+    // Check Roots
+    if (roots.isEmpty()) {
+        {
+            QMutexLocker locker(&inodeMutex);
+            // Clear Seen Inodes - Batch Done
+            seenInodes.clear();
+        }
+
+        // Check Progress Timer
+        if (progressTimerID != -1) {
+            // Kill Progress Timer
+            killTimer(progressTimerID);
+            progressTimerID = -1;
+        }
+    }
+}
+
+//==============================================================================
+// Timer Event
+//==============================================================================
+void DirSizeScanner::timerEvent(QTimerEvent* aEvent)
+{
+    // Check Event
+    if (aEvent && aEvent->timerId() == progressTimerID) {
+        // Report Progress
+        reportProgress();
+    }
+}
+
+//==============================================================================
+// Destructor
+//==============================================================================
+DirSizeScanner::~DirSizeScanner()
+{
+    // Abort
+    abort();
+
+    // Check Index
+    if (index) {
+        // Release Index
+        index->release();
+        index = NULL;
+    }
+
+    qDebug() << "DirSizeScanner::~DirSizeScanner";
+}
+
+
+
+
+
+
+
+//==============================================================================
+// Constructor
+//==============================================================================
+DirSizeScanTask::DirSizeScanTask(DirSizeScanner* aScanner, DirSizeScanRoot* aRoot, const QString& aDirPath, const quint64& aDevice, const qint64& aModified, const int& aDepth)
+    : QRunnable()
+    , scanner(aScanner)
+    , root(aRoot)
+    , dirPath(aDirPath)
+    , device(aDevice)
+    , modified(aModified)
+    , depth(aDepth)
+{
+}
+
+//==============================================================================
+// Run
+//==============================================================================
+void DirSizeScanTask::run()
+{
+    // Check If Aborted
+    if (!root->aborted.load()) {
+        // Scan Dir
+        scanDir();
+    }
+
+    // Task Done
+    scanner->taskDone(this);
+
+    // Dec Pending Tasks - Root May Be Deleted After This
+    root->pendingTasks.deref();
+}
+
+//==============================================================================
+// Scan Dir
+//==============================================================================
+void DirSizeScanTask::scanDir()
+{
+    // Init Dir Size
+    quint64 dirSize = 0;
+    // Init Files Count
+    quint64 filesCount = 0;
+    // Get Dir Prefix
+    QString dirPrefix = dirPath.endsWith("/") ? dirPath : dirPath + "/";
+
+#if defined(Q_OS_UNIX)
+
+    // Open Dir
+    DIR* dir = opendir(QFile::encodeName(dirPath).constData());
+
+    // Check Dir
+    if (!dir) {
+        // Inc Errors
+        root->numErrors.ref();
+
+        return;
+    }
+
+    // Get Dir File Descriptor
+    int dirFD = dirfd(dir);
+    // Init Entry
+    struct dirent* entry = NULL;
+
+    // Go Thru Entries
+    while ((entry = readdir(dir)) != NULL && !root->aborted.load()) {
+        // Check Dot Entries
+        if (strcmp(entry->d_name, ".") == 0 || strcmp(entry->d_name, "..") == 0) {
+            continue;
+        }
+
+        // Init Stat
+        struct stat st;
+        // Get Stat - Don't Follow Links
+        if (fstatat(dirFD, entry->d_name, &st, AT_SYMLINK_NOFOLLOW) != 0) {
+            continue;
+        }
+
+        // Check If Dir
+        if (S_ISDIR(st.st_mode)) {
+            // Add Sub Dir
+            addSubDir(dirPrefix + QFile::decodeName(entry->d_name), (quint64)st.st_dev, (qint64)st.st_mtime);
+
+            continue;
+        }
+
+        // Inc Files Count
+        filesCount++;
+
+        // Check Hard Links
+        if (st.st_nlink > 1 && scanner->alreadyCounted((quint64)st.st_dev, (quint64)st.st_ino)) {
+            continue;
+        }
+
+        // Add Size
+        dirSize += (quint64)st.st_size;
+    }
+
+    // Close Dir
+    closedir(dir);
+
+#else // Q_OS_UNIX
+
+    // Init Dir Iterator
+    QDirIterator dirIterator(dirPath, QDir::AllEntries | QDir::Hidden | QDir::System | QDir::NoDotAndDotDot);
+
+    // Go Thru Entries
+    while (dirIterator.hasNext() && !root->aborted.load()) {
+        // Next Entry
+        dirIterator.next();
+        // Get File Info
+        QFileInfo fileInfo = dirIterator.fileInfo();
+
+        // Check If Dir
+        if (fileInfo.isDir() && !fileInfo.isSymLink()) {
+            // Add Sub Dir
+            addSubDir(fileInfo.absoluteFilePath(), device, fileInfo.lastModified().toMSecsSinceEpoch() / 1000);
+
+            continue;
+        }
+
+        // Inc Files Count
+        filesCount++;
+        // Add Size
+        dirSize += (quint64)fileInfo.size();
+    }
+
+#endif // Q_OS_UNIX
+
+    // Inc Dirs Count
+    root->numDirs.fetchAndAddRelaxed(1);
+    // Add Files Count
+    root->numFiles.fetchAndAddRelaxed(filesCount);
+    // Add Dir Size
+    root->scannedSize.fetchAndAddRelaxed(dirSize);
+
+    // Add Record
+    addRecord(DirSizeScanRecord(dirPath, DirSizeIndexItem(dirSize, 1, filesCount, modified)));
+}
+
+//==============================================================================
+// Add Sub Dir
+//==============================================================================
+void DirSizeScanTask::addSubDir(const QString& aDirPath, const quint64& aDevice, const qint64& aModified)
+{
+    // Init Index Item
+    DirSizeIndexItem item;
+
+    // Check If Index Item Is Up To Date
+    if (root->useIndex && scanner->index->lookup(aDirPath, aModified, item)) {
+        // Add Index Item Values
+        root->numDirs.fetchAndAddRelaxed(item.numDirs);
+        root->numFiles.fetchAndAddRelaxed(item.numFiles);
+        root->scannedSize.fetchAndAddRelaxed(item.size);
+
+        // Add Reused Record
+        addRecord(DirSizeScanRecord(aDirPath, item, true));
+
+        return;
+    }
+
+    // Inc Pending Tasks
+    root->pendingTasks.ref();
+    // Schedule Sub Dir
+    scanner->schedule(new DirSizeScanTask(scanner, root, aDirPath, aDevice, aModified, depth + 1));
+}
+
+//==============================================================================
+// Add Record
+//==============================================================================
+void DirSizeScanTask::addRecord(const DirSizeScanRecord& aRecord)
+{
+    QMutexLocker locker(&root->recordsMutex);
+
+    // Add Record
+    root->records << aRecord;
+}
@@ -0,0 +1,194 @@
+#ifndef DIRSIZESCANNER_H
+#define DIRSIZESCANNER_H
+
+#include <QObject>
+#include <QString>
+#include <QList>
+#include <QHash>
+#include <QSet>
+#include <QPair>
+#include <QMutex>
+#include <QAtomicInt>
+#include <QAtomicInteger>
+#include <QThreadPool>
+#include <QRunnable>
+
+#include "dirsizeindex.h"
+
+class DirSizeScanTask;
+
+
+//==============================================================================
+// Dir Size Scan Root Class - One Requested Dir, Shared By All Its Tasks
+//==============================================================================
+class DirSizeScanRoot
+{
+public:
+    // Constructor
+    explicit DirSizeScanRoot(const QString& aDirPath, const bool& aUseIndex);
+
+    // Dir Path
+    QString                     dirPath;
+    // Scanned Size
+    QAtomicInteger<quint64>     scannedSize;
+    // Number Of Dirs
+    QAtomicInteger<quint64>     numDirs;
+    // Number Of Files
+    QAtomicInteger<quint64>     numFiles;
+    // Number Of Unreadable Dirs
+    QAtomicInt                  numErrors;
+    // Pending Tasks - Root Is Done When This Drops To 0
+    QAtomicInt                  pendingTasks;
+    // Aborted
+    QAtomicInt                  aborted;
+    // Last Reported Size
+    quint64                     reportedSize;
+    // Reuse Up To Date Index Items Instead Of Reading Sub Dirs
+    bool                        useIndex;
+    // Records Mutex
+    QMutex                      recordsMutex;
+    // Per Dir Records - Stored In The Index When Finished
+    QList<DirSizeScanRecord>    records;
+    // Watched Sub Dirs - Totals Added Up From Records, Owned By The Owner Thread
+    QHash<QString, DirSizeIndexItem> watches;
+    // Records Already Added To Watches
+    int                         watchedRecords;
+};
+
+
+
+
+//==============================================================================
+// Dir Size Scanner Class - Parallel Tree Walker For Dir Sizes
+//==============================================================================
+class DirSizeScanner : public QObject
+{
+    Q_OBJECT
+
+public:
+
+    // Constructor - aMaxThreads <= 0 Uses The Ideal Thread Count
+    explicit DirSizeScanner(const int& aMaxThreads = 0, const int& aMaxPerDevice = 0, QObject* aParent = NULL);
+
+    // Scan Dir - aUseIndex Only Reads Dirs Changed Since They Were Indexed
+    void scanDir(const QString& aDirPath, const bool& aUseIndex = false);
+
+    // Watch Dir - Reports A Sub Dir Of A Running Scan Under Its Own Path, Returns False If No Scan Covers It
+    bool watchDir(const QString& aDirPath);
+
+    // Clear Watched Dirs
+    void clearWatches();
+
+    // Abort All Scans
+    void abort();
+
+    // Is Busy
+    bool isBusy();
+
+    // Destructor
+    virtual ~DirSizeScanner();
+
+signals:
+
+    // Scan Progress Signal - Emitted Periodically From The Owner Thread
+    void scanProgress(const QString& aDirPath, const quint64& aNumDirs, const quint64& aNumFiles, const quint64& aScannedSize);
+
+    // Scan Finished Signal
+    void scanFinished(const QString& aDirPath, const quint64& aNumDirs, const quint64& aNumFiles, const quint64& aScannedSize);
+
+protected: // From QObject
+
+    // Timer Event
+    virtual void timerEvent(QTimerEvent* aEvent);
+
+protected:
+    friend class DirSizeScanTask;
+
+    // Schedule Task - Respects Per Device Concurrency Limit
+    void schedule(DirSizeScanTask* aTask);
+    // Task Done - Hands The Device Slot To The Next Pending Task
+    void taskDone(DirSizeScanTask* aTask);
+
+    // Check If File Already Counted - Hard Link De-duplication
+    bool alreadyCounted(const quint64& aDevice, const quint64& aInode);
+
+    // Update Watched Sub Dirs Of Root From New Records
+    void updateWatches(DirSizeScanRoot* aRoot);
+
+    // Report Progress
+    void reportProgress();
+
+protected:
+
+    // Max Tasks Per Device
+    int                                         maxPerDevice;
+
+    // Scan Roots - Owned By The Owner Thread
+    QList<DirSizeScanRoot*>                     roots;
+
+    // Scheduler Mutex
+    QMutex                                      schedulerMutex;
+    // Active Tasks Per Device
+    QHash<quint64, int>                         deviceActive;
+    // Pending Tasks Per Device
+    QHash<quint64, QList<DirSizeScanTask*> >    devicePending;
+
+    // Inode Mutex
+    QMutex                                      inodeMutex;
+    // Seen Multiply Linked Inodes
+    QSet<QPair<quint64, quint64> >              seenInodes;
+
+    // Progress Timer ID
+    int                                         progressTimerID;
+
+    // Dir Size Index
+    DirSizeIndex*                               index;
+
+    // Scanner Thread Pool
+    QThreadPool                                 scannerPool;
+};
+
+
+
+
+//==============================================================================
+// Dir Size Scan Task Class - Reads One Dir, Schedules Sub Dirs
+//==============================================================================
+class DirSizeScanTask : public QRunnable
+{
+public:
+    // Constructor
+    explicit DirSizeScanTask(DirSizeScanner* aScanner, DirSizeScanRoot* aRoot, const QString& aDirPath, const quint64& aDevice, const qint64& aModified, const int& aDepth);
+
+protected: // From QRunnable
+
+    // Run
+    virtual void run();
+
+protected:
+
+    // Scan Dir
+    void scanDir();
+    // Add Sub Dir - Reuses Up To Date Index Item Or Schedules A New Task
+    void addSubDir(const QString& aDirPath, const quint64& aDevice, const qint64& aModified);
+    // Add Record
+    void addRecord(const DirSizeScanRecord& aRecord);
+
+protected:
+    friend class DirSizeScanner;
+
+    // Scanner
+    DirSizeScanner*     scanner;
+    // Root
+    DirSizeScanRoot*    root;
+    // Dir Path
+    QString             dirPath;
+    // Device
+    quint64             device;
+    // Dir Last Modified - secs Since Epoch
+    qint64              modified;
+    // Depth
+    int                 depth;
+};
+
+#endif // DIRSIZESCANNER_H
@@ -0,0 +1,617 @@
+#include <QFile>
+#include <QDir>
+#include <QStringList>
+#include <QByteArray>
+#include <QElapsedTimer>
+#include <QMutexLocker>
+#include <QDebug>
+
+#if defined(Q_OS_UNIX)
+
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/resource.h>
+#include <sys/ioctl.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <errno.h>
+
+#endif // Q_OS_UNIX
+
+#if defined(Q_OS_LINUX)
+
+#include <sys/sendfile.h>
+#include <sys/syscall.h>
+#include <linux/fs.h>
+
+#endif // Q_OS_LINUX
+
+#include "filecopyengine.h"
+#include "constants.h"
+
+
+// Capability Mutex
+QMutex FileCopyEngine::capabilityMutex;
+// Preferred Methods By Source:Target Device
+QHash<QString, int> FileCopyEngine::capabilities;
+
+
+//==============================================================================
+// Copy File
+//==============================================================================
+int FileCopyEngine::copyFile(const QString& aSource, const QString& aTarget, const int& aMethod, const QAtomicInt* aAborted, const bool& aOverwrite)
+{
+#if defined(Q_OS_UNIX)
+
+    // Open Source
+    int sourceFD = ::open(QFile::encodeName(aSource).constData(), O_RDONLY | O_CLOEXEC);
+
+    // Check Source
+    if (sourceFD < 0) {
+        qDebug() << "FileCopyEngine::copyFile - aSource: " << aSource << " - error: " << errno;
+        return -1;
+    }
+
+    // Init Source Stat
+    struct stat sourceStat;
+
+    // Get Source Stat - Only Regular Files Are Copied Here
+    if (fstat(sourceFD, &sourceStat) != 0 || !S_ISREG(sourceStat.st_mode)) {
+        // Close Source
+        ::close(sourceFD);
+        return -1;
+    }
+
+    // Open Target - O_EXCL Leaves Existing Targets Alone
+    int targetFD = ::open(QFile::encodeName(aTarget).constData(), O_WRONLY | O_CREAT | (aOverwrite ? O_TRUNC : O_EXCL) | O_CLOEXEC, sourceStat.st_mode & 0777);
+
+    // Check Target
+    if (targetFD < 0) {
+        qDebug() << "FileCopyEngine::copyFile - aTarget: " << aTarget << " - error: " << errno;
+        // Close Source
+        ::close(sourceFD);
+        return -1;
+    }
+
+    // Init Target Stat
+    struct stat targetStat;
+    // Get Target Stat
+    fstat(targetFD, &targetStat);
+
+#if defined(Q_OS_LINUX)
+    // Advise Sequential Read - Only Matters For The User Space Fallbacks
+    posix_fadvise(sourceFD, 0, 0, POSIX_FADV_SEQUENTIAL);
+#endif // Q_OS_LINUX
+
+    // Get Method
+    int method = aMethod >= 0 ? aMethod : preferredMethod(sourceStat.st_dev, targetStat.st_dev);
+    // Init Offset
+    qint64 offset = 0;
+    // Init Error
+    int error = 0;
+
+    // Copy Data
+    bool success = copyData(sourceFD, targetFD, sourceStat.st_size, method, offset, aAborted, error);
+
+    // Fall Back - Continues From The Offset Reached, Reflink Is Never Retried Mid File
+    while (!success && aMethod == EFCMAuto && method < EFCMReadWrite && methodNotSupported(error)) {
+        qDebug() << "FileCopyEngine::copyFile - method: " << methodToString(method) << " - not supported: " << error;
+        // Inc Method
+        method++;
+        // Copy Data
+        success = copyData(sourceFD, targetFD, sourceStat.st_size, method, offset, aAborted, error);
+    }
+
+    // Check Success & Auto Method
+    if (success && aMethod == EFCMAuto) {
+        // Set Preferred Method
+        setPreferredMethod(sourceStat.st_dev, targetStat.st_dev, method);
+    }
+
+    // Close Source
+    ::close(sourceFD);
+
+    // Close Target - Delayed Write Errors Show Up Here On Network File Systems
+    if (::close(targetFD) != 0 && success) {
+        // Set Error
+        error = errno;
+        // Reset Success
+        success = false;
+    }
+
+    // Check Success
+    if (!success) {
+        qDebug() << "FileCopyEngine::copyFile - aSource: " << aSource << " - aTarget: " << aTarget << " - method: " << methodToString(method) << " - error: " << error;
+        // Remove Partial Target
+        ::unlink(QFile::encodeName(aTarget).constData());
+
+        return -1;
+    }
+
+    return method;
+
+#else // Q_OS_UNIX
+
+    Q_UNUSED(aMethod);
+    Q_UNUSED(aAborted);
+
+    // Check Overwrite
+    if (!aOverwrite && QFile::exists(aTarget)) {
+        return -1;
+    }
+
+    // Remove Target - QFile::copy Does Not Overwrite
+    QFile::remove(aTarget);
+
+    return QFile::copy(aSource, aTarget) ? EFCMReadWrite : -1;
+
+#endif // Q_OS_UNIX
+}
+
+//==============================================================================
+// Method To String
+//==============================================================================
+QString FileCopyEngine::methodToString(const int& aMethod)
+{
+    switch (aMethod) {
+        case EFCMAuto:          return "Auto";
+        case EFCMReflink:       return "Reflink";
+        case EFCMCopyRange:     return "CopyFileRange";
+        case EFCMSendFile:      return "SendFile";
+        case EFCMReadWrite:     return "ReadWrite";
+
+        default:
+        break;
+    }
+
+    return "";
+}
+
+//==============================================================================
+// Benchmark
+//==============================================================================
+QString FileCopyEngine::benchmark(const QString& aSourceDirPath, const QString& aTargetDirPath)
+{
+    // Init Report
+    QStringList report;
+
+    // Init Source Dir Path
+    QString sourceDirPath = aSourceDirPath + "/" + DEFAULT_FILE_COPY_BENCH_DIR;
+    // Init Target Dir Path - Same File System When No Target Given
+    QString targetDirPath = (aTargetDirPath.isEmpty() ? aSourceDirPath : aTargetDirPath) + "/" + DEFAULT_FILE_COPY_BENCH_DIR + "_target";
+
+    // Make Dirs
+    if (!QDir().mkpath(sourceDirPath) || !QDir().mkpath(targetDirPath)) {
+        return QString("Unable to create %1 or %2").arg(sourceDirPath).arg(targetDirPath);
+    }
+
+    // Init Large File Path
+    QString largeFilePath = sourceDirPath + "/large";
+    // Init Small File Count
+    int smallCount = 0;
+
+    // Write Large File
+    bool prepared = writeBenchmarkFile(largeFilePath, DEFAULT_FILE_COPY_BENCH_LARGE_SIZE);
+
+    // Go Thru Small Files
+    for (int i=0; prepared && i<DEFAULT_FILE_COPY_BENCH_SMALL_COUNT; ++i) {
+        // Write Small File
+        prepared = writeBenchmarkFile(sourceDirPath + QString("/small%1").arg(i), DEFAULT_FILE_COPY_BENCH_SMALL_SIZE);
+        // Inc Small Count
+        smallCount++;
+    }
+
+    // Add Header
+    report << QString("Copy benchmark - source: %1 - target: %2").arg(sourceDirPath).arg(targetDirPath);
+    report << QString("Large: %1 MB - Small: %2 x %3 KB").arg(DEFAULT_FILE_COPY_BENCH_LARGE_SIZE >> 20).arg(DEFAULT_FILE_COPY_BENCH_SMALL_COUNT).arg(DEFAULT_FILE_COPY_BENCH_SMALL_SIZE >> 10);
+
+    // Go Thru Methods
+    for (int method = EFCMReflink; prepared && method <= EFCMReadWrite; ++method) {
+        // Init Timer
+        QElapsedTimer timer;
+        // Start Timer
+        timer.start();
+        // Get CPU Start
+        qint64 cpuStart = cpuTime();
+
+        // Copy Large File
+        int largeResult = copyFile(largeFilePath, targetDirPath + "/large", method);
+
+        // Get Large Elapsed - msecs
+        qint64 largeElapsed = qMax((qint64)1, timer.elapsed());
+        // Get Large CPU - msecs
+        qint64 largeCPU = cpuTime() - cpuStart;
+
+        // Restart Timer
+        timer.restart();
+        // Get CPU Start
+        cpuStart = cpuTime();
+        // Init Small Failed
+        int smallFailed = 0;
+
+        // Go Thru Small Files
+        for (int j=0; j<smallCount; ++j) {
+            // Copy Small File
+            if (copyFile(sourceDirPath + QString("/small%1").arg(j), targetDirPath + QString("/small%1").arg(j), method) < 0) {
+                // Inc Small Failed
+                smallFailed++;
+            }
+        }
+
+        // Get Small Elapsed - msecs
+        qint64 smallElapsed = qMax((qint64)1, timer.elapsed());
+        // Get Small CPU - msecs
+        qint64 smallCPU = cpuTime() - cpuStart;
+
+        // Check Large Result
+        if (largeResult < 0) {
+            // Add Line
+            report << QString("%1 - not supported").arg(methodToString(method), -14);
+        } else {
+            // Add Line
+            report << QString("%1 - large: %2 MB/s, cpu %3 ms - small: %4 files/s, cpu %5 ms%6")
+                      .arg(methodToString(method), -14)
+                      .arg((double)DEFAULT_FILE_COPY_BENCH_LARGE_SIZE / 1048576.0 * 1000.0 / largeElapsed, 0, 'f', 1)
+                      .arg(largeCPU)
+                      .arg((qint64)(smallCount - smallFailed) * 1000 / smallElapsed)
+                      .arg(smallCPU)
+                      .arg(smallFailed > 0 ? QString(" - failed: %1").arg(smallFailed) : QString(""));
+        }
+
+        // Clear Target Dir
+        QDir(targetDirPath).removeRecursively();
+        // Make Target Dir
+        QDir().mkpath(targetDirPath);
+    }
+
+    // Check Prepared
+    if (!prepared) {
+        // Add Line
+        report << QString("Unable to write benchmark files");
+    }
+
+    // Remove Dirs
+    QDir(sourceDirPath).removeRecursively();
+    QDir(targetDirPath).removeRecursively();
+
+    return report.join("\n");
+}
+
+//==============================================================================
+// Get Preferred Method For Source And Target Device
+//==============================================================================
+int FileCopyEngine::preferredMethod(const quint64& aSourceDevice, const quint64& aTargetDevice)
+{
+    QMutexLocker locker(&capabilityMutex);
+
+    // Reflink First - Falls Back On The First Copy Between A New Device Pair
+    return capabilities.value(QString("%1:%2").arg(aSourceDevice).arg(aTargetDevice), EFCMReflink);
+}
+
+//==============================================================================
+// Set Preferred Method For Source And Target Device
+//==============================================================================
+void FileCopyEngine::setPreferredMethod(const quint64& aSourceDevice, const quint64& aTargetDevice, const int& aMethod)
+{
+    QMutexLocker locker(&capabilityMutex);
+
+    // Set Preferred Method
+    capabilities[QString("%1:%2").arg(aSourceDevice).arg(aTargetDevice)] = aMethod;
+}
+
+//==============================================================================
+// Copy Data
+//==============================================================================
+bool FileCopyEngine::copyData(const int& aSource, const int& aTarget, const qint64& aSize, const int& aMethod, qint64& aOffset, const QAtomicInt* aAborted, int& aError)
+{
+#if defined(Q_OS_UNIX)
+
+    // Check Method
+    if (aMethod == EFCMReflink) {
+
+#if defined(Q_OS_LINUX) && defined(FICLONE)
+
+        // Check Offset - Clones Whole Files Only
+        if (aOffset > 0) {
+            // Set Error
+            aError = EINVAL;
+            return false;
+        }
+
+        // Clone - Shares Extents On btrfs/XFS, No Data Is Moved
+        if (ioctl(aTarget, FICLONE, aSource) == 0) {
+            // Set Offset
+            aOffset = aSize;
+            return true;
+        }
+
+        // Set Error
+        aError = errno;
+
+#else // Q_OS_LINUX && FICLONE
+
+        // Set Error
+        aError = ENOTSUP;
+
+#endif // Q_OS_LINUX && FICLONE
+
+        return false;
+    }
+
+    // Check Method
+    if (aMethod == EFCMCopyRange) {
+
+#if defined(Q_OS_LINUX) && defined(__NR_copy_file_range)
+
+        // Init Offsets
+        loff_t sourceOffset = aOffset;
+        loff_t targetOffset = aOffset;
+
+        // Copy Chunks - Stays In The Kernel, Server Side Copy On NFS/SMB
+        while (aOffset < aSize) {
+            // Check Aborted
+            if (aAborted && aAborted->loadAcquire()) {
+                // Set Error
+                aError = ECANCELED;
+                return false;
+            }
+
+            // Copy Range
+            ssize_t copied = syscall(__NR_copy_file_range, aSource, &sourceOffset, aTarget, &targetOffset, (size_t)qMin(aSize - aOffset, (qint64)DEFAULT_FILE_COPY_CHUNK_SIZE), 0);
+
+            // Check Copied
+            if (copied < 0) {
+                // Check Error
+                if (errno == EINTR) {
+                    continue;
+                }
+
+                // Set Error
+                aError = errno;
+                return false;
+            }
+
+            // Check Copied - Some File Systems Return 0 Instead Of An Error, Fall Forward To The Next Method
+            if (copied == 0) {
+                // Set Error - Not Supported, A Shrunk Source Ends The Read/Write Fallback
+                aError = EINVAL;
+                return false;
+            }
+
+            // Inc Offset
+            aOffset += copied;
+        }
+
+        return true;
+
+#else // Q_OS_LINUX && __NR_copy_file_range
+
+        // Set Error
+        aError = ENOSYS;
+
+        return false;
+
+#endif // Q_OS_LINUX && __NR_copy_file_range
+    }
+
+    // Seek Target - Range Copies Do Not Move The File Position
+    if (lseek(aTarget, aOffset, SEEK_SET) < 0) {
+        // Set Error
+        aError = errno;
+        return false;
+    }
+
+    // Check Method
+    if (aMethod == EFCMSendFile) {
+
+#if defined(Q_OS_LINUX)
+
+        // Init Source Offset
+        off_t sourceOffset = aOffset;
+
+        // Send Chunks - No User Space Buffer
+        while (aOffset < aSize) {
+            // Check Aborted
+            if (aAborted && aAborted->loadAcquire()) {
+                // Set Error
+                aError = ECANCELED;
+                return false;
+            }
+
+            // Send File
+            ssize_t sent = sendfile(aTarget, aSource, &sourceOffset, (size_t)qMin(aSize - aOffset, (qint64)DEFAULT_FILE_COPY_CHUNK_SIZE));
+
+            // Check Sent
+            if (sent < 0) {
+                // Check Error
+                if (errno == EINTR) {
+                    continue;
+                }
+
+                // Set Error
+                aError = errno;
+                return false;
+            }
+
+            // Check Sent - Some File Systems Return 0 Instead Of An Error, Fall Forward To The Next Method
+            if (sent == 0) {
+                // Set Error - Not Supported, A Shrunk Source Ends The Read/Write Fallback
+                aError = EINVAL;
+                return false;
+            }
+
+            // Inc Offset
+            aOffset += sent;
+        }
+
+        return true;
+
+#else // Q_OS_LINUX
+
+        // Set Error
+        aError = ENOSYS;
+
+        return false;
+
+#endif // Q_OS_LINUX
+    }
+
+    // Init Buffer
+    QByteArray buffer(DEFAULT_FILE_COPY_BUFFER_SIZE, 0);
+
+    // Read/Write Chunks
+    while (aOffset < aSize) {
+        // Check Aborted
+        if (aAborted && aAborted->loadAcquire()) {
+            // Set Error
+            aError = ECANCELED;
+            return false;
+        }
+
+        // Read Chunk
+        ssize_t bytesRead = pread(aSource, buffer.data(), (size_t)qMin(aSize - aOffset, (qint64)buffer.size()), aOffset);
+
+        // Check Bytes Read
+        if (bytesRead < 0) {
+            // Check Error
+            if (errno == EINTR) {
+                continue;
+            }
+
+            // Set Error
+            aError = errno;
+            return false;
+        }
+
+        // Check Bytes Read - Source Shrank
+        if (bytesRead == 0) {
+            break;
+        }
+
+        // Init Bytes Written
+        ssize_t bytesWritten = 0;
+
+        // Write Chunk - Partial Writes Are Continued
+        while (bytesWritten < bytesRead) {
+            // Write
+            ssize_t written = ::write(aTarget, buffer.constData() + bytesWritten, bytesRead - bytesWritten);
+
+            // Check Written
+            if (written < 0) {
+                // Check Error
+                if (errno == EINTR) {
+                    continue;
+                }
+
+                // Set Error
+                aError = errno;
+                return false;
+            }
+
+            // Inc Bytes Written
+            bytesWritten += written;
+        }
+
+        // Inc Offset
+        aOffset += bytesRead;
+    }
+
+    return true;
+
+#else // Q_OS_UNIX
+
+    Q_UNUSED(aSource);
+    Q_UNUSED(aTarget);
+    Q_UNUSED(aSize);
+    Q_UNUSED(aMethod);
+    Q_UNUSED(aOffset);
+    Q_UNUSED(aAborted);
+
+    // Set Error
+    aError = -1;
+
+    return false;
+
+#endif // Q_OS_UNIX
+}
+
+//==============================================================================
+// Check If Error Means The Method Is Not Supported
+//==============================================================================
+bool FileCopyEngine::methodNotSupported(const int& aError)
+{
+#if defined(Q_OS_UNIX)
+
+    // EXDEV - Different File Systems, ENOTTY/EOPNOTSUPP - No Reflink, ENOSYS - Old Kernel, EINVAL - File Type Or Flags
+    return aError == EXDEV || aError == ENOTTY || aError == EOPNOTSUPP || aError == ENOTSUP || aError == ENOSYS || aError == EINVAL;
+
+#else // Q_OS_UNIX
+
+    Q_UNUSED(aError);
+
+    return false;
+
+#endif // Q_OS_UNIX
+}
+
+//==============================================================================
+// Get Process CPU Time - msecs
+//==============================================================================
+qint64 FileCopyEngine::cpuTime()
+{
+#if defined(Q_OS_UNIX)
+
+    // Init Resource Usage
+    struct rusage usage;
+
+    // Get Resource Usage - Kernel Side Copies Are Counted As System Time
+    if (getrusage(RUSAGE_SELF, &usage) == 0) {
+        return (qint64)(usage.ru_utime.tv_sec + usage.ru_stime.tv_sec) * 1000 + (usage.ru_utime.tv_usec + usage.ru_stime.tv_usec) / 1000;
+    }
+
+#endif // Q_OS_UNIX
+
+    return 0;
+}
+
+//==============================================================================
+// Write Benchmark File
+//==============================================================================
+bool FileCopyEngine::writeBenchmarkFile(const QString& aFilePath, const qint64& aSize)
+{
+    // Init File
+    QFile file(aFilePath);
+
+    // Open File
+    if (!file.open(QIODevice::WriteOnly)) {
+        return false;
+    }
+
+    // Init Block
+    QByteArray block(qMin(aSize, (qint64)DEFAULT_FILE_COPY_BUFFER_SIZE), 0);
+
+    // Go Thru Block - Non Zero Content So Nothing Gets Stored Sparse
+    for (int i=0; i<block.size(); ++i) {
+        // Set Byte
+        block[i] = (char)(i * 31 + 7);
+    }
+
+    // Init Written
+    qint64 written = 0;
+
+    // Write Blocks
+    while (written < aSize) {
+        // Write Block
+        qint64 result = file.write(block.constData(), qMin(aSize - written, (qint64)block.size()));
+
+        // Check Result
+        if (result <= 0) {
+            return false;
+        }
+
+        // Inc Written
+        written += result;
+    }
+
+    return true;
+}
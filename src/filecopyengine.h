@@ -0,0 +1,66 @@
+#ifndef FILECOPYENGINE_H
+#define FILECOPYENGINE_H
+
+#include <QString>
+#include <QMutex>
+#include <QHash>
+#include <QAtomicInt>
+
+
+//==============================================================================
+// File Copy Method Type
+//==============================================================================
+enum FileCopyMethodType
+{
+    EFCMAuto        = -1,
+    EFCMReflink     = 0,
+    EFCMCopyRange,
+    EFCMSendFile,
+    EFCMReadWrite
+};
+
+
+//==============================================================================
+// File Copy Engine Class - Kernel Side Copies With Per Device Capability Cache
+//==============================================================================
+class FileCopyEngine
+{
+public:
+
+    // Copy File - Returns The Method Used Or -1 On Error, Existing Targets Fail Unless aOverwrite
+    static int copyFile(const QString& aSource, const QString& aTarget, const int& aMethod = EFCMAuto, const QAtomicInt* aAborted = NULL, const bool& aOverwrite = true);
+
+    // Method To String
+    static QString methodToString(const int& aMethod);
+
+    // Benchmark - Copies Large And Small Files With Each Method, Returns The Report
+    static QString benchmark(const QString& aSourceDirPath, const QString& aTargetDirPath);
+
+    // Get Process CPU Time - msecs
+    static qint64 cpuTime();
+
+protected:
+
+    // Get Preferred Method For Source And Target Device
+    static int preferredMethod(const quint64& aSourceDevice, const quint64& aTargetDevice);
+    // Set Preferred Method For Source And Target Device
+    static void setPreferredMethod(const quint64& aSourceDevice, const quint64& aTargetDevice, const int& aMethod);
+
+    // Copy Data - Returns false And Sets Error On Failure
+    static bool copyData(const int& aSource, const int& aTarget, const qint64& aSize, const int& aMethod, qint64& aOffset, const QAtomicInt* aAborted, int& aError);
+
+    // Check If Error Means The Method Is Not Supported
+    static bool methodNotSupported(const int& aError);
+
+    // Write Benchmark File
+    static bool writeBenchmarkFile(const QString& aFilePath, const qint64& aSize);
+
+protected:
+
+    // Capability Mutex
+    static QMutex               capabilityMutex;
+    // Preferred Methods By Source:Target Device
+    static QHash<QString, int>  capabilities;
+};
+
+#endif // FILECOPYENGINE_H
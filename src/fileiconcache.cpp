@@ -0,0 +1,192 @@
+#include <QMutexLocker>
+#include <QDir>
+#include <QDebug>
+
+#include "fileiconcache.h"
+#include "constants.h"
+
+
+// File Icon Cache Singleton
+static FileIconCache* fileIconCacheSingleton = NULL;
+// Singleton Mutex
+static QMutex fileIconCacheMutex;
+
+
+//==============================================================================
+// Get Instance - Static Constructor
+//==============================================================================
+FileIconCache* FileIconCache::getInstance()
+{
+    QMutexLocker locker(&fileIconCacheMutex);
+
+    // Check Singleton
+    if (!fileIconCacheSingleton) {
+        // Create Singleton
+        fileIconCacheSingleton = new FileIconCache();
+    } else {
+        // Inc Ref Count
+        fileIconCacheSingleton->refCount++;
+    }
+
+    return fileIconCacheSingleton;
+}
+
+//==============================================================================
+// Constructor
+//==============================================================================
+FileIconCache::FileIconCache()
+    : refCount(1)
+    , icons(DEFAULT_ICON_CACHE_MAX_COST)
+    , hits(0)
+    , misses(0)
+{
+}
+
+//==============================================================================
+// Release
+//==============================================================================
+void FileIconCache::release()
+{
+    QMutexLocker locker(&fileIconCacheMutex);
+
+    // Dec Ref Count
+    refCount--;
+
+    // Check Ref Count
+    if (refCount <= 0 && fileIconCacheSingleton) {
+        // Delete Singleton
+        delete fileIconCacheSingleton;
+        fileIconCacheSingleton = NULL;
+    }
+}
+
+//==============================================================================
+// Get Icon Key
+//==============================================================================
+QString FileIconCache::iconKey(const QFileInfo& aFileInfo, const QSize& aSize)
+{
+    // Init Key
+    QString key = QString("%1x%2:").arg(aSize.width()).arg(aSize.height());
+
+    // Check Symlink - Platforms May Add An Overlay
+    if (aFileInfo.isSymLink()) {
+        // Add Link Mark
+        key += QString("link:");
+    }
+
+    // Check If Is Dir
+    if (aFileInfo.isDir()) {
+        // Check Bundle Or Root - Own Icons
+        if (aFileInfo.isBundle() || aFileInfo.isRoot() || aFileInfo.absoluteFilePath() == QDir::homePath()) {
+            return key + QString("path:") + aFileInfo.absoluteFilePath();
+        }
+
+        return key + QString("dir");
+    }
+
+    // Check Executable - Icons May Be Embedded
+    if (aFileInfo.isExecutable()) {
+        return key + QString("path:") + aFileInfo.absoluteFilePath();
+    }
+
+#if defined(Q_OS_MACX)
+
+    // Check Suffix - Icon Files Are Their Own Icons
+    if (aFileInfo.suffix().toLower() == QString("icns")) {
+        return key + QString("path:") + aFileInfo.absoluteFilePath();
+    }
+
+#endif // Q_OS_MACX
+
+    return key + QString("mime:") + mimeType(aFileInfo);
+}
+
+//==============================================================================
+// Get MIME Type Name
+//==============================================================================
+QString FileIconCache::mimeType(const QFileInfo& aFileInfo)
+{
+    return mimeDB.mimeTypeForFile(aFileInfo.fileName(), QMimeDatabase::MatchExtension).name();
+}
+
+//==============================================================================
+// Find Icon
+//==============================================================================
+bool FileIconCache::find(const QString& aKey, QImage& aImage)
+{
+    QMutexLocker locker(&cacheMutex);
+
+    // Get Cached Image
+    QImage* cachedImage = icons.object(aKey);
+
+    // Check Cached Image
+    if (cachedImage) {
+        // Inc Hits
+        hits++;
+        // Set Image - Implicitly Shared
+        aImage = *cachedImage;
+    } else {
+        // Inc Misses
+        misses++;
+    }
+
+    // Check Lookups
+    if ((hits + misses) % DEFAULT_ICON_CACHE_STATS_INTERVAL == 0) {
+        qDebug() << "FileIconCache::find - hits: " << hits << " - misses: " << misses << " - hitRate: " << (hits * 100 / (hits + misses)) << "% - totalCost: " << icons.totalCost() << "KB";
+    }
+
+    return cachedImage != NULL;
+}
+
+//==============================================================================
+// Insert Icon
+//==============================================================================
+void FileIconCache::insert(const QString& aKey, const QImage& aImage)
+{
+    // Check Image
+    if (aImage.isNull()) {
+        return;
+    }
+
+    QMutexLocker locker(&cacheMutex);
+
+    // Insert Image - Cost In KB
+    icons.insert(aKey, new QImage(aImage), qMax(1, aImage.byteCount() / 1024));
+}
+
+//==============================================================================
+// Clear
+//==============================================================================
+void FileIconCache::clear()
+{
+    QMutexLocker locker(&cacheMutex);
+
+    // Clear Icons
+    icons.clear();
+}
+
+//==============================================================================
+// Get Hit Rate
+//==============================================================================
+int FileIconCache::hitRate()
+{
+    QMutexLocker locker(&cacheMutex);
+
+    // Check Lookups
+    if (hits + misses <= 0) {
+        return 0;
+    }
+
+    return (int)(hits * 100 / (hits + misses));
+}
+
+//==============================================================================
+// Destructor
+//==============================================================================
+FileIconCache::~FileIconCache()
+{
+    qDebug() << "FileIconCache::~FileIconCache - hits: " << hits << " - misses: " << misses;
+
+    // Clear Icons
+    icons.clear();
+}
@@ -0,0 +1,70 @@
+#ifndef FILEICONCACHE_H
+#define FILEICONCACHE_H
+
+#include <QString>
+#include <QImage>
+#include <QSize>
+#include <QCache>
+#include <QMutex>
+#include <QFileInfo>
+#include <QMimeDatabase>
+
+
+//==============================================================================
+// File Icon Cache Class - Shared By Image Providers, Keyed By MIME Type And Size
+//==============================================================================
+class FileIconCache
+{
+public:
+
+    // Get Instance - Static Constructor
+    static FileIconCache* getInstance();
+
+    // Release
+    void release();
+
+    // Get Icon Key - Per File Only Where Icons Are File Specific
+    QString iconKey(const QFileInfo& aFileInfo, const QSize& aSize);
+
+    // Get MIME Type Name - By Extension
+    QString mimeType(const QFileInfo& aFileInfo);
+
+    // Find Icon
+    bool find(const QString& aKey, QImage& aImage);
+    // Insert Icon
+    void insert(const QString& aKey, const QImage& aImage);
+
+    // Clear
+    void clear();
+
+    // Get Hit Rate - Percent
+    int hitRate();
+
+protected: // Constructor/Destructor
+
+    // Constructor
+    explicit FileIconCache();
+
+    // Destructor
+    virtual ~FileIconCache();
+
+protected:
+
+    // Int Ref Counter
+    int                     refCount;
+
+    // Cache Mutex
+    QMutex                  cacheMutex;
+    // Icons - Cost Is KB
+    QCache<QString, QImage> icons;
+
+    // MIME Database - Extension Matching Only, Never Reads Files
+    QMimeDatabase           mimeDB;
+
+    // Hits
+    qint64                  hits;
+    // Misses
+    qint64                  misses;
+};
+
+#endif // FILEICONCACHE_H
@@ -6,15 +6,40 @@
 
 #include "filelistimageprovider.h"
 #include "settingscontroller.h"
+#include "fileiconcache.h"
+#include "iconthemeindex.h"
 #include "utility.h"
 #include "defaultsettings.h"
 #include "constants.h"
 
+//==============================================================================
+// Constructor
+//==============================================================================
+FileIconImageResponse::FileIconImageResponse(FileListImageProvider* aProvider, const QString& aFilePath, const QSize& aRequestedSize)
+    : ScheduledImageResponse(aFilePath, aRequestedSize)
+    , provider(aProvider)
+{
+}
+
+//==============================================================================
+// Generate Image
+//==============================================================================
+QImage FileIconImageResponse::generateImage()
+{
+    return provider->iconImage(filePath);
+}
+
+
+
+
+
+
+
 //==============================================================================
 // Constructor
 //==============================================================================
 FileListImageProvider::FileListImageProvider()
-    : QQuickImageProvider(QQmlImageProviderBase::Image, QQmlImageProviderBase::ForceAsynchronousImageLoading)
+    : QQuickAsyncImageProvider()
     , iconWidth(DEFAULT_ICON_WIDTH_32)
     , iconHeight(DEFAULT_ICON_HEIGHT_32)
     , thumbWidth(DEFAULT_THUMB_WIDTH_300)
@@ -23,6 +48,9 @@ FileListImageProvider::FileListImageProvider()
     , settings(SettingsController::getInstance())
     , useDefaultIcons(DEAFULT_SETTINGS_USE_DEFAULT_ICONS)
     , settingsReciever(new SettingsReciever(this))
+    , iconCache(FileIconCache::getInstance())
+    , iconThemeIndex(IconThemeIndex::getInstance())
+    , requestScheduler(DEFAULT_ICON_REQUEST_THREADS)
 {
     // Get Supported Image Formats
     supportedFormats = QImageReader::supportedImageFormats();
@@ -51,15 +79,34 @@ SettingsReciever* FileListImageProvider::reciever()
 }
 
 //==============================================================================
-// Request Image
+// Get Scheduler
 //==============================================================================
-QImage FileListImageProvider::requestImage(const QString& aID, QSize* aSize, const QSize& aRequestedSize)
+ImageRequestScheduler* FileListImageProvider::scheduler()
 {
-    Q_UNUSED(aID);
-    Q_UNUSED(aSize);
-    Q_UNUSED(aRequestedSize);
+    return &requestScheduler;
+}
+
+//==============================================================================
+// Request Image Response
+//==============================================================================
+QQuickImageResponse* FileListImageProvider::requestImageResponse(const QString& aID, const QSize& aRequestedSize)
+{
+    //qDebug() << "FileListImageProvider::requestImageResponse - aID: " << aID << " - aRequestedSize: " << aRequestedSize;
+
+    // Create Response
+    FileIconImageResponse* response = new FileIconImageResponse(this, aID, aRequestedSize);
+
+    // Submit Response - Visible Rows First, Then Newest First
+    requestScheduler.submit(response);
+
+    return response;
+}
 
-    //qDebug() << "FileListImageProvider::requestImage - aID: " << aID << " - aRequestedSize: " << aRequestedSize;
+//==============================================================================
+// Get Icon Image
+//==============================================================================
+QImage FileListImageProvider::iconImage(const QString& aID)
+{
 
     // Init File Name
     QString fileName = aID;
@@ -83,25 +130,74 @@ QImage FileListImageProvider::requestImage(const QString& aID, QSize* aSize, con
     // Init File Info
     QFileInfo fileInfo(fileName);
 
+    // Init Image
+    QImage image;
+
     // Check Use Default Icons
     if (useDefaultIcons) {
-        // Check If Is Dir
-        if (fileInfo.isDir()) {
-            return QImage(DEFAULT_FILE_ICON_DIR);
+        // Get Default Icon Path
+        QString defaultIconPath = fileInfo.isDir() ? DEFAULT_FILE_ICON_DIR : DEFAULT_FILE_ICON_FILE;
+
+        // Find Default Icon
+        if (!iconCache->find(defaultIconPath, image)) {
+            // Load Default Icon
+            image = QImage(defaultIconPath);
+            // Insert Default Icon
+            iconCache->insert(defaultIconPath, image);
+        }
+
+        return image;
+    }
+
+    // Get Icon Key
+    QString iconKey = iconCache->iconKey(fileInfo, QSize(gridMode ? thumbHeight : iconWidth, gridMode ? thumbHeight : iconHeight));
+
+    // Find Icon - Most Rows Share Their Icon With Others
+    if (iconCache->find(iconKey, image)) {
+        return image;
+    }
+
+#if defined(Q_OS_LINUX)
+
+    // Check File - Dirs And Executables Keep Their Platform Icons
+    if (!fileInfo.isDir() && !fileInfo.isExecutable()) {
+        // Get Icon Path - Hash Probes Into The Prebuilt Theme Index
+        QString iconPath = iconThemeIndex->mimeIconPath(iconCache->mimeType(fileInfo), gridMode ? thumbHeight : iconWidth, gridMode ? thumbHeight : iconHeight);
+
+        // Check Icon Path
+        if (!iconPath.isEmpty()) {
+            // Init Image Reader
+            QImageReader imageReader(iconPath);
+            // Set Scaled Size - Scalable And Nearest Size Icons
+            imageReader.setScaledSize(QSize(gridMode ? thumbHeight : iconWidth, gridMode ? thumbHeight : iconHeight));
+            // Read Image - Null If The Theme Changed Since Indexing
+            image = imageReader.read();
         }
+    }
 
-        return QImage(DEFAULT_FILE_ICON_FILE);
+    // Check Image
+    if (image.isNull()) {
+        // Get File Icon Image
+        image = fileIconProvider.icon(fileInfo).pixmap(gridMode ? thumbHeight : iconWidth, gridMode ? thumbHeight : iconHeight).toImage();
     }
 
+#else // Q_OS_LINUX
+
     // Get File Icon Image
-    QImage image = fileIconProvider.icon(fileInfo).pixmap(gridMode ? thumbHeight : iconWidth, gridMode ? thumbHeight : iconHeight).toImage();
+    image = fileIconProvider.icon(fileInfo).pixmap(gridMode ? thumbHeight : iconWidth, gridMode ? thumbHeight : iconHeight).toImage();
+
+#endif // Q_OS_LINUX
 
     // Check Image
-    if (!image.isNull()) {
-        return image;
+    if (image.isNull()) {
+        // Set Default Image
+        image = QImage(DEFAULT_FILE_ICON_FILE);
     }
 
-    return QImage(DEFAULT_FILE_ICON_FILE);
+    // Insert Icon
+    iconCache->insert(iconKey, image);
+
+    return image;
 }
 
 //==============================================================================
@@ -109,6 +205,9 @@ QImage FileListImageProvider::requestImage(const QString& aID, QSize* aSize, con
 //==============================================================================
 FileListImageProvider::~FileListImageProvider()
 {
+    // Shutdown Scheduler - Responses Use The Provider
+    requestScheduler.shutdown();
+
     // Check Settings Reciever
     if (settingsReciever) {
         // Delete Settings Reciever
@@ -124,6 +223,22 @@ FileListImageProvider::~FileListImageProvider()
         // Reset Settings
         settings = NULL;
     }
+
+    // Check Icon Cache
+    if (iconCache) {
+        // Release
+        iconCache->release();
+        // Reset Icon Cache
+        iconCache = NULL;
+    }
+
+    // Check Icon Theme Index
+    if (iconThemeIndex) {
+        // Release
+        iconThemeIndex->release();
+        // Reset Icon Theme Index
+        iconThemeIndex = NULL;
+    }
 }
 
 
@@ -2,17 +2,46 @@
 #define FILELISTIMAGEPROVIDER_H
 
 #include <QObject>
-#include <QQuickImageProvider>
+#include <QQuickAsyncImageProvider>
 #include <QFileIconProvider>
 
+#include "imagerequestscheduler.h"
+
 class SettingsController;
 class SettingsReciever;
+class FileIconCache;
+class IconThemeIndex;
+class FileListImageProvider;
+
+
+//==============================================================================
+// File Icon Image Response Class
+//==============================================================================
+class FileIconImageResponse : public ScheduledImageResponse
+{
+public:
+    // Constructor
+    explicit FileIconImageResponse(FileListImageProvider* aProvider, const QString& aFilePath, const QSize& aRequestedSize);
+
+protected: // From ScheduledImageResponse
+
+    // Generate Image
+    virtual QImage generateImage();
+
+protected:
+
+    // Provider - Outlives Its Responses
+    FileListImageProvider*  provider;
+};
+
+
+
 
 
 //==============================================================================
 // File List Image Provider Class
 //==============================================================================
-class FileListImageProvider : public QQuickImageProvider
+class FileListImageProvider : public QQuickAsyncImageProvider
 {
 public:
     // Constructor
@@ -21,13 +50,19 @@ public:
     // Get Settings Reciever
     SettingsReciever* reciever();
 
+    // Get Scheduler
+    ImageRequestScheduler* scheduler();
+
+    // Get Icon Image - Scheduler Thread
+    QImage iconImage(const QString& aID);
+
     // Destructor
     virtual ~FileListImageProvider();
 
-protected: // From QQuickImageProvider
+public: // From QQuickAsyncImageProvider
 
-    // Request Image
-    virtual QImage requestImage(const QString& aID, QSize* aSize, const QSize& aRequestedSize);
+    // Request Image Response
+    virtual QQuickImageResponse* requestImageResponse(const QString& aID, const QSize& aRequestedSize);
 
 protected: // Data
     friend class SettingsReciever;
@@ -59,6 +94,15 @@ protected: // Data
 
     // File Icon Provider
     QFileIconProvider   fileIconProvider;
+
+    // File Icon Cache - Shared By Providers
+    FileIconCache*      iconCache;
+
+    // Icon Theme Index - MIME Icons On Linux
+    IconThemeIndex*     iconThemeIndex;
+
+    // Request Scheduler
+    ImageRequestScheduler requestScheduler;
 };
 
 
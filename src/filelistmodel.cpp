@@ -1,11 +1,18 @@
 #include <QDir>
 #include <QDateTime>
+#include <QTimer>
 #include <QDebug>
 
 #include <mcwinterface.h>
 
 #include "filelistmodel.h"
 #include "remotefileutilclient.h"
+#include "ownernamecache.h"
+#include "mimetypecache.h"
+#include "dirsizeindex.h"
+#include "filelistsnapshot.h"
+#include "filenamematcher.h"
+#include "fileselectionset.h"
 #include "utility.h"
 #include "defaultsettings.h"
 #include "constants.h"
@@ -18,7 +25,6 @@
 FileListModelItem::FileListModelItem(const QString& aPath, const QString& aFileName)
     : fileInfo(aPath + "/" + aFileName)
     , dirSize(0)
-    , selected(false)
     , searchResult(false)
 {
     // ...
@@ -29,7 +35,6 @@ FileListModelItem::FileListModelItem(const QString& aPath, const QString& aFileN
 //==============================================================================
 FileListModelItem::FileListModelItem(const QString& aPath, const qint64& aSize, const QDateTime& aDate, const QString& aAttrs, const bool& aIsDir, const bool& aIsLink)
     : dirSize(0)
-    , selected(false)
     , searchResult(false)
 {
     // Set Up Archive File Info
@@ -48,6 +53,67 @@ FileListModelItem::FileListModelItem(const QString& aPath, const qint64& aSize,
 
 
 
+//==============================================================================
+// Constructor
+//==============================================================================
+FileListSelection::FileListSelection(const FileListModel* aModel, const FileSelectionSet& aRows)
+    : model(aModel)
+    , rows(aRows)
+    , rowsCount(aRows.count())
+{
+}
+
+//==============================================================================
+// Get Count
+//==============================================================================
+int FileListSelection::count() const
+{
+    return rowsCount;
+}
+
+//==============================================================================
+// Is Empty
+//==============================================================================
+bool FileListSelection::isEmpty() const
+{
+    return rowsCount == 0;
+}
+
+//==============================================================================
+// Get First Selected Row
+//==============================================================================
+int FileListSelection::first() const
+{
+    return rows.nextSetBit(0);
+}
+
+//==============================================================================
+// Get Next Selected Row
+//==============================================================================
+int FileListSelection::next(const int& aRow) const
+{
+    return rows.nextSetBit(aRow + 1);
+}
+
+//==============================================================================
+// Get File Path For Row
+//==============================================================================
+QString FileListSelection::filePath(const int& aRow) const
+{
+    // Check Model & Row
+    if (model && aRow >= 0 && aRow < model->itemList.count()) {
+        return model->itemList[aRow]->fileInfo.absoluteFilePath();
+    }
+
+    return QString("");
+}
+
+
+
+
+
+
+
 //==============================================================================
 // Constructor
 //==============================================================================
@@ -56,6 +122,10 @@ FileListModel::FileListModel(QObject* aParent)
     , currentDir("")
     , prevCurrentDir("")
     , fileUtil(NULL)
+    , ownerNames(OwnerNameCache::getInstance())
+    , mimeTypes(MimeTypeCache::getInstance())
+    , fileTypesRefreshPending(false)
+    , dirSizeIndex(DirSizeIndex::getInstance())
     , sorting(0)
     , reverseOrder(false)
     , showHiddenFiles(false)
@@ -65,6 +135,7 @@ FileListModel::FileListModel(QObject* aParent)
     , fetchOnConnection(false)
     , archiveMode(false)
     , archivePath("")
+    , snapshotDir("")
 {
     //qDebug() << "FileListModel::FileListModel";
 
@@ -96,6 +167,11 @@ void FileListModel::init()
     connect(fileUtil, SIGNAL(fileOpError(uint,QString,QString,QString,QString,int)), this, SLOT(fileOpError(uint,QString,QString,QString,QString,int)));
     connect(fileUtil, SIGNAL(archiveListItemFound(uint,QString,QString,qint64,QDateTime,QString,bool,bool)), this, SLOT(archiveListItemFound(uint,QString,QString,qint64,QDateTime,QString,bool,bool)));
 
+    // Connect Owner Name Cache Signals
+    connect(ownerNames, SIGNAL(userNameResolved(uint,QString)), this, SLOT(ownerNameResolved(uint,QString)));
+    // Connect Mime Type Cache Signals
+    connect(mimeTypes, SIGNAL(mimeTypeResolved(QString,QString)), this, SLOT(mimeTypeResolved(QString,QString)));
+
     // Connect To File Server
     fileUtil->connectToFileServer();
 
@@ -319,6 +395,69 @@ void FileListModel::setSelectedCount(const int& aSelectedCount)
     }
 }
 
+//==============================================================================
+// Owner Name Resolved Slot
+//==============================================================================
+void FileListModel::ownerNameResolved(const uint& aUID, const QString& aUserName)
+{
+    Q_UNUSED(aUID);
+    Q_UNUSED(aUserName);
+
+    // Check Item List
+    if (itemList.count() <= 0) {
+        return;
+    }
+
+    // Init Roles
+    QVector<int> roles;
+    // Add Owner Role
+    roles << FileOwner;
+
+    // Emit Data Changed Signal For All Rows - Owner Column Only
+    emit dataChanged(createIndex(0, 0), createIndex(itemList.count() - 1, 0), roles);
+}
+
+//==============================================================================
+// Mime Type Resolved Slot
+//==============================================================================
+void FileListModel::mimeTypeResolved(const QString& aFilePath, const QString& aMimeType)
+{
+    Q_UNUSED(aMimeType);
+
+    // Check Path - Ignore Results For Other Dirs
+    if (!aFilePath.startsWith(currentDir) || fileTypesRefreshPending) {
+        return;
+    }
+
+    // Set File Types Refresh Pending
+    fileTypesRefreshPending = true;
+
+    // Coalesce Results Of A Whole Listing Into One Update
+    QTimer::singleShot(DEFAULT_MIME_TYPE_REFRESH_DELAY, this, SLOT(refreshFileTypes()));
+}
+
+//==============================================================================
+// Refresh File Types
+//==============================================================================
+void FileListModel::refreshFileTypes()
+{
+    // Reset File Types Refresh Pending
+    fileTypesRefreshPending = false;
+
+    // Check Item List
+    if (itemList.count() <= 0) {
+        return;
+    }
+
+    // Init Roles
+    QVector<int> roles;
+    // Add Type Role
+    roles << FileType;
+
+    // Emit Data Changed Signal For All Rows - Type Column Only
+    emit dataChanged(createIndex(0, 0), createIndex(itemList.count() - 1, 0), roles);
+}
+
 //==============================================================================
 // Get Selected Files Count
 //==============================================================================
@@ -401,6 +540,9 @@ int FileListModel::calculateIndex(const QFileInfo& aItem)
 //==============================================================================
 void FileListModel::appendItem(const QString& aFilePath, const bool& aSearchResult)
 {
+    // Clear Quick Filter
+    clearQuickFilter();
+
     // Init File Info
     QFileInfo fileInfo(aFilePath);
 
@@ -409,6 +551,9 @@ void FileListModel::appendItem(const QString& aFilePath, const bool& aSearchResu
     // Set Search Result
     newItem->searchResult = aSearchResult;
 
+    // Insert Into Selection Sets
+    insertSelectionRow(rowCount(), newItem);
+
     // Begin Insert Row
     beginInsertRows(QModelIndex(), rowCount(), rowCount());
 
@@ -430,6 +575,14 @@ void FileListModel::appendItem(const QString& aFilePath, const bool& aSearchResu
 //==============================================================================
 void FileListModel::insertItem(const int& aIndex, const QString& aFilePath, const bool& aSearchResult)
 {
+    // Check Quick Filter
+    if (!quickFilter.isEmpty()) {
+        // Clear Quick Filter & Insert At Unfiltered Row
+        insertItem(clearQuickFilter(aIndex), aFilePath, aSearchResult);
+
+        return;
+    }
+
     // Init File Info
     QFileInfo fileInfo(aFilePath);
 
@@ -438,6 +591,9 @@ void FileListModel::insertItem(const int& aIndex, const QString& aFilePath, cons
     // Set Search Result
     newItem->searchResult = aSearchResult;
 
+    // Insert Into Selection Sets
+    insertSelectionRow(aIndex, newItem);
+
     // Begin Insert Row
     beginInsertRows(QModelIndex(), aIndex, aIndex);
 
@@ -459,6 +615,9 @@ void FileListModel::insertItem(const int& aIndex, const QString& aFilePath, cons
 //==============================================================================
 void FileListModel::addItem(const QString& aFilePath, const bool& aSearchResult)
 {
+    // Clear Quick Filter
+    clearQuickFilter();
+
     // Init New File Info
     QFileInfo newFileInfo(aFilePath);
 
@@ -479,6 +638,9 @@ void FileListModel::addItem(const QString& aFilePath, const bool& aSearchResult)
         insertIndex++;
     }
 
+    // Insert Into Selection Sets
+    insertSelectionRow(insertIndex, newItem);
+
     // Begin Insert Row
     beginInsertRows(QModelIndex(), insertIndex, insertIndex);
 
@@ -500,6 +662,14 @@ void FileListModel::addItem(const QString& aFilePath, const bool& aSearchResult)
 //==============================================================================
 void FileListModel::removeItem(const int& aIndex)
 {
+    // Check Quick Filter
+    if (!quickFilter.isEmpty()) {
+        // Clear Quick Filter & Remove Unfiltered Row
+        removeItem(clearQuickFilter(aIndex));
+
+        return;
+    }
+
     // Check Index
     if (aIndex >= 0 && aIndex < rowCount()) {
         // Get Item
@@ -510,8 +680,20 @@ void FileListModel::removeItem(const int& aIndex)
 
         itemList.removeAt(aIndex);
 
+        // Get Removed Selected
+        bool removedSelected = selection.test(aIndex);
+        // Remove From Selection Sets
+        selection.remove(aIndex);
+        unselectable.remove(aIndex);
+
         // End REmove Rows
         endRemoveRows();
+
+        // Check Removed Selected
+        if (removedSelected) {
+            // Update Selected Count
+            setSelectedCount(selection.count());
+        }
         // Get Name Index
         int nameIndex = fileNameList.indexOf(item->fileInfo.fileName());
         // Check Index
@@ -534,16 +716,25 @@ void FileListModel::removeItem(const int& aIndex)
 //==============================================================================
 void FileListModel::clear()
 {
+    // Reset Snapshot Dir
+    snapshotDir = "";
+
     // Check Item List
-    if (itemList.count() <= 0) {
+    if (itemList.count() <= 0 && allItems.count() <= 0) {
         return;
     }
 
     //qDebug() << "FileListModel::clear";
 
+    // Get Quick Filter Active
+    bool filtered = !quickFilter.isEmpty();
+
     // Begin Reset Model
     beginResetModel();
 
+    // Restore Unfiltered Items - Filtered List Doesn't Own All Items
+    restoreFilteredItems();
+
     // Go Thru File Info List
     while (itemList.count() > 0) {
         // Get File Info List Item
@@ -556,6 +747,10 @@ void FileListModel::clear()
         }
     }
 
+    // Clear Selection Sets
+    selection.clear();
+    unselectable.clear();
+
     // End Reset Model
     endResetModel();
 
@@ -564,9 +759,17 @@ void FileListModel::clear()
 
     // Clear File Name List
     fileNameList.clear();
+    // Clear Stale Indexed Dirs
+    staleIndexedDirs.clear();
 
     // Reset Selected Count
     setSelectedCount(0);
+
+    // Check Quick Filter Active
+    if (filtered) {
+        // Emit Quick Filter Changed Signal
+        emit quickFilterChanged(quickFilter);
+    }
 }
 
 //==============================================================================
@@ -576,8 +779,11 @@ void FileListModel::reload()
 {
     //qDebug() << "FileListModel::reload";
 
-    // Clear
-    clear();
+    // Check Snapshot Dir - Keep Showing The Snapshot Until Fresh Items Arrive
+    if (archiveMode || snapshotDir != currentDir) {
+        // Clear
+        clear();
+    }
 
     // Check Archive Mode
     if (archiveMode) {
@@ -596,7 +802,7 @@ bool FileListModel::getSelected(const int& aIndex)
 {
     // Check Index
     if (aIndex >= 0 && aIndex < itemList.count()) {
-        return itemList[aIndex]->selected;
+        return selection.test(aIndex);
     }
 
     return false;
@@ -609,23 +815,21 @@ bool FileListModel::setSelected(const int& aIndex, const bool& aSelected)
 {
     // Check Index
     if (aIndex >= 0 && aIndex < itemList.count()) {
-        // Check File Name
-        if (itemList[aIndex]->fileInfo.fileName() == "." || itemList[aIndex]->fileInfo.fileName() == "..") {
+        // Check If Selectable
+        if (unselectable.test(aIndex)) {
             // Skip
             return false;
         }
 
-        // Check If Item Selected
-        if (itemList[aIndex]->selected != aSelected) {
+        // Set Selected - Returns False If Unchanged
+        if (selection.set(aIndex, aSelected)) {
             //qDebug() << "FileListModel::setSelected - aIndex: " << aIndex << " - aSelected: " << aSelected;
-            // Set Item Selected
-            itemList[aIndex]->selected = aSelected;
             // Create Model Index
             QModelIndex index = createIndex(aIndex, 0);
             // Emit Data Changed Signal
             emit dataChanged(index, index);
             // Check Selected
-            if (itemList[aIndex]->selected) {
+            if (aSelected) {
                 // Inc Selected Count
                 selectedCount++;
             } else {
@@ -634,7 +838,7 @@ bool FileListModel::setSelected(const int& aIndex, const bool& aSelected)
             }
 
             // Emit File Selection Changed Signal
-            emit fileSelectionChanged(aIndex, itemList[aIndex]->selected);
+            emit fileSelectionChanged(aIndex, aSelected);
 
             // Emit Selected Count Changed Signal
             emit selectedCountChanged(selectedCount);
@@ -653,30 +857,18 @@ void FileListModel::selectAll()
 {
     //qDebug() << "FileListModel::selectAll";
 
-    // Get Item List Count
-    int ilCount = itemList.count();
-    // Reset Selected Count
-    selectedCount = 0;
-    // Go Thru Item List
-    for (int i = 0; i < ilCount; ++i) {
-        // Check File Name
-        if (itemList[i]->fileInfo.fileName() != QString("..") && itemList[i]->fileInfo.fileName() != QString(".")) {
-            // Check Selected
-            if (!itemList[i]->selected) {
-                // Set Item Selected
-                itemList[i]->selected = true;
-                // Create Model Index
-                QModelIndex index = createIndex(i, 0);
-                // Emit Data Changed Signal
-                emit dataChanged(index, index);
-                // Inc Selected Count
-                selectedCount++;
-            }
-        }
-    }
+    // Set All Bits
+    selection.fill(true);
+    // Clear Unselectable Rows
+    selection.subtract(unselectable);
+
+    // Init Changed Range
+    int first = 0, last = itemList.count() - 1;
+    // Emit Range
+    emitSelectionRange(first, last);
 
-    // Emit Selected Count Changed Signal
-    emit selectedCountChanged(selectedCount);
+    // Set Selected Count
+    setSelectedCount(selection.count());
 }
 
 //==============================================================================
@@ -686,19 +878,14 @@ void FileListModel::deselectAll()
 {
     //qDebug() << "FileListModel::deselectAll";
 
-    // Get Item List Count
-    int ilCount = itemList.count();
-    // Go Thru Item List
-    for (int i = 0; i < ilCount; ++i) {
-        // Check Selected
-        if (itemList[i]->selected) {
-            // Set Item Selected
-            itemList[i]->selected = false;
-            // Create Model Index
-            QModelIndex index = createIndex(i, 0);
-            // Emit Data Changed Signal
-            emit dataChanged(index, index);
-        }
+    // Check Selection
+    if (selection.any()) {
+        // Get Changed Range
+        int first = selection.nextSetBit(0), last = itemList.count() - 1;
+        // Clear All Bits
+        selection.fill(false);
+        // Emit Range
+        emitSelectionRange(first, last);
     }
 
     // Reset Selected Count
@@ -712,36 +899,24 @@ void FileListModel::toggleAllSelection()
 {
     //qDebug() << "FileListModel::toggleAllSelection";
 
-    // Get Item List Count
-    int ilCount = itemList.count();
-    // Reset Selected Count
-    selectedCount = 0;
-    // Go Thru Item List
-    for (int i = 0; i < ilCount; ++i) {
-        // Check File Name
-        if (itemList[i]->fileInfo.fileName() != QString("..") && itemList[i]->fileInfo.fileName() != QString(".")) {
-            // Set Item Selected
-            itemList[i]->selected = !itemList[i]->selected;
-            // Check If Selected
-            if (itemList[i]->selected) {
-                // Inc Selected Count
-                selectedCount++;
-            }
-            // Create Model Index
-            QModelIndex index = createIndex(i, 0);
-            // Emit Data Changed Signal
-            emit dataChanged(index, index);
-        }
-    }
+    // Invert All Bits
+    selection.invert();
+    // Clear Unselectable Rows
+    selection.subtract(unselectable);
+
+    // Init Changed Range
+    int first = 0, last = itemList.count() - 1;
+    // Emit Range
+    emitSelectionRange(first, last);
 
-    // Emit Selected Count Changed Signal
-    emit selectedCountChanged(selectedCount);
+    // Set Selected Count
+    setSelectedCount(selection.count());
 }
 
 //==============================================================================
 // Select Files
 //==============================================================================
-void FileListModel::selectFiles(const QString& aPattern)
+void FileListModel::selectFiles(const QString& aPattern, const bool& aCaseSensitive)
 {
     // Check Pattern
     if (aPattern == "*.*") {
@@ -753,40 +928,14 @@ void FileListModel::selectFiles(const QString& aPattern)
 
     //qDebug() << "FileListModel::selectFiles - aPattern: " << aPattern;
 
-    // Get Item List Count
-    int ilCount = itemList.count();
-    // Reset Selected Count
-    selectedCount = 0;
-    // Init Dir
-    QDir dir(QDir::homePath());
-    // Go Thru Item List
-    for (int i = 0; i < ilCount; ++i) {
-        // Get Item
-        FileListModelItem* item = itemList[i];
-        // Check File Name
-        if (item->fileInfo.fileName() != QString("..") && item->fileInfo.fileName() != QString(".")) {
-            // Check If Pattern Match
-            if (dir.match(aPattern, item->fileInfo.fileName())) {
-                // Set Item Selected
-                item->selected = true;
-                // Create Model Index
-                QModelIndex index = createIndex(i, 0);
-                // Emit Data Changed Signal
-                emit dataChanged(index, index);
-                // Inc Selected Count
-                selectedCount++;
-            }
-        }
-    }
-
-    // Emit Selected Count Changed Signal
-    emit selectedCountChanged(selectedCount);
+    // Set Selection By Pattern
+    setSelectionByPattern(aPattern, true, aCaseSensitive);
 }
 
 //==============================================================================
 // Deselect Files
 //==============================================================================
-void FileListModel::deselectFiles(const QString& aPattern)
+void FileListModel::deselectFiles(const QString& aPattern, const bool& aCaseSensitive)
 {
     // Check Pattern
     if (aPattern == "*.*") {
@@ -798,85 +947,129 @@ void FileListModel::deselectFiles(const QString& aPattern)
 
     //qDebug() << "FileListModel::deselectFiles - aPattern: " << aPattern;
 
+    // Set Selection By Pattern
+    setSelectionByPattern(aPattern, false, aCaseSensitive);
+}
+
+//==============================================================================
+// Set Selection By Pattern
+//==============================================================================
+void FileListModel::setSelectionByPattern(const QString& aPattern, const bool& aSelected, const bool& aCaseSensitive)
+{
+    // Init Matcher - Compiled Once For All Rows
+    FileNameMatcher matcher(aPattern, aCaseSensitive ? Qt::CaseSensitive : Qt::CaseInsensitive);
+
     // Get Item List Count
     int ilCount = itemList.count();
-    // Reset Selected Count
-    selectedCount = 0;
-    // Init Dir
-    QDir dir(QDir::homePath());
+    // Init Changed Range
+    int first = -1, last = -1;
     // Go Thru Item List
     for (int i = 0; i < ilCount; ++i) {
-        // Get Item
-        FileListModelItem* item = itemList[i];
-        // Check File Name
-        if (item->fileInfo.fileName() != QString("..") && item->fileInfo.fileName() != QString(".")) {
+        // Check If Selection Differs And Selectable
+        if (selection.test(i) != aSelected && !unselectable.test(i)) {
             // Check If Pattern Match
-            if (dir.match(aPattern, item->fileInfo.fileName())) {
+            if (matcher.match(itemList[i]->fileInfo.fileName())) {
                 // Set Item Selected
-                item->selected = false;
-                // Create Model Index
-                QModelIndex index = createIndex(i, 0);
-                // Emit Data Changed Signal
-                emit dataChanged(index, index);
-            }
-
-            // Check If Item Selected
-            if (item->selected) {
-                // Inc Selected Count
-                selectedCount++;
+                selection.set(i, aSelected);
+                // Add Selection Change
+                addSelectionChange(i, first, last);
             }
         }
     }
 
-    // Emit Selected Count Changed Signal
-    emit selectedCountChanged(selectedCount);
+    // Emit Last Range
+    emitSelectionRange(first, last);
+
+    // Set Selected Count
+    setSelectedCount(selection.count());
 }
 
 //==============================================================================
-// Get All Selected Files
+// Add Row To Changed Selection Range
 //==============================================================================
-QStringList FileListModel::getAllSelected()
+void FileListModel::addSelectionChange(const int& aRow, int& aFirst, int& aLast)
 {
-    // Init Result
-    QStringList result;
+    // Check If Contiguous
+    if (aFirst >= 0 && aRow == aLast + 1) {
+        // Extend Range
+        aLast = aRow;
 
-    // Get Item List Count
-    int ilCount = itemList.count();
-    // Go Thru Item List
-    for (int i = 0; i < ilCount; ++i) {
-        // Check Selected
-        if (itemList[i]->selected && itemList[i]->fileInfo.fileName() != "." && itemList[i]->fileInfo.fileName() != "..") {
-            // Add File Name To Result
-            //result << itemList[i]->fileInfo.fileName();
-            result << itemList[i]->fileInfo.absoluteFilePath();
-        }
+        return;
     }
 
-    return result;
+    // Emit Previous Range
+    emitSelectionRange(aFirst, aLast);
+
+    // Start New Range
+    aFirst = aLast = aRow;
 }
 
 //==============================================================================
-// Find Next Selected Index
+// Emit Selection Changed For Range
 //==============================================================================
-int FileListModel::findNextSelected(const int& aIndex)
+void FileListModel::emitSelectionRange(int& aFirst, int& aLast)
 {
-    // Chekc If Has Selection
-    if (!hasSelection()) {
-        return -1;
+    // Check Range
+    if (aFirst < 0 || aLast < aFirst) {
+        return;
     }
 
-    // Get Item List Count
-    int ilCount = itemList.count();
+    // Init Roles
+    QVector<int> roles;
+    // Add Selected Role
+    roles << FileSelected;
 
-    // Iterate Thru Items
-    for (int i = aIndex; i< ilCount; ++i) {
-        // Check Selected
-        if (itemList[i]->selected) {
-            return i;
-        }
+    // Emit Data Changed Signal
+    emit dataChanged(createIndex(aFirst, 0), createIndex(aLast, 0), roles);
+
+    // Reset Range
+    aFirst = aLast = -1;
+}
+
+//==============================================================================
+// Is Item Selectable
+//==============================================================================
+bool FileListModel::isSelectable(FileListModelItem* aItem)
+{
+    return aItem && aItem->fileInfo.fileName() != QString("..") && aItem->fileInfo.fileName() != QString(".");
+}
+
+//==============================================================================
+// Insert Item Into Selection Sets
+//==============================================================================
+void FileListModel::insertSelectionRow(const int& aRow, FileListModelItem* aItem)
+{
+    // Insert Into Selection
+    selection.insert(aRow, false);
+    // Insert Into Unselectable
+    unselectable.insert(aRow, !isSelectable(aItem));
+}
+
+//==============================================================================
+// Get Selection - Lazy Selected Paths View
+//==============================================================================
+FileListSelection FileListModel::getSelection(const int& aCurrentIndex) const
+{
+    // Check Selected Count & Current Index - '.' And '..' Are Never Used
+    if (selectedCount > 0 || aCurrentIndex < 0 || aCurrentIndex >= itemList.count() || unselectable.test(aCurrentIndex)) {
+        return FileListSelection(this, selection);
     }
 
-    return -1;
+    // Init Current Row - Copy Of The Empty Selection, Sized For The Listing
+    FileSelectionSet currentRow(selection);
+    // Set Current Row
+    currentRow.set(aCurrentIndex, true);
+
+    return FileListSelection(this, currentRow);
+}
+
+//==============================================================================
+// Find Next Selected Index
+//==============================================================================
+int FileListModel::findNextSelected(const int& aIndex)
+{
+    // Find Next Set Bit - Skips Empty Words
+    return selection.nextSetBit(aIndex);
 }
 
 //==============================================================================
@@ -982,7 +1175,29 @@ void FileListModel::fetchDirItems()
     //qDebug() << "FileListModel::fetchDirItems - currentDir: " << currentDir;
 
     // Init Filters
-    int filters = showHiddenFiles ? DEFAULT_FILTER_SHOW_HIDDEN : 0;
+    int filters = listFilters();
+    // Init Sort Flags
+    int sortFlags = listSortFlags();
+
+    // ...
+
+    // Fetch Dir Items
+    fileUtil->getDirList(currentDir, filters, sortFlags);
+}
+
+//==============================================================================
+// Get List Filters
+//==============================================================================
+int FileListModel::listFilters()
+{
+    return showHiddenFiles ? DEFAULT_FILTER_SHOW_HIDDEN : 0;
+}
+
+//==============================================================================
+// Get List Sort Flags
+//==============================================================================
+int FileListModel::listSortFlags()
+{
     // Init Sort Flags
     int sortFlags = showDirsFirst ? DEFAULT_SORT_DIRFIRST : 0;
 
@@ -1001,10 +1216,7 @@ void FileListModel::fetchDirItems()
         sortFlags |= DEFAULT_SORT_CASE;
     }
 
-    // ...
-
-    // Fetch Dir Items
-    fileUtil->getDirList(currentDir, filters, sortFlags);
+    return sortFlags;
 }
 
 //==============================================================================
@@ -1019,24 +1231,9 @@ void FileListModel::fetchArchiveDirItems()
     }
 
     // Init Filters
-    int filters = showHiddenFiles ? DEFAULT_FILTER_SHOW_HIDDEN : 0;
+    int filters = listFilters();
     // Init Sort Flags
-    int sortFlags = showDirsFirst ? DEFAULT_SORT_DIRFIRST : 0;
-
-    // Adding Sorting Method
-    sortFlags |= sorting;
-
-    // Check Reverse Order
-    if (reverseOrder) {
-        // Adjust Sort Flags
-        sortFlags |= DEFAULT_SORT_REVERSE;
-    }
-
-    // Check Case Sensitve Sorting
-    if (caseSensitiveSort) {
-        // Adjust Sort Flags
-        sortFlags |= DEFAULT_SORT_CASE;
-    }
+    int sortFlags = listSortFlags();
 
     // ...
 
@@ -1118,6 +1315,8 @@ void FileListModel::fileOpFinished(const unsigned int& aID,
 
     // Check Operation
     if (aOp == DEFAULT_OPERATION_LIST_DIR) {
+        // Drop Snapshot - Dir Became Empty
+        dropSnapshot();
         // Emit Dir Fetch Finished Signal
         emit dirFetchFinished();
 
@@ -1208,6 +1407,12 @@ void FileListModel::fileOpError(const unsigned int& aID,
 
     qDebug() << "FileListModel::fileOpError - aID: " << aID << " - aOp: " << aOp << " - aPath: " << aPath << " - aSource: " << aSource << " - aTarget: " << aTarget << " - aError: " << aError;
 
+    // Check Operation
+    if (aOp == DEFAULT_OPERATION_LIST_DIR) {
+        // Drop Snapshot - Don't Leave A Stale Listing
+        dropSnapshot();
+    }
+
     // Emit Error Signal
     emit error(aPath, aSource, aTarget, aError);
 
@@ -1232,6 +1437,9 @@ void FileListModel::dirListItemFound(const unsigned int& aID,
         return;
     }
 
+    // Drop Snapshot - Fresh Listing Replaces It
+    dropSnapshot();
+
     // Check File Name
     if (fileNameList.indexOf(aFileName) >= 0) {
         qWarning() << "FileListModel::dirListItemFound - aID: " << aID << " - aFileName: " << aFileName << " - DUPLICATE ITEM!!";
@@ -1240,9 +1448,32 @@ void FileListModel::dirListItemFound(const unsigned int& aID,
 
     // ...
 
+    // Clear Quick Filter - Items Still Arriving
+    clearQuickFilter();
+
     // Create New File List Item
     FileListModelItem* newItem = new FileListModelItem(aPath, aFileName);
 
+    // Check If Dir
+    if (dirSizeIndex && newItem->fileInfo.isDir() && !newItem->fileInfo.isSymLink() && aFileName != QString("..")) {
+        // Get Dir Path
+        QString dirPath = newItem->fileInfo.absoluteFilePath();
+        // Init Index Item
+        DirSizeIndexItem indexItem;
+
+        // Lookup Dir Size Index
+        if (dirSizeIndex->lookup(dirPath, newItem->fileInfo.lastModified().toMSecsSinceEpoch() / 1000, indexItem)) {
+            // Set Dir Size
+            newItem->dirSize = indexItem.size;
+        } else if (dirSizeIndex->contains(dirPath)) {
+            // Add Stale Indexed Dir
+            staleIndexedDirs << dirPath;
+        }
+    }
+
+    // Insert Into Selection Sets
+    insertSelectionRow(rowCount(), newItem);
+
     // Begin Insert Row
     beginInsertRows(QModelIndex(), rowCount(), rowCount());
 
@@ -1315,9 +1546,15 @@ void FileListModel::archiveListItemFound(const unsigned int& aID,
     //qDebug() << "FileListModel::archiveListItemFound - aID: " << aID << " - aArchive: " << aArchive << " - aFilePath: " << aFilePath << " - aSize: " << aSize;
 
 
+    // Clear Quick Filter - Items Still Arriving
+    clearQuickFilter();
+
     // Create New File List Item
     FileListModelItem* newItem = new FileListModelItem(aFilePath, aSize, aDate, aAttribs, aIsDir, aIsLink);
 
+    // Insert Into Selection Sets
+    insertSelectionRow(rowCount(), newItem);
+
     // Begin Insert Row
     beginInsertRows(QModelIndex(), rowCount(), rowCount());
 
@@ -1448,7 +1685,7 @@ QVariant FileListModel::data(const QModelIndex& aIndex, int aRole) const
                 case FileDateTime:      return formatDateTime(item->archiveFileInfo.fileDate);
                 case FileAttributes:
                 case FilePerms:         return item->archiveFileInfo.fileAttribs;
-                case FileSelected:      return item->selected;
+                case FileSelected:      return selection.test(aIndex.row());
                 case FileFullName:      return item->archiveFileInfo.fileName;
                 case FileIsHidden:      return false;
                 case FileIsLink:        return item->archiveFileInfo.fileIsLink;
@@ -1503,7 +1740,13 @@ QVariant FileListModel::data(const QModelIndex& aIndex, int aRole) const
                 } break;
 
                 case FileType: {
-                    return QString("");
+                    // Check File Info
+                    if (item->fileInfo.isDir() || item->fileInfo.fileName() == QString("..")) {
+                        return QString("");
+                    }
+
+                    // Get Mime Type Comment - Filled In Asynchronously
+                    return mimeTypes->mimeComment(item->fileInfo);
                 } break;
 
                 case FileAttributes: {
@@ -1527,9 +1770,9 @@ QVariant FileListModel::data(const QModelIndex& aIndex, int aRole) const
                 } break;
 
                 case FileDateTime:      return formatDateTime(item->fileInfo.lastModified());
-                case FileOwner:         return item->fileInfo.owner();
+                case FileOwner:         return ownerNames->userName(item->fileInfo.ownerId());
                 case FilePerms:         return getPermsText(item->fileInfo);
-                case FileSelected:      return item->selected;
+                case FileSelected:      return selection.test(aIndex.row());
                 case FileSearchResult:  return item->searchResult;
                 case FileFullName:      return item->fileInfo.fileName();
                 case FileIsHidden:      return (item->fileInfo.fileName() == QString("..") ? false : item->fileInfo.isHidden());
@@ -1597,7 +1840,10 @@ bool FileListModel::setData(const QModelIndex& aIndex, const QVariant& aValue, i
                 // Check Item
                 if (item && item->fileInfo.fileName() != QString("..") && item->fileInfo.fileName() != QString(".")) {
                     // Set Selected
-                    item->selected = aValue.toBool();
+                    if (selection.set(aIndex.row(), aValue.toBool())) {
+                        // Update Selected Count
+                        setSelectedCount(selection.count());
+                    }
                     // Emit Data Changed Signal
                     emit dataChanged(aIndex, aIndex);
 
@@ -1666,6 +1912,9 @@ int FileListModel::findIndex(const QString& aFileName)
 //==============================================================================
 void FileListModel::insertDirItem(const QString& aFileName)
 {
+    // Clear Quick Filter
+    clearQuickFilter();
+
     // Check File Name
     if (fileNameList.indexOf(aFileName) >= 0) {
         qWarning() << "FileListModel::insertItem - aFileName: " << aFileName << " - DUPLICATE ITEM!!";
@@ -1699,6 +1948,9 @@ void FileListModel::insertDirItem(const QString& aFileName)
 
     // Insert Item
 
+    // Insert Into Selection Sets
+    insertSelectionRow(i, newItem);
+
     // Begin Insert Row
     beginInsertRows(QModelIndex(), i, i);
 
@@ -1799,6 +2051,140 @@ void FileListModel::updateDirSize(const int& aIndex, const quint64& aSize)
     }
 }
 
+//==============================================================================
+// Take Stale Indexed Dirs
+//==============================================================================
+QStringList FileListModel::takeStaleIndexedDirs()
+{
+    // Get Stale Indexed Dirs
+    QStringList result = staleIndexedDirs;
+    // Clear Stale Indexed Dirs
+    staleIndexedDirs.clear();
+
+    return result;
+}
+
+//==============================================================================
+// Save Listing Snapshot
+//==============================================================================
+bool FileListModel::saveSnapshot(const QString& aFilePath)
+{
+    // Get Items - Unfiltered
+    const QList<FileListModelItem*>& items = quickFilter.isEmpty() ? itemList : allItems;
+    // Get Items Count
+    int iCount = items.count();
+
+    // Check Snapshot Dir - Still Showing The Loaded Snapshot, Keep It
+    if (!snapshotDir.isEmpty() && snapshotDir == currentDir) {
+        return false;
+    }
+
+    // Check Archive Mode, Current Dir & Items Count
+    if (archiveMode || currentDir.isEmpty() || iCount <= 0 || iCount > DEFAULT_LISTING_SNAPSHOT_MAX_ITEMS) {
+        // Remove Outdated Snapshot
+        QFile::remove(aFilePath);
+
+        return false;
+    }
+
+    // Init File Names
+    QStringList fileNames;
+    // Reserve Space
+    fileNames.reserve(iCount);
+
+    // Go Thru Items
+    for (int i = 0; i < iCount; ++i) {
+        // Check Search Result - Not A Listing Of The Current Dir
+        if (items[i]->searchResult) {
+            // Remove Outdated Snapshot
+            QFile::remove(aFilePath);
+
+            return false;
+        }
+
+        // Add File Name
+        fileNames << items[i]->fileInfo.fileName();
+    }
+
+    qDebug() << "FileListModel::saveSnapshot - aFilePath: " << aFilePath << " - count: " << iCount;
+
+    return FileListSnapshot::save(aFilePath, currentDir, listFilters(), listSortFlags(), fileNames);
+}
+
+//==============================================================================
+// Load Listing Snapshot
+//==============================================================================
+bool FileListModel::loadSnapshot(const QString& aFilePath, const QString& aDirPath)
+{
+    // Check Archive Mode
+    if (archiveMode) {
+        return false;
+    }
+
+    // Init Snapshot
+    FileListSnapshot snapshot;
+
+    // Open Snapshot
+    if (!snapshot.open(aFilePath)) {
+        return false;
+    }
+
+    // Check Dir Path & List Flags - Item Order Depends On Them
+    if (snapshot.dirPath() != aDirPath || snapshot.filters() != listFilters() || snapshot.sortFlags() != listSortFlags()) {
+        return false;
+    }
+
+    // Clear
+    clear();
+
+    // Get Snapshot Count
+    int sCount = snapshot.count();
+
+    qDebug() << "FileListModel::loadSnapshot - aDirPath: " << aDirPath << " - count: " << sCount;
+
+    // Begin Reset Model
+    beginResetModel();
+
+    // Go Thru Snapshot
+    for (int i = 0; i < sCount; ++i) {
+        // Get File Name
+        QString fileName = snapshot.fileName(i);
+        // Create New File List Item - File Info Is Read Lazily On Display
+        FileListModelItem* newItem = new FileListModelItem(aDirPath, fileName);
+        // Insert Into Selection Sets
+        insertSelectionRow(itemList.count(), newItem);
+        // Add Item To Item List
+        itemList << newItem;
+        // Add File Name To File Name List
+        fileNameList << fileName;
+    }
+
+    // End Reset Model
+    endResetModel();
+
+    // Set Snapshot Dir
+    snapshotDir = aDirPath;
+
+    // Emit Count Changed Signal
+    emit countChanged(itemList.count());
+
+    return true;
+}
+
+//==============================================================================
+// Drop Listing Snapshot
+//==============================================================================
+void FileListModel::dropSnapshot()
+{
+    // Check Snapshot Dir
+    if (!snapshotDir.isEmpty()) {
+        //qDebug() << "FileListModel::dropSnapshot - snapshotDir: " << snapshotDir;
+
+        // Clear
+        clear();
+    }
+}
+
 //==============================================================================
 // Check If Is Dir
 //==============================================================================
@@ -1864,6 +2250,179 @@ bool FileListModel::getArchiveMode()
     return archiveMode;
 }
 
+//==============================================================================
+// Get Quick Filter
+//==============================================================================
+QString FileListModel::getQuickFilter()
+{
+    return quickFilter;
+}
+
+//==============================================================================
+// Set Quick Filter
+//==============================================================================
+void FileListModel::setQuickFilter(const QString& aQuickFilter)
+{
+    // Check Quick Filter
+    if (quickFilter == aQuickFilter) {
+        return;
+    }
+
+    // Check Quick Filter
+    if (aQuickFilter.isEmpty()) {
+        // Clear Quick Filter
+        clearQuickFilter();
+
+        return;
+    }
+
+    //qDebug() << "FileListModel::setQuickFilter - aQuickFilter: " << aQuickFilter;
+
+    // Check If Filter Already Active
+    if (quickFilter.isEmpty()) {
+        // Store All Items
+        allItems = itemList;
+        // Store All Selection
+        allSelection = selection;
+        // Store All Unselectable
+        allUnselectable = unselectable;
+
+        // Init Names
+        QStringList names;
+        // Get All Items Count
+        int aiCount = allItems.count();
+        // Reserve Names
+        names.reserve(aiCount);
+        // Go Thru All Items
+        for (int i = 0; i < aiCount; ++i) {
+            // Add Name
+            names << (archiveMode ? allItems[i]->archiveFileInfo.fileName : allItems[i]->fileInfo.fileName());
+        }
+
+        // Set Quick Filter Engine Names
+        quickFilterEngine.setNames(names);
+    } else {
+        // Get Filter Rows Count
+        int frCount = filterRows.count();
+        // Write Back Selection Of Filtered Rows
+        for (int i = 0; i < frCount; ++i) {
+            // Set All Selection
+            allSelection.set(filterRows[i], selection.test(i));
+        }
+    }
+
+    // Set Quick Filter
+    quickFilter = aQuickFilter;
+
+    // Filter Rows
+    filterRows = quickFilterEngine.filter(quickFilter);
+
+    // Check Parent Dir Item - Keep It Reachable
+    if (allUnselectable.test(0) && (filterRows.isEmpty() || filterRows[0] != 0)) {
+        // Prepend Parent Dir Row
+        filterRows.prepend(0);
+    }
+
+    // Begin Reset Model
+    beginResetModel();
+
+    // Clear Item List
+    itemList.clear();
+    // Clear Selection
+    selection.clear();
+    // Clear Unselectable
+    unselectable.clear();
+
+    // Get Filter Rows Count
+    int frCount = filterRows.count();
+    // Reserve Item List
+    itemList.reserve(frCount);
+    // Go Thru Filter Rows
+    for (int i = 0; i < frCount; ++i) {
+        // Add Item
+        itemList << allItems[filterRows[i]];
+        // Add Selection
+        selection.append(allSelection.test(filterRows[i]));
+        // Add Unselectable
+        unselectable.append(allUnselectable.test(filterRows[i]));
+    }
+
+    // End Reset Model
+    endResetModel();
+
+    // Emit Count Changed Signal
+    emit countChanged(itemList.count());
+    // Set Selected Count - Hidden Items Are Not Counted As Selected
+    setSelectedCount(selection.count());
+    // Emit Quick Filter Changed Signal
+    emit quickFilterChanged(quickFilter);
+}
+
+//==============================================================================
+// Clear Quick Filter
+//==============================================================================
+int FileListModel::clearQuickFilter(const int& aRow)
+{
+    // Check Quick Filter
+    if (quickFilter.isEmpty()) {
+        return aRow;
+    }
+
+    // Get Unfiltered Row
+    int row = (aRow >= 0 && aRow < filterRows.count()) ? filterRows[aRow] : (aRow >= 0 ? allItems.count() : aRow);
+
+    // Begin Reset Model
+    beginResetModel();
+    // Restore Unfiltered Items
+    restoreFilteredItems();
+    // End Reset Model
+    endResetModel();
+
+    // Emit Count Changed Signal
+    emit countChanged(itemList.count());
+    // Set Selected Count
+    setSelectedCount(selection.count());
+    // Emit Quick Filter Changed Signal
+    emit quickFilterChanged(quickFilter);
+
+    return row;
+}
+
+//==============================================================================
+// Restore Unfiltered Items
+//==============================================================================
+void FileListModel::restoreFilteredItems()
+{
+    // Check Quick Filter
+    if (quickFilter.isEmpty()) {
+        return;
+    }
+
+    // Get Filter Rows Count
+    int frCount = filterRows.count();
+    // Write Back Selection Of Filtered Rows
+    for (int i = 0; i < frCount; ++i) {
+        // Set All Selection
+        allSelection.set(filterRows[i], selection.test(i));
+    }
+
+    // Restore Item List
+    itemList = allItems;
+    // Restore Selection
+    selection = allSelection;
+    // Restore Unselectable
+    unselectable = allUnselectable;
+
+    // Clear All Items
+    allItems.clear();
+    // Clear Filter Rows
+    filterRows.clear();
+    // Clear Quick Filter Engine
+    quickFilterEngine.clear();
+    // Reset Quick Filter
+    quickFilter = "";
+}
+
 //==============================================================================
 // Destructor
 //==============================================================================
@@ -1882,6 +2441,27 @@ FileListModel::~FileListModel()
         fileUtil = NULL;
     }
 
+    // Check Owner Name Cache
+    if (ownerNames) {
+        // Release
+        ownerNames->release();
+        ownerNames = NULL;
+    }
+
+    // Check Mime Type Cache
+    if (mimeTypes) {
+        // Release
+        mimeTypes->release();
+        mimeTypes = NULL;
+    }
+
+    // Check Dir Size Index
+    if (dirSizeIndex) {
+        // Release
+        dirSizeIndex->release();
+        dirSizeIndex = NULL;
+    }
+
     // ...
 
     //qDebug() << "FileListModel::~FileListModel";
@@ -6,8 +6,14 @@
 #include <QAbstractListModel>
 
 #include "utility.h"
+#include "fileselectionset.h"
+#include "filelistquickfilter.h"
 
 class RemoteFileUtilClient;
+class FileListModel;
+class OwnerNameCache;
+class MimeTypeCache;
+class DirSizeIndex;
 
 
 //==============================================================================
@@ -27,8 +33,6 @@ public:
     ArchiveFileInfo archiveFileInfo;
     // Dir Size
     quint64         dirSize;
-    // Selected
-    bool            selected;
     // Search Result
     bool            searchResult;
 };
@@ -36,6 +40,41 @@ public:
 
 
 
+//==============================================================================
+// File List Selection Class - Lazy Selected Paths View
+//==============================================================================
+class FileListSelection
+{
+public:
+    // Constructor - Snapshot Of Selected Rows, Valid Until The Listing Changes
+    explicit FileListSelection(const FileListModel* aModel = NULL, const FileSelectionSet& aRows = FileSelectionSet());
+
+    // Get Count
+    int count() const;
+    // Is Empty
+    bool isEmpty() const;
+
+    // Get First Selected Row, Returns -1 If None
+    int first() const;
+    // Get Next Selected Row After aRow, Returns -1 If None
+    int next(const int& aRow) const;
+
+    // Get File Path For Row - Built On Demand
+    QString filePath(const int& aRow) const;
+
+protected:
+
+    // Model
+    const FileListModel*    model;
+    // Selected Rows
+    FileSelectionSet        rows;
+    // Selected Rows Count
+    int                     rowsCount;
+};
+
+
+
+
 //==============================================================================
 // File List Model Class
 //==============================================================================
@@ -48,6 +87,7 @@ class FileListModel : public QAbstractListModel
     Q_PROPERTY(int count READ rowCount NOTIFY countChanged)
     Q_PROPERTY(int selectedCount READ getSelectedCount NOTIFY selectedCountChanged)
     Q_PROPERTY(bool archiveMode READ getArchiveMode NOTIFY archiveModeChanged)
+    Q_PROPERTY(QString quickFilter READ getQuickFilter WRITE setQuickFilter NOTIFY quickFilterChanged)
 
 public:
 
@@ -78,6 +118,14 @@ public:
     // Update Dir Size
     void updateDirSize(const int& aIndex, const quint64& aSize);
 
+    // Take Stale Indexed Dirs - Listed Dirs Whose Index Item Needs Refreshing
+    QStringList takeStaleIndexedDirs();
+
+    // Save Listing Snapshot
+    bool saveSnapshot(const QString& aFilePath);
+    // Load Listing Snapshot - Shown Until The Fresh Listing Of aDirPath Arrives
+    bool loadSnapshot(const QString& aFilePath, const QString& aDirPath);
+
     // Check If Is Dir
     bool isDir(const int& aIndex);
     // Check If Is Bundle
@@ -91,6 +139,11 @@ public:
     // Get Archive Mode
     bool getArchiveMode();
 
+    // Get Quick Filter
+    QString getQuickFilter();
+    // Set Quick Filter - Empty Text Shows All Items
+    void setQuickFilter(const QString& aQuickFilter);
+
     // Set Sorting Order
     void setSorting(const int& aSorting);
     // Set Reverse Mode
@@ -160,13 +213,13 @@ public slots:
     // Toggle All Selection
     void toggleAllSelection();
 
-    // Select Files
-    void selectFiles(const QString& aPattern);
-    // Deselect Files
-    void deselectFiles(const QString& aPattern);
+    // Select Files - Patterns Separated By ';'
+    void selectFiles(const QString& aPattern, const bool& aCaseSensitive = false);
+    // Deselect Files - Patterns Separated By ';'
+    void deselectFiles(const QString& aPattern, const bool& aCaseSensitive = false);
 
-    // Get All Selected Files
-    QStringList getAllSelected();
+    // Get Selection - Lazy Selected Paths View, Falls Back To aCurrentIndex If Nothing Selected
+    FileListSelection getSelection(const int& aCurrentIndex = -1) const;
 
     // Find Next Selected Index
     int findNextSelected(const int& aIndex);
@@ -230,6 +283,9 @@ signals:
     // Archive Mode Changed Signal
     void archiveModeChanged(const bool& aArchiveMode);
 
+    // Quick Filter Changed Signal
+    void quickFilterChanged(const QString& aQuickFilter);
+
 public: // From QAbstractListModel
 
     // Get Role Names
@@ -256,6 +312,18 @@ protected slots:
     // Set Selected Files Count
     void setSelectedCount(const int& aSelectedCount);
 
+protected slots: // For Owner Name Cache
+
+    // Owner Name Resolved Slot
+    void ownerNameResolved(const uint& aUID, const QString& aUserName);
+
+protected slots: // For Mime Type Cache
+
+    // Mime Type Resolved Slot
+    void mimeTypeResolved(const QString& aFilePath, const QString& aMimeType);
+    // Refresh File Types
+    void refreshFileTypes();
+
 protected slots: // For Remote File Client
 
     // Client Connection Changed Slot
@@ -323,6 +391,34 @@ protected slots: // For Remote File Client
                               const bool& aIsDir,
                               const bool& aIsLink);
 
+protected:
+    friend class FileListSelection;
+
+    // Is Item Selectable
+    static bool isSelectable(FileListModelItem* aItem);
+    // Insert Item Into Selection Sets
+    void insertSelectionRow(const int& aRow, FileListModelItem* aItem);
+
+    // Get List Filters
+    int listFilters();
+    // Get List Sort Flags
+    int listSortFlags();
+
+    // Drop Listing Snapshot - Before The First Fresh Item
+    void dropSnapshot();
+
+    // Clear Quick Filter - Returns Unfiltered Row For aRow
+    int clearQuickFilter(const int& aRow = -1);
+    // Restore Unfiltered Items - No Model Signals
+    void restoreFilteredItems();
+
+    // Set Selection By Pattern
+    void setSelectionByPattern(const QString& aPattern, const bool& aSelected, const bool& aCaseSensitive);
+    // Add Row To Changed Selection Range - Emits Previous Range If Not Contiguous
+    void addSelectionChange(const int& aRow, int& aFirst, int& aLast);
+    // Emit Selection Changed For Range
+    void emitSelectionRange(int& aFirst, int& aLast);
+
 protected:
 
     // Roles
@@ -359,6 +455,18 @@ protected:
     // Remote File Client
     RemoteFileUtilClient*               fileUtil;
 
+    // Owner Name Cache
+    OwnerNameCache*                     ownerNames;
+    // Mime Type Cache
+    MimeTypeCache*                      mimeTypes;
+    // File Types Refresh Pending
+    bool                                fileTypesRefreshPending;
+
+    // Dir Size Index
+    DirSizeIndex*                       dirSizeIndex;
+    // Stale Indexed Dirs
+    QStringList                         staleIndexedDirs;
+
     // Sorting Mode
     int                                 sorting;
     // Reverse Order
@@ -372,6 +480,23 @@ protected:
 
     // Selected Count
     int                                 selectedCount;
+    // Selected Rows
+    FileSelectionSet                    selection;
+    // Unselectable Rows - '.' And '..'
+    FileSelectionSet                    unselectable;
+
+    // Quick Filter Text
+    QString                             quickFilter;
+    // Quick Filter Engine
+    FileListQuickFilter                 quickFilterEngine;
+    // All Items While Quick Filter Active
+    QList<FileListModelItem*>           allItems;
+    // All Items Selection While Quick Filter Active
+    FileSelectionSet                    allSelection;
+    // All Items Unselectable Rows While Quick Filter Active
+    FileSelectionSet                    allUnselectable;
+    // Filtered Rows - Indexes Into All Items
+    QVector<int>                        filterRows;
 
     // Fetch Dir On Connection
     bool                                fetchOnConnection;
@@ -381,6 +506,9 @@ protected:
     // Archive Path
     QString                             archivePath;
 
+    // Snapshot Dir - Items Are A Snapshot Of This Dir Until The Fresh Listing
+    QString                             snapshotDir;
+
     // ...
 };
 
@@ -0,0 +1,193 @@
+#include <QStringMatcher>
+#include <QDebug>
+
+#include "filelistquickfilter.h"
+#include "filenamematcher.h"
+
+
+//==============================================================================
+// Constructor
+//==============================================================================
+FileListQuickFilter::FileListQuickFilter()
+    : lastMode(EQFMNone)
+{
+}
+
+//==============================================================================
+// Set Names
+//==============================================================================
+void FileListQuickFilter::setNames(const QStringList& aNames)
+{
+    // Clear
+    clear();
+
+    // Get Names Count
+    int nCount = aNames.count();
+    // Init Arena Size
+    int arenaSize = 0;
+
+    // Go Thru Names
+    for (int i = 0; i < nCount; ++i) {
+        // Add Name Length
+        arenaSize += aNames[i].length();
+    }
+
+    // Reserve Arena
+    arena.reserve(arenaSize);
+    // Reserve Offsets
+    offsets.reserve(nCount + 1);
+
+    // Go Thru Names
+    for (int i = 0; i < nCount; ++i) {
+        // Add Offset
+        offsets << arena.length();
+        // Add Lowercase Name
+        arena += aNames[i].toLower();
+    }
+
+    // Add End Offset
+    offsets << arena.length();
+}
+
+//==============================================================================
+// Clear
+//==============================================================================
+void FileListQuickFilter::clear()
+{
+    // Clear Arena
+    arena.clear();
+    // Clear Offsets
+    offsets.clear();
+    // Reset Last Text
+    lastText = "";
+    // Reset Last Mode
+    lastMode = EQFMNone;
+    // Clear Last Result
+    lastResult.clear();
+}
+
+//==============================================================================
+// Filter
+//==============================================================================
+QVector<int> FileListQuickFilter::filter(const QString& aText)
+{
+    // Get Mode
+    EQuickFilterMode mode = modeForText(aText);
+    // Get Needle
+    QString needle = (mode == EQFMFuzzy ? aText.mid(1) : aText).toLower();
+    // Get Names Count
+    int nCount = offsets.count() - 1;
+
+    // Init Result
+    QVector<int> result;
+
+    // Check Refinable - Substring And Fuzzy Results Only Shrink As The Needle Grows
+    bool refine = mode != EQFMGlob && mode == lastMode && needle.startsWith(lastText) && !lastText.isEmpty();
+    // Get Candidates Count
+    int cCount = refine ? lastResult.count() : nCount;
+
+    // Reserve Result
+    result.reserve(cCount);
+
+    // Init Substring Matcher
+    QStringMatcher substringMatcher(needle, Qt::CaseSensitive);
+    // Init Glob Matcher - Arena Is Already Lowercase
+    FileNameMatcher globMatcher(mode == EQFMGlob ? needle : QString(""), Qt::CaseSensitive);
+
+    // Get Arena Data
+    const QChar* data = arena.constData();
+
+    // Go Thru Candidates
+    for (int c = 0; c < cCount; ++c) {
+        // Get Row
+        int row = refine ? lastResult[c] : c;
+        // Get Name Offset
+        int offset = offsets[row];
+        // Get Name Length
+        int length = offsets[row + 1] - offset;
+
+        // Init Match
+        bool match = false;
+
+        // Switch Mode
+        switch (mode) {
+            case EQFMNone:      match = true; break;
+            case EQFMSubstring: match = substringMatcher.indexIn(data + offset, length, 0) >= 0; break;
+            case EQFMGlob:      match = globMatcher.match(nameAt(row)); break;
+            case EQFMFuzzy:     match = fuzzyMatch(data + offset, length, needle); break;
+
+            default:
+            break;
+        }
+
+        // Check Match
+        if (match) {
+            // Add Row
+            result << row;
+        }
+    }
+
+    // Store Last Text
+    lastText = needle;
+    // Store Last Mode
+    lastMode = mode;
+    // Store Last Result
+    lastResult = result;
+
+    //qDebug() << "FileListQuickFilter::filter - aText: " << aText << " - refine: " << refine << " - candidates: " << cCount << " - result: " << result.count();
+
+    return result;
+}
+
+//==============================================================================
+// Get Filter Mode For Text
+//==============================================================================
+FileListQuickFilter::EQuickFilterMode FileListQuickFilter::modeForText(const QString& aText)
+{
+    // Check Text
+    if (aText.isEmpty()) {
+        return EQFMNone;
+    }
+
+    // Check Fuzzy Prefix
+    if (aText.startsWith('~')) {
+        return aText.length() > 1 ? EQFMFuzzy : EQFMNone;
+    }
+
+    // Check Wildcards
+    if (aText.contains('*') || aText.contains('?') || aText.contains('[')) {
+        return EQFMGlob;
+    }
+
+    return EQFMSubstring;
+}
+
+//==============================================================================
+// Get Name For Row
+//==============================================================================
+QString FileListQuickFilter::nameAt(const int& aRow) const
+{
+    return QString::fromRawData(arena.constData() + offsets[aRow], offsets[aRow + 1] - offsets[aRow]);
+}
+
+//==============================================================================
+// Fuzzy Match
+//==============================================================================
+bool FileListQuickFilter::fuzzyMatch(const QChar* aName, const int& aLength, const QString& aNeedle) const
+{
+    // Get Needle Length
+    int nLength = aNeedle.length();
+    // Init Needle Position
+    int nPos = 0;
+
+    // Go Thru Name
+    for (int i = 0; i < aLength && nPos < nLength; ++i) {
+        // Check Char
+        if (aName[i] == aNeedle[nPos]) {
+            // Inc Needle Position
+            nPos++;
+        }
+    }
+
+    return nPos == nLength;
+}
@@ -0,0 +1,59 @@
+#ifndef FILELISTQUICKFILTER_H
+#define FILELISTQUICKFILTER_H
+
+#include <QString>
+#include <QStringList>
+#include <QVector>
+
+
+//==============================================================================
+// File List Quick Filter Class - Incremental As-You-Type Name Filter
+//==============================================================================
+class FileListQuickFilter
+{
+public:
+    // Filter Mode
+    enum EQuickFilterMode {
+        EQFMNone        = 0,
+        EQFMSubstring,
+        EQFMGlob,
+        EQFMFuzzy
+    };
+
+    // Constructor
+    explicit FileListQuickFilter();
+
+    // Set Names - Builds The Lowercase Name Arena
+    void setNames(const QStringList& aNames);
+    // Clear
+    void clear();
+
+    // Filter - Returns Matching Rows, Refines Previous Result When Possible
+    QVector<int> filter(const QString& aText);
+
+    // Get Filter Mode For Text - '~' Prefix Is Fuzzy, Wildcards Are Glob, Anything Else Substring
+    static EQuickFilterMode modeForText(const QString& aText);
+
+protected:
+
+    // Get Name For Row
+    QString nameAt(const int& aRow) const;
+    // Fuzzy Match - Needle Chars In Order
+    bool fuzzyMatch(const QChar* aName, const int& aLength, const QString& aNeedle) const;
+
+protected:
+
+    // Lowercase Name Arena
+    QString                 arena;
+    // Name Offsets Into Arena - Count + 1 Entries
+    QVector<int>            offsets;
+
+    // Last Filter Text
+    QString                 lastText;
+    // Last Filter Mode
+    EQuickFilterMode        lastMode;
+    // Last Result
+    QVector<int>            lastResult;
+};
+
+#endif // FILELISTQUICKFILTER_H
@@ -0,0 +1,282 @@
+#include <QSaveFile>
+#include <QVector>
+#include <QDebug>
+
+#include "filelistsnapshot.h"
+#include "constants.h"
+
+
+// Snapshot File Magic
+#define FILE_LIST_SNAPSHOT_MAGIC        0x4d434c53
+// Snapshot File Version
+#define FILE_LIST_SNAPSHOT_VERSION      1
+
+//==============================================================================
+// Snapshot File Header - Followed By Count + 2 String Offsets And The Strings
+//==============================================================================
+struct FileListSnapshotHeader
+{
+    // Magic
+    quint32     magic;
+    // Version
+    quint32     version;
+    // Filters
+    qint32      filters;
+    // Sort Flags
+    qint32      sortFlags;
+    // File Names Count
+    quint32     count;
+    // String Data Size
+    quint32     stringsSize;
+};
+
+
+//==============================================================================
+// Constructor
+//==============================================================================
+FileListSnapshot::FileListSnapshot()
+    : data(NULL)
+    , dataSize(0)
+    , snapshotFilters(0)
+    , snapshotSortFlags(0)
+    , namesCount(0)
+    , offsets(NULL)
+    , strings(NULL)
+{
+}
+
+//==============================================================================
+// Save Snapshot
+//==============================================================================
+bool FileListSnapshot::save(const QString& aFilePath, const QString& aDirPath, const int& aFilters, const int& aSortFlags, const QStringList& aFileNames)
+{
+    // Get File Names Count
+    int fnCount = aFileNames.count();
+
+    // Init String Data
+    QByteArray stringData;
+    // Init Offsets
+    QVector<quint32> stringOffsets;
+
+    // Reserve Offsets
+    stringOffsets.reserve(fnCount + 2);
+
+    // Add Dir Path
+    stringOffsets << 0;
+    stringData += aDirPath.toUtf8();
+
+    // Go Thru File Names
+    for (int i = 0; i < fnCount; ++i) {
+        // Add File Name
+        stringOffsets << (quint32)stringData.size();
+        stringData += aFileNames[i].toUtf8();
+    }
+
+    // Add End Offset
+    stringOffsets << (quint32)stringData.size();
+
+    // Init Header
+    FileListSnapshotHeader header;
+
+    // Set Up Header
+    header.magic       = FILE_LIST_SNAPSHOT_MAGIC;
+    header.version     = FILE_LIST_SNAPSHOT_VERSION;
+    header.filters     = aFilters;
+    header.sortFlags   = aSortFlags;
+    header.count       = (quint32)fnCount;
+    header.stringsSize = (quint32)stringData.size();
+
+    // Init Snapshot File - Written Atomically
+    QSaveFile file(aFilePath);
+
+    // Open File
+    if (!file.open(QIODevice::WriteOnly)) {
+        qWarning() << "FileListSnapshot::save - aFilePath: " << aFilePath << " - ERROR OPENING FILE!!";
+        return false;
+    }
+
+    // Write Header - Native Layout, The File Never Leaves This Machine
+    file.write((const char*)&header, sizeof(header));
+    // Write Offsets
+    file.write((const char*)stringOffsets.constData(), stringOffsets.count() * sizeof(quint32));
+    // Write Strings
+    file.write(stringData);
+
+    return file.commit();
+}
+
+//==============================================================================
+// Open Snapshot
+//==============================================================================
+bool FileListSnapshot::open(const QString& aFilePath)
+{
+    // Close
+    close();
+
+    // Set File Name
+    snapshotFile.setFileName(aFilePath);
+
+    // Open File
+    if (!snapshotFile.open(QIODevice::ReadOnly)) {
+        return false;
+    }
+
+    // Get Data Size
+    dataSize = snapshotFile.size();
+
+    // Check Data Size
+    if (dataSize < (qint64)sizeof(FileListSnapshotHeader)) {
+        // Close
+        close();
+        return false;
+    }
+
+    // Map File
+    data = snapshotFile.map(0, dataSize);
+
+    // Check Data
+    if (!data) {
+        // Close
+        close();
+        return false;
+    }
+
+    // Get Header - Mapping Is Page Aligned
+    const FileListSnapshotHeader* header = (const FileListSnapshotHeader*)data;
+
+    // Get Expected Size
+    qint64 expectedSize = (qint64)sizeof(FileListSnapshotHeader) + ((qint64)header->count + 2) * (qint64)sizeof(quint32) + (qint64)header->stringsSize;
+
+    // Check Header
+    if (header->magic != FILE_LIST_SNAPSHOT_MAGIC || header->version != FILE_LIST_SNAPSHOT_VERSION || header->count > (quint32)DEFAULT_LISTING_SNAPSHOT_MAX_ITEMS || expectedSize != dataSize) {
+        qWarning() << "FileListSnapshot::open - aFilePath: " << aFilePath << " - INVALID SNAPSHOT!!";
+        // Close
+        close();
+        return false;
+    }
+
+    // Set Filters
+    snapshotFilters = header->filters;
+    // Set Sort Flags
+    snapshotSortFlags = header->sortFlags;
+    // Set File Names Count
+    namesCount = (int)header->count;
+    // Set Offsets
+    offsets = (const quint32*)(data + sizeof(FileListSnapshotHeader));
+    // Set Strings
+    strings = (const char*)(offsets + namesCount + 2);
+
+    return true;
+}
+
+//==============================================================================
+// Close Snapshot
+//==============================================================================
+void FileListSnapshot::close()
+{
+    // Check Data
+    if (data) {
+        // Unmap File
+        snapshotFile.unmap((uchar*)data);
+        data = NULL;
+    }
+
+    // Close File
+    snapshotFile.close();
+
+    // Reset Data Size
+    dataSize = 0;
+    // Reset Names Count
+    namesCount = 0;
+    // Reset Offsets
+    offsets = NULL;
+    // Reset Strings
+    strings = NULL;
+}
+
+//==============================================================================
+// Is Open
+//==============================================================================
+bool FileListSnapshot::isOpen() const
+{
+    return data != NULL;
+}
+
+//==============================================================================
+// Get Dir Path
+//==============================================================================
+QString FileListSnapshot::dirPath() const
+{
+    return string(0);
+}
+
+//==============================================================================
+// Get Filters
+//==============================================================================
+int FileListSnapshot::filters() const
+{
+    return snapshotFilters;
+}
+
+//==============================================================================
+// Get Sort Flags
+//==============================================================================
+int FileListSnapshot::sortFlags() const
+{
+    return snapshotSortFlags;
+}
+
+//==============================================================================
+// Get File Names Count
+//==============================================================================
+int FileListSnapshot::count() const
+{
+    return namesCount;
+}
+
+//==============================================================================
+// Get File Name
+//==============================================================================
+QString FileListSnapshot::fileName(const int& aIndex) const
+{
+    // Check Index
+    if (aIndex < 0 || aIndex >= namesCount) {
+        return QString("");
+    }
+
+    return string(aIndex + 1);
+}
+
+//==============================================================================
+// Get String
+//==============================================================================
+QString FileListSnapshot::string(const int& aIndex) const
+{
+    // Check Data
+    if (!data) {
+        return QString("");
+    }
+
+    // Get String Data Size
+    quint32 stringsSize = (quint32)(dataSize - ((const uchar*)strings - data));
+    // Get Start Offset
+    quint32 start = offsets[aIndex];
+    // Get End Offset
+    quint32 end = offsets[aIndex + 1];
+
+    // Check Offsets - The File May Have Been Damaged
+    if (start > end || end > stringsSize) {
+        return QString("");
+    }
+
+    return QString::fromUtf8(strings + start, (int)(end - start));
+}
+
+//==============================================================================
+// Destructor
+//==============================================================================
+FileListSnapshot::~FileListSnapshot()
+{
+    // Close
+    close();
+}
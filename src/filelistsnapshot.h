@@ -0,0 +1,71 @@
+#ifndef FILELISTSNAPSHOT_H
+#define FILELISTSNAPSHOT_H
+
+#include <QFile>
+#include <QString>
+#include <QStringList>
+#include <QtGlobal>
+
+
+//==============================================================================
+// File List Snapshot Class - Memory Mapped Listing Of A Dir
+//==============================================================================
+class FileListSnapshot
+{
+public:
+    // Constructor
+    explicit FileListSnapshot();
+
+    // Save Snapshot - Written Atomically
+    static bool save(const QString& aFilePath, const QString& aDirPath, const int& aFilters, const int& aSortFlags, const QStringList& aFileNames);
+
+    // Open Snapshot - Maps The File, Nothing Is Copied Until Names Are Read
+    bool open(const QString& aFilePath);
+    // Close Snapshot
+    void close();
+
+    // Is Open
+    bool isOpen() const;
+
+    // Get Dir Path
+    QString dirPath() const;
+    // Get Filters
+    int filters() const;
+    // Get Sort Flags
+    int sortFlags() const;
+
+    // Get File Names Count
+    int count() const;
+    // Get File Name
+    QString fileName(const int& aIndex) const;
+
+    // Destructor
+    ~FileListSnapshot();
+
+protected:
+
+    // Get String - Index 0 Is The Dir Path, File Names Follow
+    QString string(const int& aIndex) const;
+
+protected:
+
+    // Snapshot File
+    QFile               snapshotFile;
+    // Mapped Data
+    const uchar*        data;
+    // Mapped Size
+    qint64              dataSize;
+
+    // Filters
+    int                 snapshotFilters;
+    // Sort Flags
+    int                 snapshotSortFlags;
+    // File Names Count
+    int                 namesCount;
+    // String Offsets Table
+    const quint32*      offsets;
+    // String Data
+    const char*         strings;
+};
+
+#endif // FILELISTSNAPSHOT_H
@@ -0,0 +1,167 @@
+#include <QStringList>
+#include <QDebug>
+
+#include "filenamematcher.h"
+
+
+//==============================================================================
+// Constructor
+//==============================================================================
+FileNameMatcherPattern::FileNameMatcherPattern(const QString& aPattern, const Qt::CaseSensitivity& aCaseSensitivity)
+    : kind(EPKAny)
+    , literal("")
+    , caseSensitivity(aCaseSensitivity)
+{
+    // Check Pattern
+    if (aPattern == QString("*")) {
+        return;
+    }
+
+    // Get Body Without Leading/Trailing Star
+    QString body = aPattern.mid(aPattern.startsWith('*') ? 1 : 0);
+    // Check Trailing Star
+    if (body.endsWith('*')) {
+        // Chop Trailing Star
+        body.chop(1);
+    }
+
+    // Check For Wildcard Chars In Body
+    bool simpleBody = !body.contains('*') && !body.contains('?') && !body.contains('[');
+
+    // Check Simple Body
+    if (simpleBody && !aPattern.startsWith('*') && !aPattern.endsWith('*')) {
+        // Set Kind
+        kind = EPKLiteral;
+        // Set Literal
+        literal = aPattern;
+    } else if (simpleBody && aPattern.startsWith('*') && !aPattern.endsWith('*')) {
+        // Set Kind
+        kind = EPKSuffix;
+        // Set Literal
+        literal = body;
+    } else if (simpleBody && !aPattern.startsWith('*') && aPattern.endsWith('*')) {
+        // Set Kind
+        kind = EPKPrefix;
+        // Set Literal
+        literal = body;
+    } else {
+        // Set Kind
+        kind = EPKWildcard;
+        // Compile Wildcard - Same Syntax As QDir::match
+        wildcard = QRegExp(aPattern, caseSensitivity, QRegExp::Wildcard);
+    }
+}
+
+//==============================================================================
+// Match
+//==============================================================================
+bool FileNameMatcherPattern::match(const QString& aFileName) const
+{
+    // Switch Kind
+    switch (kind) {
+        case EPKAny:        return true;
+        case EPKLiteral:    return aFileName.compare(literal, caseSensitivity) == 0;
+        case EPKSuffix:     return aFileName.endsWith(literal, caseSensitivity);
+        case EPKPrefix:     return aFileName.startsWith(literal, caseSensitivity);
+        case EPKWildcard:   return wildcard.exactMatch(aFileName);
+
+        default:
+        break;
+    }
+
+    return false;
+}
+
+
+
+
+
+
+
+//==============================================================================
+// Constructor
+//==============================================================================
+FileNameMatcher::FileNameMatcher(const QString& aPatterns, const Qt::CaseSensitivity& aCaseSensitivity)
+    : anyPattern(false)
+{
+    // Set Patterns
+    setPatterns(aPatterns, aCaseSensitivity);
+}
+
+//==============================================================================
+// Set Patterns
+//==============================================================================
+void FileNameMatcher::setPatterns(const QString& aPatterns, const Qt::CaseSensitivity& aCaseSensitivity)
+{
+    // Clear Patterns
+    patterns.clear();
+    // Reset Any Pattern
+    anyPattern = false;
+
+    // Split Patterns - ';' Takes Precedence Over Whitespace, Like QDir::nameFiltersFromString
+    QStringList patternList = aPatterns.contains(';') ? aPatterns.split(';', QString::SkipEmptyParts)
+                                                      : aPatterns.split(QRegExp("\\s+"), QString::SkipEmptyParts);
+
+    // Go Thru Pattern List
+    foreach (QString pattern, patternList) {
+        // Get Trimmed Pattern
+        pattern = pattern.trimmed();
+        // Check Pattern
+        if (pattern.isEmpty()) {
+            continue;
+        }
+
+        // Compile Pattern
+        FileNameMatcherPattern compiled(pattern, aCaseSensitivity);
+
+        // Check Kind
+        if (compiled.kind == FileNameMatcherPattern::EPKAny) {
+            // Set Any Pattern
+            anyPattern = true;
+        }
+
+        // Add To Patterns
+        patterns << compiled;
+    }
+
+    //qDebug() << "FileNameMatcher::setPatterns - aPatterns: " << aPatterns << " - count: " << patterns.count();
+}
+
+//==============================================================================
+// Match
+//==============================================================================
+bool FileNameMatcher::match(const QString& aFileName) const
+{
+    // Check Any Pattern
+    if (anyPattern) {
+        return true;
+    }
+
+    // Get Patterns Count
+    int pCount = patterns.count();
+    // Go Thru Patterns
+    for (int i = 0; i < pCount; ++i) {
+        // Check Match
+        if (patterns[i].match(aFileName)) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+//==============================================================================
+// Is Empty
+//==============================================================================
+bool FileNameMatcher::isEmpty() const
+{
+    return patterns.isEmpty();
+}
+
+//==============================================================================
+// Matches Everything
+//==============================================================================
+bool FileNameMatcher::matchesAll() const
+{
+    return anyPattern;
+}
@@ -0,0 +1,71 @@
+#ifndef FILENAMEMATCHER_H
+#define FILENAMEMATCHER_H
+
+#include <QString>
+#include <QList>
+#include <QRegExp>
+
+
+//==============================================================================
+// File Name Matcher Pattern Class
+//==============================================================================
+class FileNameMatcherPattern
+{
+public:
+    // Pattern Kind
+    enum EPatternKind {
+        EPKAny      = 0,
+        EPKLiteral,
+        EPKSuffix,
+        EPKPrefix,
+        EPKWildcard
+    };
+
+    // Constructor
+    explicit FileNameMatcherPattern(const QString& aPattern = "", const Qt::CaseSensitivity& aCaseSensitivity = Qt::CaseInsensitive);
+
+    // Match
+    bool match(const QString& aFileName) const;
+
+    // Pattern Kind
+    EPatternKind        kind;
+    // Literal Part - Whole Name, Suffix Or Prefix Depending On Kind
+    QString             literal;
+    // Case Sensitivity
+    Qt::CaseSensitivity caseSensitivity;
+    // Wildcard Expression - Only Used For Complex Patterns
+    QRegExp             wildcard;
+};
+
+
+
+
+//==============================================================================
+// File Name Matcher Class - Compiles A Pattern Set Once For Matching Many Names
+//==============================================================================
+class FileNameMatcher
+{
+public:
+    // Constructor - Patterns Separated By ';' Or Whitespace, Like QDir::match
+    explicit FileNameMatcher(const QString& aPatterns = "", const Qt::CaseSensitivity& aCaseSensitivity = Qt::CaseInsensitive);
+
+    // Set Patterns
+    void setPatterns(const QString& aPatterns, const Qt::CaseSensitivity& aCaseSensitivity = Qt::CaseInsensitive);
+
+    // Match
+    bool match(const QString& aFileName) const;
+
+    // Is Empty
+    bool isEmpty() const;
+    // Matches Everything
+    bool matchesAll() const;
+
+protected:
+
+    // Compiled Patterns
+    QList<FileNameMatcherPattern>   patterns;
+    // Matches Everything
+    bool                            anyPattern;
+};
+
+#endif // FILENAMEMATCHER_H
@@ -18,7 +18,11 @@
 #include "ui_filepanel.h"
 #include "filelistmodel.h"
 #include "filelistimageprovider.h"
+#include "thumbnailimageprovider.h"
 #include "remotefileutilclient.h"
+#include "dirsizescanner.h"
+#include "dirsizeindex.h"
+#include "filesystemstats.h"
 #include "confirmdialog.h"
 #include "transferprogressmodel.h"
 #include "settingscontroller.h"
@@ -36,6 +40,7 @@ FilePanel::FilePanel(QWidget* aParent)
     : QFrame(aParent)
     , ui(new Ui::FilePanel)
     , settings(SettingsController::getInstance())
+    , fsStats(FileSystemStats::getInstance())
     , globalSettingsUpdateIsOn(false)
     , needRefresh(false)
     , currentDir("")
@@ -87,6 +92,8 @@ FilePanel::FilePanel(QWidget* aParent)
     , fileListItemPopupActive(false)
     , archiveMode(false)
     , dropCommand(-1)
+    , imageProvider(NULL)
+    , thumbnailProvider(NULL)
 {
     // Setup UI
     ui->setupUi(this);
@@ -134,13 +141,17 @@ void FilePanel::init()
     QQmlEngine* engine = ui->fileListWidget->engine();
 
     // Create New Image Provider
-    FileListImageProvider* newImageProvider = new FileListImageProvider();
+    imageProvider = new FileListImageProvider();
+    // Create New Thumbnail Provider
+    thumbnailProvider = new ThumbnailImageProvider();
 
     // Connect Signal
-    connect(this, SIGNAL(gridModeChanged(bool)), newImageProvider->reciever(), SLOT(gridModeChanged(bool)));
+    connect(this, SIGNAL(gridModeChanged(bool)), imageProvider->reciever(), SLOT(gridModeChanged(bool)));
 
     // Add Image Provider
-    engine->addImageProvider(QLatin1String(DEFAULT_FILE_ICON_PROVIDER_ID), newImageProvider);
+    engine->addImageProvider(QLatin1String(DEFAULT_FILE_ICON_PROVIDER_ID), imageProvider);
+    // Add Thumbnail Image Provider
+    engine->addImageProvider(QLatin1String(DEFAULT_GRID_ICON_PROVIDER_ID), thumbnailProvider);
 
     // Register Busy Indicator
     qmlRegisterType<BusyIndicator>(DEFAULT_CUSTOM_COMPONENTS, 1, 0, DEFAULT_CUSTOM_COMPONENTS_BUSY_INDICATOR);
@@ -159,6 +170,9 @@ void FilePanel::init()
     connect(&dirWatcher, SIGNAL(directoryChanged(QString)), this, SLOT(directoryChanged(QString)));
     connect(&dirWatcher, SIGNAL(fileChanged(QString)), this, SLOT(fileChanged(QString)));
 
+    // Connect Signals - File System Stats
+    connect(fsStats, SIGNAL(statsChanged(QString,qint64,qint64)), this, SLOT(fsStatsChanged(QString,qint64,qint64)));
+
     // Connect Signals - Settings
     connect(settings, SIGNAL(globalSettingsUpdateBegin()), this, SLOT(globalSettingsUpdateBegin()));
     connect(settings, SIGNAL(globalSettingsUpdateFinished()), this, SLOT(globalSettingsUpdateFinished()));
@@ -918,20 +932,21 @@ void FilePanel::renameFile(const QString& aSource, const QString& aTarget)
 //==============================================================================
 // Scan Dir
 //==============================================================================
-void FilePanel::scanDir(const QString& aDirPath)
+void FilePanel::scanDir(const QString& aDirPath, const bool& aUseIndex)
 {
     // Check Dir Scanner
     if (!dirScanner) {
         // Create Dir Scanner
-        dirScanner = new DirScanner();
+        dirScanner = new DirScanner(settings->value(SETTINGS_KEY_DIR_SCAN_THREADS, DEFAULT_DIR_SCAN_THREADS).toInt(),
+                                    settings->value(SETTINGS_KEY_DIR_SCAN_DEVICE_THREADS, DEFAULT_DIR_SCAN_DEVICE_THREADS).toInt());
         // Connect Signal
         connect(dirScanner, SIGNAL(scanSizeChanged(QString,quint64)), this, SLOT(scanSizeChanged(QString,quint64)));
     }
 
-    qDebug() << "FilePanel::scanDir - aDirPath: " << aDirPath;
+    qDebug() << "FilePanel::scanDir - aDirPath: " << aDirPath << " - aUseIndex: " << aUseIndex;
 
     // Scan Dir
-    dirScanner->scanDir(aDirPath);
+    dirScanner->scanDir(aDirPath, aUseIndex);
 }
 
 //==============================================================================
@@ -1026,22 +1041,18 @@ void FilePanel::fileListWidgetDragStarted(const int& aPosX, const int aPosY)
         // Emit Set File List View Interactive
         emit setListViewInteractive(false);
 
-        // Get All Selected Items
-        QStringList selectedItems = fileListModel->getAllSelected();
-
-        // Get Selectd Items Count
-        int siCount = selectedItems.count();
+        // Get Selection
+        FileListSelection selection = fileListModel->getSelection();
 
         // Init URL List
         QList<QUrl> uriList;
+        // Reserve Space
+        uriList.reserve(selection.count());
 
-        // Go Thru Selected Items
-        for (int i = 0; i < siCount; ++i) {
-            // Adjust Selected Items
-            selectedItems.replace(i, QString("%1%2").arg(DEFAULT_URL_PREFIX_FILE).arg(selectedItems[i]));
-
+        // Go Thru Selected Rows
+        for (int row = selection.first(); row >= 0; row = selection.next(row)) {
             // Add To URI List
-            uriList << QUrl(selectedItems[i]);
+            uriList << QUrl(QString("%1%2").arg(DEFAULT_URL_PREFIX_FILE).arg(selection.filePath(row)));
         }
 
         // Check URL List
@@ -1371,6 +1382,43 @@ void FilePanel::setVisualItemsCount(const int& aVisualCount)
     }
 }
 
+//==============================================================================
+// Set Visible Range
+//==============================================================================
+void FilePanel::setVisibleRange(const int& aFirstIndex, const int& aLastIndex)
+{
+    // Check File List Model
+    if (!fileListModel) {
+        return;
+    }
+
+    // Get First Index
+    int firstIndex = qMax(0, aFirstIndex);
+    // Get Last Index
+    int lastIndex = qMin(aLastIndex, fileListModel->rowCount() - 1);
+
+    // Init Visible Paths
+    QStringList visiblePaths;
+
+    // Go Thru Visible Rows
+    for (int i = firstIndex; i <= lastIndex; ++i) {
+        // Add Visible Path
+        visiblePaths << fileListModel->getFullPath(i);
+    }
+
+    // Check Image Provider
+    if (imageProvider) {
+        // Set Visible Items
+        imageProvider->scheduler()->setVisibleItems(visiblePaths);
+    }
+
+    // Check Thumbnail Provider
+    if (thumbnailProvider) {
+        // Set Visible Items
+        thumbnailProvider->scheduler()->setVisibleItems(visiblePaths);
+    }
+}
+
 //==============================================================================
 // Get Supported Image Formats
 //==============================================================================
@@ -1555,33 +1603,71 @@ void FilePanel::deselectFiles(const QString& aPattern)
 }
 
 //==============================================================================
-// Get Selected Files
+// Get Selection
 //==============================================================================
-QStringList FilePanel::getSelectedFiles()
+FileListSelection FilePanel::getSelection()
 {
     // Check File List Model
     if (fileListModel) {
-        // Get Selected
-        QStringList result = fileListModel->getAllSelected();
-
-        // Check Result
-        if (result.count() <= 0) {
-            // Get Current File Info
-            QFileInfo currentInfo = fileListModel->getFileInfo(currentIndex);
-            // Get Current File Name
-            QString fileName = currentInfo.fileName();
-            // Check Current File Name
-            if (fileName != "." && fileName != "..") {
-                // Add Current File
-                //result << fileName;
-                result << currentInfo.absoluteFilePath();
-            }
+        return fileListModel->getSelection(currentIndex);
+    }
+
+    return FileListSelection();
+}
+
+//==============================================================================
+// Get Selected Files Count
+//==============================================================================
+int FilePanel::getSelectedFilesCount()
+{
+    // Check File List Model
+    if (fileListModel) {
+        // Check Selected Count
+        if (fileListModel->getSelectedCount() > 0) {
+            return fileListModel->getSelectedCount();
         }
 
-        return result;
+        // Get Current File Name
+        QString fileName = fileListModel->getFileInfo(currentIndex).fileName();
+
+        // Check Current File Name
+        return (fileName != "." && fileName != "..") ? 1 : 0;
+    }
+
+    return 0;
+}
+
+//==============================================================================
+// Set Quick Filter
+//==============================================================================
+void FilePanel::setQuickFilter(const QString& aQuickFilter)
+{
+    // Check File List Model
+    if (!fileListModel || fileListModel->getQuickFilter() == aQuickFilter) {
+        return;
     }
 
-    return QStringList();
+    // Get Current File Name
+    QString currentFileName = fileListModel->getFileName(currentIndex);
+
+    // Set Quick Filter
+    fileListModel->setQuickFilter(aQuickFilter);
+
+    // Find Current File
+    int newIndex = fileListModel->findIndex(currentFileName);
+
+    // Reset Current Index - Model Has Been Reset
+    currentIndex = -1;
+    // Set Current Index
+    setCurrentIndex(qMax(newIndex, 0));
+}
+
+//==============================================================================
+// Get Quick Filter
+//==============================================================================
+QString FilePanel::getQuickFilter()
+{
+    return fileListModel ? fileListModel->getQuickFilter() : QString("");
 }
 
 //==============================================================================
@@ -2030,6 +2116,12 @@ void FilePanel::restoreUI(const bool& aReload)
 
     // Check Reload
     if (aReload) {
+        // Check File List Model & Saved Dir
+        if (fileListModel && currentDir != savedDir && QFileInfo(savedDir).isDir()) {
+            // Load Listing Snapshot - Shown Until The Fresh Listing Arrives
+            fileListModel->loadSnapshot(QDir::homePath() + "/" + QString(DEFAULT_LISTING_SNAPSHOT_FILENAME).arg(panelName), savedDir);
+        }
+
         // Set Current Dir
         setCurrentDir(savedDir);
     }
@@ -2095,12 +2187,18 @@ void FilePanel::saveSettings()
 //==============================================================================
 void FilePanel::updateAvailableSpaceLabel()
 {
+    // Init Free Space
+    qint64 freeSpace = -1;
+    // Init Total Space
+    qint64 totalSpace = -1;
+
+    // Get Cached Stats - Never Blocks, Unknown Until The First Refresh Arrives
+    bool statsKnown = fsStats && fsStats->stats(currentDir, freeSpace, totalSpace);
+
     // Format Available Space Text
     QString availableSpace = QString(DEFAULT_AVAILABLE_SPACE_FORMAT_STRING).arg(fileListModel ? fileListModel->getFileCount() : 0)
-                                                                           //.arg((getFreeSpace(currentDir) >> 10))
-                                                                           .arg(formattedSize(getFreeSpace(currentDir)))
-                                                                           //.arg((getTotalSpace(currentDir) >> 10));
-                                                                           .arg(formattedSize(getTotalSpace(currentDir)));
+                                                                           .arg(statsKnown ? formattedSize(freeSpace) : QString("..."))
+                                                                           .arg(statsKnown ? formattedSize(totalSpace) : QString("..."));
 
     // Set Text
     ui->availableSpaceLabel->setText(availableSpace);
@@ -2214,6 +2312,18 @@ void FilePanel::fileModelDirFetchFinished()
     // Update Available Space Label
     updateAvailableSpaceLabel();
 
+    // Check File List Model
+    if (fileListModel) {
+        // Get Stale Indexed Dirs
+        QStringList staleDirs = fileListModel->takeStaleIndexedDirs();
+
+        // Go Thru Stale Indexed Dirs
+        foreach (const QString& staleDir, staleDirs) {
+            // Refresh Dir Size - Only Changed Sub Dirs Are Read Again
+            scanDir(staleDir, true);
+        }
+    }
+
     // Check If Dir Watcher Has Changes
     if (dwDirChanged || dwFileChanged) {
         qDebug() << "FilePanel::fileModelDirFetchFinished - panelName: " << panelName << " - CHANGED!!";
@@ -2503,6 +2613,31 @@ void FilePanel::directoryChanged(const QString& aDirPath)
 
         // Set Dir Changed
         dwDirChanged = true;
+
+        // Get Dir Size Index
+        DirSizeIndex* dirSizeIndex = DirSizeIndex::getInstance();
+        // Invalidate Dir And Its Ancestors
+        dirSizeIndex->invalidate(aDirPath);
+        // Release Dir Size Index
+        dirSizeIndex->release();
+
+        // Invalidate File System Stats
+        fsStats->invalidate(aDirPath);
+    }
+}
+
+//==============================================================================
+// File System Stats Changed Slot
+//==============================================================================
+void FilePanel::fsStatsChanged(const QString& aMountPoint, const qint64& aFree, const qint64& aTotal)
+{
+    Q_UNUSED(aFree);
+    Q_UNUSED(aTotal);
+
+    // Check Mount Point
+    if (fsStats && fsStats->mountPoint(currentDir) == aMountPoint) {
+        // Update Available Space Label
+        updateAvailableSpaceLabel();
     }
 }
 
@@ -3070,11 +3205,25 @@ void FilePanel::keyReleaseEvent(QKeyEvent* aEvent)
 
     // Check Event
     if (aEvent) {
+        // Check Modifier Keys - Alt + Printable Chars Type Into The Quick Filter, Alt +/- Are Taken
+        if (modifierKeys == Qt::AltModifier && aEvent->key() >= Qt::Key_Space && aEvent->key() <= Qt::Key_AsciiTilde &&
+            aEvent->key() != Qt::Key_Plus && aEvent->key() != Qt::Key_Minus) {
+            // Get Typed Text - Alt May Swallow The Event Text
+            QString typedText = aEvent->text().isEmpty() ? QString(QChar(aEvent->key())).toLower() : aEvent->text();
+            // Append To Quick Filter
+            setQuickFilter(getQuickFilter() + typedText);
+
+            return;
+        }
+
         // Switch Key
         switch (aEvent->key()) {
             case Qt::Key_Escape:
                 // Check Modifier Keys
-                if (modifierKeys == Qt::ShiftModifier) {
+                if (modifierKeys == Qt::NoModifier && !getQuickFilter().isEmpty()) {
+                    // Clear Quick Filter
+                    setQuickFilter("");
+                } else if (modifierKeys == Qt::ShiftModifier) {
                     // Send To System Tray
 #if defined(Q_OS_MAC)
 
@@ -3137,8 +3286,14 @@ void FilePanel::keyReleaseEvent(QKeyEvent* aEvent)
             break;
 
             case Qt::Key_Backspace:
-                // Go Up
-                goUp();
+                // Check Modifier Keys
+                if (modifierKeys == Qt::AltModifier) {
+                    // Remove Last Quick Filter Char
+                    setQuickFilter(getQuickFilter().left(getQuickFilter().length() - 1));
+                } else {
+                    // Go Up
+                    goUp();
+                }
             break;
 
             case Qt::Key_Left:
@@ -3461,6 +3616,12 @@ FilePanel::~FilePanel()
     // Save Settings
     saveSettings();
 
+    // Check File List Model
+    if (fileListModel) {
+        // Save Listing Snapshot
+        fileListModel->saveSnapshot(QDir::homePath() + "/" + QString(DEFAULT_LISTING_SNAPSHOT_FILENAME).arg(panelName));
+    }
+
     // Check Settings
     if (settings) {
         // Release
@@ -3469,6 +3630,18 @@ FilePanel::~FilePanel()
         settings = NULL;
     }
 
+    // Check File System Stats
+    if (fsStats) {
+        // Release
+        fsStats->release();
+        // Reset File System Stats
+        fsStats = NULL;
+    }
+
+    // Reset Image Providers - Deleted With The Engine
+    imageProvider = NULL;
+    thumbnailProvider = NULL;
+
     // Delete Quick Widget
     delete ui->fileListWidget;
     // Delete UI
@@ -4060,58 +4233,36 @@ DirScannerQueueItem::~DirScannerQueueItem()
 //==============================================================================
 // Constructor
 //==============================================================================
-DirScanner::DirScanner(QObject* aParent)
+DirScanner::DirScanner(const int& aMaxThreads, const int& aMaxPerDevice, QObject* aParent)
     : QObject(aParent)
-    , fileUtil(NULL)
-    , queueIndex(-1)
+    , sizeScanner(new DirSizeScanner(aMaxThreads, aMaxPerDevice))
 {
     qDebug() << "DirScanner::DirScanner";
 
+    // Connect Signals
+    connect(sizeScanner, SIGNAL(scanProgress(QString,quint64,quint64,quint64)), this, SLOT(scanProgress(QString,quint64,quint64,quint64)));
+    connect(sizeScanner, SIGNAL(scanFinished(QString,quint64,quint64,quint64)), this, SLOT(scanDone(QString,quint64,quint64,quint64)));
 }
 
 //==============================================================================
 // Scan Dir
 //==============================================================================
-void DirScanner::scanDir(const QString& aDirPath)
+void DirScanner::scanDir(const QString& aDirPath, const bool& aUseIndex)
 {
+    // Check If Already Scanning
+    if (findIndex(aDirPath) >= 0) {
+        return;
+    }
+
     qDebug() << "DirScanner::scanDir - aDirPath: " << aDirPath;
 
     // Add Item
     addItem(aDirPath);
+    // Set Item State
+    setItemState(findIndex(aDirPath), EDSSRunning);
 
-    // Check File Util
-    if (!fileUtil) {
-        // Create File Util
-        fileUtil = new RemoteFileUtilClient();
-
-        connect(fileUtil, SIGNAL(clientConnectionChanged(uint,bool)), this, SLOT(clientConnectionChanged(uint,bool)));
-        connect(fileUtil, SIGNAL(clientStatusChanged(uint,int)), this, SLOT(clientStatusChanged(uint,int)));
-        connect(fileUtil, SIGNAL(fileOpStarted(uint,QString,QString,QString,QString)), this, SLOT(fileOpStarted(uint,QString,QString,QString,QString)));
-        connect(fileUtil, SIGNAL(dirSizeScanProgress(uint,QString,quint64,quint64,quint64)), this, SLOT(fileOpDirSizeScanProgress(uint,QString,quint64,quint64,quint64)));
-        connect(fileUtil, SIGNAL(fileOpAborted(uint,QString,QString,QString,QString)), this, SLOT(fileOpAborted(uint,QString,QString,QString,QString)));
-        connect(fileUtil, SIGNAL(fileOpError(uint,QString,QString,QString,QString,int)), this, SLOT(fileOpError(uint,QString,QString,QString,QString,int)));
-        connect(fileUtil, SIGNAL(fileOpSkipped(uint,QString,QString,QString,QString)), this, SLOT(fileOpSkipped(uint,QString,QString,QString,QString)));
-        connect(fileUtil, SIGNAL(fileOpFinished(uint,QString,QString,QString,QString)), this, SLOT(fileOpFinished(uint,QString,QString,QString,QString)));
-    }
-
-    // Check File Util
-    if (fileUtil) {
-        // Check If Connected
-        if (!fileUtil->isConnected()) {
-            // Connect
-            fileUtil->connectToFileServer();
-        } else {
-            // Check Queue Index
-            if (queueIndex == -1) {
-                // Set Queue Index
-                queueIndex = 0;
-                // Clear Options
-                fileUtil->clearFileTransferOptions();
-                // Process Queue
-                QTimer::singleShot(1, this, SLOT(processQueue()));
-            }
-        }
-    }
+    // Scan Dir - Sub Dirs Are Walked In Parallel
+    sizeScanner->scanDir(aDirPath, aUseIndex);
 }
 
 //==============================================================================
@@ -4119,12 +4270,12 @@ void DirScanner::scanDir(const QString& aDirPath)
 //==============================================================================
 void DirScanner::abort()
 {
-    // Check File Util
-    if (fileUtil && (fileUtil->getStatus() == ECSTBusy || fileUtil->getStatus() == ECSTWaiting)) {
+    // Check Size Scanner
+    if (sizeScanner && sizeScanner->isBusy()) {
         qDebug() << "DirScanner::abort";
 
         // Abort
-        fileUtil->abort();
+        sizeScanner->abort();
     }
 }
 
@@ -4187,29 +4338,6 @@ int DirScanner::findIndex(const QString& aDirPath)
     return -1;
 }
 
-//==============================================================================
-// Process Queue
-//==============================================================================
-void DirScanner::processQueue()
-{
-    // Check Queue Index
-    if (fileUtil && queueIndex >= 0 && queueIndex < scanQueue.count()) {
-        qDebug() << "FileRenamer::processQueue - queueIndex: " << queueIndex;
-        // Get Dir Path
-        QString dirPath = scanQueue[queueIndex]->dirPath;
-        // Scan Dir
-        fileUtil->scanDirSize(dirPath);
-    } else {
-        // Check Queue Index
-        if (queueIndex != -1) {
-            // Clear Queue
-            clearQueue();
-            // Reset Queue Index
-            queueIndex = -1;
-        }
-    }
-}
-
 //==============================================================================
 // Clear Queue
 //==============================================================================
@@ -4228,73 +4356,19 @@ void DirScanner::clearQueue()
 }
 
 //==============================================================================
-// Client Connection Changed Slot
-//==============================================================================
-void DirScanner::clientConnectionChanged(const unsigned int& aID, const bool& aConnected)
-{
-    qDebug() << "DirScanner::clientConnectionChanged - aID: " << aID << " - aConnected: " << aConnected;
-
-    // Check If Connected
-    if (aConnected) {
-        // Check File Util
-        if (fileUtil) {
-            // Clear Options
-            fileUtil->clearFileTransferOptions();
-        }
-        // Reset Queue Index
-        queueIndex = 0;
-        // Process Queue
-        QTimer::singleShot(1, this, SLOT(processQueue()));
-    }
-}
-
-//==============================================================================
-// Client Status Changed Slot
-//==============================================================================
-void DirScanner::clientStatusChanged(const unsigned int& aID, const int& aStatus)
-{
-    qDebug() << "DirScanner::clientStatusChanged - aID: " << aID << " - aStatus: " << RemoteFileUtilClient::statusToString(aStatus);
-
-    // ...
-}
-
-//==============================================================================
-// File Operation Started Slot
+// Scan Progress Slot
 //==============================================================================
-void DirScanner::fileOpStarted(const unsigned int& aID,
-                   const QString& aOp,
-                   const QString& aPath,
-                   const QString& aSource,
-                   const QString& aTarget)
+void DirScanner::scanProgress(const QString& aDirPath, const quint64& aNumDirs, const quint64& aNumFiles, const quint64& aScannedSize)
 {
-    Q_UNUSED(aSource);
-    Q_UNUSED(aTarget);
-
-    qDebug() << "DirScanner::fileOpStarted - aID: " << aID << " - aOp: " << aOp << " - aPath: " << aPath;
-
-
-    // ...
-}
-
-//==============================================================================
-// Dir Size Scan Progress Signal
-//==============================================================================
-void DirScanner::fileOpDirSizeScanProgress(const unsigned int& aID,
-                                           const QString& aPath,
-                                           const quint64& aNumDirs,
-                                           const quint64& aNumFiles,
-                                           const quint64& aScannedSize)
-{
-    Q_UNUSED(aID);
     Q_UNUSED(aNumDirs);
     Q_UNUSED(aNumFiles);
 
     // Find Index
-    int dirIndex = findIndex(aPath);
+    int dirIndex = findIndex(aDirPath);
 
     // Check Queue Index
     if (dirIndex >= 0 && dirIndex < scanQueue.count()) {
-        //qDebug() << "DirScanner::fileOpDirSizeScanProgress - aID: " << aID << " - aPath: " << aPath << " - aNumDirs: " << aNumDirs << " - aNumFiles: " << aNumFiles << " - aScannedSize: " << aScannedSize;
+        //qDebug() << "DirScanner::scanProgress - aDirPath: " << aDirPath << " - aNumDirs: " << aNumDirs << " - aNumFiles: " << aNumFiles << " - aScannedSize: " << aScannedSize;
 
         // Get Item
         DirScannerQueueItem* item = scanQueue[dirIndex];
@@ -4307,123 +4381,31 @@ void DirScanner::fileOpDirSizeScanProgress(const unsigned int& aID,
 }
 
 //==============================================================================
-// File Operation Skipped Slot
+// Scan Finished Slot
 //==============================================================================
-void DirScanner::fileOpSkipped(const unsigned int& aID,
-                   const QString& aOp,
-                   const QString& aPath,
-                   const QString& aSource,
-                   const QString& aTarget)
+void DirScanner::scanDone(const QString& aDirPath, const quint64& aNumDirs, const quint64& aNumFiles, const quint64& aScannedSize)
 {
-    Q_UNUSED(aSource);
-    Q_UNUSED(aTarget);
-
-    qDebug() << "DirScanner::fileOpSkipped - aID: " << aID << " - aOp: " << aOp << " - aPath: " << aPath;
+    qDebug() << "DirScanner::scanDone - aDirPath: " << aDirPath << " - aNumDirs: " << aNumDirs << " - aNumFiles: " << aNumFiles << " - aScannedSize: " << aScannedSize;
 
-    // Check Operation
-    if (aOp == DEFAULT_OPERATION_SCAN_DIR) {
-        // Inc Queue Index
-        queueIndex++;
-
-        // Process Queue
-        processQueue();
-    }
-}
-
-//==============================================================================
-// File Operation Finished Slot
-//==============================================================================
-void DirScanner::fileOpFinished(const unsigned int& aID,
-                    const QString& aOp,
-                    const QString& aPath,
-                    const QString& aSource,
-                    const QString& aTarget)
-{
-    Q_UNUSED(aSource);
-    Q_UNUSED(aTarget);
-
-    qDebug() << "DirScanner::fileOpFinished - aID: " << aID << " - aOp: " << aOp << " - aPath: " << aPath;
-
-    // Check Operation
-    if (aOp == DEFAULT_OPERATION_SCAN_DIR) {
-        // Inc Queue Index
-        queueIndex++;
-        // Process Queue
-        processQueue();
-    }
-}
-
-//==============================================================================
-// File Operation Aborted Slot
-//==============================================================================
-void DirScanner::fileOpAborted(const unsigned int& aID,
-                   const QString& aOp,
-                   const QString& aPath,
-                   const QString& aSource,
-                   const QString& aTarget)
-{
-    Q_UNUSED(aSource);
-    Q_UNUSED(aTarget);
-
-    qDebug() << "DirScanner::fileOpAborted - aID: " << aID << " - aOp: " << aOp << " - aPath: " << aPath;
-
-    // ...
-}
-
-//==============================================================================
-// File Operation Error Slot
-//==============================================================================
-void DirScanner::fileOpError(const unsigned int& aID,
-                 const QString& aOp,
-                 const QString& aPath,
-                 const QString& aSource,
-                 const QString& aTarget,
-                 const int& aError)
-{
-    Q_UNUSED(aSource);
-    Q_UNUSED(aTarget);
-
-    qDebug() << "DirScanner::fileOpError - aID: " << aID << " - aOp: " << aOp << " - aPath: " << aPath << " - aError: " << aError;
-
-    // Check Operation
-    if (aOp == DEFAULT_OPERATION_SCAN_DIR) {
-        // Init Confirmation Dialog
-        ConfirmDialog confirmDialog;
-
-        // Set Dialog Title
-        confirmDialog.setConfirmTitle(tr(DEFAULT_ERROR_TITLE_SCAN_DIR));
-
-        // Switch Error
-        switch (aError) {
-            default:
-            case DEFAULT_ERROR_GENERAL: {
-                // Set Error Text
-                confirmDialog.setConfirmText(tr(DEFAULT_ERROR_TEXT_CANT_SCAN_DIR));
-                // Set Path
-                confirmDialog.setPath(aSource);
-            } break;
-        }
-
-
-        // Configure Standard Buttons
-        confirmDialog.configureButtons(QDialogButtonBox::Abort);
-
-        // Add Button
-        confirmDialog.addCustomButton(tr(DEFAULT_CONFIRM_BUTTON_TEXT_RETRY), QDialogButtonBox::AcceptRole, DEFAULT_CONFIRM_RETRY);
-        confirmDialog.addCustomButton(tr(DEFAULT_CONFIRM_BUTTON_TEXT_SKIP), QDialogButtonBox::AcceptRole, DEFAULT_CONFIRM_SKIP);
-        confirmDialog.addCustomButton(tr(DEFAULT_CONFIRM_BUTTON_TEXT_SKIPALL), QDialogButtonBox::AcceptRole, DEFAULT_CONFIRM_SKIPALL);
+    // Find Index
+    int dirIndex = findIndex(aDirPath);
 
-        // Exec Confirm Dialog
-        confirmDialog.exec();
+    // Check Queue Index
+    if (dirIndex >= 0 && dirIndex < scanQueue.count()) {
+        // Take Item
+        DirScannerQueueItem* item = scanQueue.takeAt(dirIndex);
+        // Update Scan Queue Item
+        item->dirSize = aScannedSize;
+        item->state = EDSSFinished;
 
-        // Get Action Index
-        int actionIndex = confirmDialog.getActionIndex();
+        // Emit Scan Size Changed Signal
+        emit scanSizeChanged(item->dirPath, item->dirSize);
+        // Emit Scan Finished Signal
+        emit scanFinished(item->dirPath);
 
-        // Check File Util
-        if (fileUtil) {
-            // Send User Response
-            fileUtil->sendUserResponse(actionIndex == -1 ? DEFAULT_CONFIRM_ABORT : actionIndex, confirmDialog.getPath());
-        }
+        // Delete Item
+        delete item;
+        item = NULL;
     }
 }
 
@@ -4437,6 +4419,13 @@ DirScanner::~DirScanner()
     // Clear Queue
     clearQueue();
 
+    // Check Size Scanner
+    if (sizeScanner) {
+        // Delete Size Scanner
+        delete sizeScanner;
+        sizeScanner = NULL;
+    }
+
     qDebug() << "DirScanner::~DirScanner";
 }
 
@@ -14,14 +14,18 @@ class FilePanel;
 }
 
 class FileListModel;
+class FileListSelection;
 class MainWindow;
 class FileListImageProvider;
+class ThumbnailImageProvider;
 class ConfirmDialog;
 class RemoteFileUtilClient;
 class TransferProgressModelItem;
 class FileRenamer;
 class DirScanner;
+class DirSizeScanner;
 class SettingsController;
+class FileSystemStats;
 class DirHistoryListModel;
 class DirHistoryListPopup;
 
@@ -239,6 +243,9 @@ public:
     // Get File List Model
     const FileListModel* getModel() const;
 
+    // Get Selection - Lazy Selected Paths View, Current File If Nothing Selected
+    FileListSelection getSelection();
+
     // Destructor
     virtual ~FilePanel();
 
@@ -277,6 +284,9 @@ public slots:
     // Set Visual Items Count
     void setVisualItemsCount(const int& aVisualCount);
 
+    // Set Visible Range - Image Requests For These Rows Are Served First
+    void setVisibleRange(const int& aFirstIndex, const int& aLastIndex);
+
     // Get Supported Image Formats
     QStringList getSupportedImageFormats();
 
@@ -302,14 +312,19 @@ public slots:
     // Deselect Files
     void deselectFiles(const QString& aPattern);
 
-    // Get Selected Files
-    QStringList getSelectedFiles();
+    // Get Selected Files Count - Without Building The Path List
+    int getSelectedFilesCount();
+
+    // Set Quick Filter - Keeps Current File If Still Visible
+    void setQuickFilter(const QString& aQuickFilter);
+    // Get Quick Filter
+    QString getQuickFilter();
 
     // Rename File
     void renameFile(const QString& aSource, const QString& aTarget);
 
-    // Scan Dir
-    void scanDir(const QString& aDirPath);
+    // Scan Dir - aUseIndex Only Reads Dirs Changed Since They Were Indexed
+    void scanDir(const QString& aDirPath, const bool& aUseIndex = false);
 
     // Launch Dir History Popup
     void launchDirHistoryPopup();
@@ -532,6 +547,11 @@ protected slots: // From QFileSystemWatcher
     // File Changed Slot
     void fileChanged(const QString& aFilePath);
 
+protected slots: // From File System Stats
+
+    // File System Stats Changed Slot
+    void fsStatsChanged(const QString& aMountPoint, const qint64& aFree, const qint64& aTotal);
+
 protected slots: // From File Renamer
 
     // Rename Finished Slot
@@ -605,6 +625,8 @@ private:
 
     // Settings
     SettingsController*     settings;
+    // File System Stats
+    FileSystemStats*        fsStats;
 
     // Global Settings Update Is Ongoing
     bool                    globalSettingsUpdateIsOn;
@@ -737,6 +759,11 @@ private:
     QStringList             droppedItemsList;
     // Drop Command
     int                     dropCommand;
+
+    // Image Provider - Owned By The Engine
+    FileListImageProvider*  imageProvider;
+    // Thumbnail Provider - Owned By The Engine
+    ThumbnailImageProvider* thumbnailProvider;
 };
 
 
@@ -940,11 +967,11 @@ class DirScanner : public QObject
 
 public:
 
-    // Constructor
-    explicit DirScanner(QObject* aParent = NULL);
+    // Constructor - aMaxThreads <= 0 Uses The Ideal Thread Count
+    explicit DirScanner(const int& aMaxThreads = 0, const int& aMaxPerDevice = 0, QObject* aParent = NULL);
 
-    // Scan Dir
-    void scanDir(const QString& aDirPath);
+    // Scan Dir - aUseIndex Only Reads Dirs Changed Since They Were Indexed
+    void scanDir(const QString& aDirPath, const bool& aUseIndex = false);
 
     // Abort
     void abort();
@@ -973,70 +1000,21 @@ protected slots:
     // Find Index
     int findIndex(const QString& aDirPath);
 
-    // Process Queue
-    void processQueue();
-
-protected slots: // For RemoteFileUtilClient
-
-    // Client Connection Changed Slot
-    void clientConnectionChanged(const unsigned int& aID, const bool& aConnected);
-
-    // Client Status Changed Slot
-    void clientStatusChanged(const unsigned int& aID, const int& aStatus);
+protected slots: // For DirSizeScanner
 
-    // File Operation Started Slot
-    void fileOpStarted(const unsigned int& aID,
-                       const QString& aOp,
-                       const QString& aPath,
-                       const QString& aSource,
-                       const QString& aTarget);
+    // Scan Progress Slot
+    void scanProgress(const QString& aDirPath, const quint64& aNumDirs, const quint64& aNumFiles, const quint64& aScannedSize);
 
-    // Dir Size Scan Progress Signal
-    void fileOpDirSizeScanProgress(const unsigned int& aID,
-                                   const QString& aPath,
-                                   const quint64& aNumDirs,
-                                   const quint64& aNumFiles,
-                                   const quint64& aScannedSize);
-
-    // File Operation Skipped Slot
-    void fileOpSkipped(const unsigned int& aID,
-                       const QString& aOp,
-                       const QString& aPath,
-                       const QString& aSource,
-                       const QString& aTarget);
+    // Scan Finished Slot
+    void scanDone(const QString& aDirPath, const quint64& aNumDirs, const quint64& aNumFiles, const quint64& aScannedSize);
 
-    // File Operation Finished Slot
-    void fileOpFinished(const unsigned int& aID,
-                        const QString& aOp,
-                        const QString& aPath,
-                        const QString& aSource,
-                        const QString& aTarget);
-
-    // File Operation Aborted Slot
-    void fileOpAborted(const unsigned int& aID,
-                       const QString& aOp,
-                       const QString& aPath,
-                       const QString& aSource,
-                       const QString& aTarget);
-
-    // File Operation Error Slot
-    void fileOpError(const unsigned int& aID,
-                     const QString& aOp,
-                     const QString& aPath,
-                     const QString& aSource,
-                     const QString& aTarget,
-                     const int& aError);
-
-protected: // For RemoteFileUtilClient
+protected:
 
-    // File Util
-    RemoteFileUtilClient*               fileUtil;
+    // Size Scanner
+    DirSizeScanner*                     sizeScanner;
 
-    // Rename Items Queue
+    // Scan Items Queue
     QList<DirScannerQueueItem*>         scanQueue;
-
-    // Queue Index
-    int                                 queueIndex;
 };
 
 
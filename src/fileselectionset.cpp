@@ -0,0 +1,289 @@
+#include <QtAlgorithms>
+
+#include "fileselectionset.h"
+
+// Bits Per Word
+#define SELECTION_WORD_BITS     64
+
+
+//==============================================================================
+// Constructor
+//==============================================================================
+FileSelectionSet::FileSelectionSet()
+    : bitCount(0)
+{
+}
+
+//==============================================================================
+// Get Size
+//==============================================================================
+int FileSelectionSet::size() const
+{
+    return bitCount;
+}
+
+//==============================================================================
+// Get Set Bits Count
+//==============================================================================
+int FileSelectionSet::count() const
+{
+    // Init Count
+    int result = 0;
+    // Get Words Count
+    int wCount = words.count();
+    // Go Thru Words
+    for (int i = 0; i < wCount; ++i) {
+        // Add Word Population Count
+        result += qPopulationCount(words[i]);
+    }
+
+    return result;
+}
+
+//==============================================================================
+// Is Any Bit Set
+//==============================================================================
+bool FileSelectionSet::any() const
+{
+    // Get Words Count
+    int wCount = words.count();
+    // Go Thru Words
+    for (int i = 0; i < wCount; ++i) {
+        // Check Word
+        if (words[i]) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+//==============================================================================
+// Test Bit
+//==============================================================================
+bool FileSelectionSet::test(const int& aIndex) const
+{
+    // Check Index
+    if (aIndex < 0 || aIndex >= bitCount) {
+        return false;
+    }
+
+    return (words[aIndex / SELECTION_WORD_BITS] >> (aIndex % SELECTION_WORD_BITS)) & 1;
+}
+
+//==============================================================================
+// Set Bit
+//==============================================================================
+bool FileSelectionSet::set(const int& aIndex, const bool& aValue)
+{
+    // Check Index
+    if (aIndex < 0 || aIndex >= bitCount || test(aIndex) == aValue) {
+        return false;
+    }
+
+    // Flip Bit
+    words[aIndex / SELECTION_WORD_BITS] ^= (quint64(1) << (aIndex % SELECTION_WORD_BITS));
+
+    return true;
+}
+
+//==============================================================================
+// Insert Bit
+//==============================================================================
+void FileSelectionSet::insert(const int& aIndex, const bool& aValue)
+{
+    // Get Bounded Index
+    int index = qBound(0, aIndex, bitCount);
+
+    // Check If New Word Needed
+    if (bitCount % SELECTION_WORD_BITS == 0) {
+        // Add Word
+        words.append(0);
+    }
+
+    // Inc Bit Count
+    bitCount++;
+
+    // Get Words Count
+    int wCount = words.count();
+    // Get First Word Index
+    int firstWord = index / SELECTION_WORD_BITS;
+
+    // Shift Following Words Up By One Bit, From The Back
+    for (int i = wCount - 1; i > firstWord; --i) {
+        // Shift Word And Carry In Top Bit Of Previous Word
+        words[i] = (words[i] << 1) | (words[i - 1] >> (SELECTION_WORD_BITS - 1));
+    }
+
+    // Get Bit Position In First Word
+    int bit = index % SELECTION_WORD_BITS;
+    // Get Low Mask
+    quint64 lowMask = (quint64(1) << bit) - 1;
+    // Shift Upper Part Of First Word
+    words[firstWord] = (words[firstWord] & lowMask) | ((words[firstWord] & ~lowMask) << 1);
+
+    // Set Inserted Bit
+    if (aValue) {
+        words[firstWord] |= (quint64(1) << bit);
+    }
+}
+
+//==============================================================================
+// Append Bit
+//==============================================================================
+void FileSelectionSet::append(const bool& aValue)
+{
+    // Check If New Word Needed
+    if (bitCount % SELECTION_WORD_BITS == 0) {
+        // Add Word
+        words.append(0);
+    }
+
+    // Set Bit
+    if (aValue) {
+        words[bitCount / SELECTION_WORD_BITS] |= (quint64(1) << (bitCount % SELECTION_WORD_BITS));
+    }
+
+    // Inc Bit Count
+    bitCount++;
+}
+
+//==============================================================================
+// Remove Bit
+//==============================================================================
+void FileSelectionSet::remove(const int& aIndex)
+{
+    // Check Index
+    if (aIndex < 0 || aIndex >= bitCount) {
+        return;
+    }
+
+    // Get Words Count
+    int wCount = words.count();
+    // Get First Word Index
+    int firstWord = aIndex / SELECTION_WORD_BITS;
+    // Get Bit Position In First Word
+    int bit = aIndex % SELECTION_WORD_BITS;
+    // Get Low Mask
+    quint64 lowMask = (quint64(1) << bit) - 1;
+
+    // Drop Bit From First Word
+    words[firstWord] = (words[firstWord] & lowMask) | ((words[firstWord] >> 1) & ~lowMask);
+
+    // Shift Following Words Down By One Bit
+    for (int i = firstWord + 1; i < wCount; ++i) {
+        // Carry Lowest Bit Into Top Of Previous Word
+        words[i - 1] |= (words[i] & 1) << (SELECTION_WORD_BITS - 1);
+        // Shift Word
+        words[i] >>= 1;
+    }
+
+    // Dec Bit Count
+    bitCount--;
+
+    // Check If Last Word Unused
+    if (bitCount % SELECTION_WORD_BITS == 0) {
+        // Remove Last Word
+        words.removeLast();
+    }
+}
+
+//==============================================================================
+// Clear
+//==============================================================================
+void FileSelectionSet::clear()
+{
+    // Clear Words
+    words.clear();
+    // Reset Bit Count
+    bitCount = 0;
+}
+
+//==============================================================================
+// Set All Bits
+//==============================================================================
+void FileSelectionSet::fill(const bool& aValue)
+{
+    // Fill Words
+    words.fill(aValue ? ~quint64(0) : quint64(0));
+    // Trim Last Word
+    trimLastWord();
+}
+
+//==============================================================================
+// Invert All Bits
+//==============================================================================
+void FileSelectionSet::invert()
+{
+    // Get Words Count
+    int wCount = words.count();
+    // Go Thru Words
+    for (int i = 0; i < wCount; ++i) {
+        // Invert Word
+        words[i] = ~words[i];
+    }
+
+    // Trim Last Word
+    trimLastWord();
+}
+
+//==============================================================================
+// Clear Bits Set In Mask
+//==============================================================================
+void FileSelectionSet::subtract(const FileSelectionSet& aMask)
+{
+    // Get Words Count
+    int wCount = qMin(words.count(), aMask.words.count());
+    // Go Thru Words
+    for (int i = 0; i < wCount; ++i) {
+        // Clear Masked Bits
+        words[i] &= ~aMask.words[i];
+    }
+}
+
+//==============================================================================
+// Find Next Set Bit From Index
+//==============================================================================
+int FileSelectionSet::nextSetBit(const int& aIndex) const
+{
+    // Check Index
+    if (aIndex >= bitCount) {
+        return -1;
+    }
+
+    // Get Start Index
+    int index = qMax(0, aIndex);
+    // Get Word Index
+    int wIndex = index / SELECTION_WORD_BITS;
+    // Get Words Count
+    int wCount = words.count();
+    // Get First Word Masked Below Start Bit
+    quint64 word = words[wIndex] & (~quint64(0) << (index % SELECTION_WORD_BITS));
+
+    // Skip Empty Words
+    while (!word) {
+        // Check Next Word Index
+        if (++wIndex >= wCount) {
+            return -1;
+        }
+        // Get Next Word
+        word = words[wIndex];
+    }
+
+    return wIndex * SELECTION_WORD_BITS + qCountTrailingZeroBits(word);
+}
+
+//==============================================================================
+// Clear Unused Bits Of The Last Word
+//==============================================================================
+void FileSelectionSet::trimLastWord()
+{
+    // Get Used Bits In Last Word
+    int usedBits = bitCount % SELECTION_WORD_BITS;
+
+    // Check Last Word
+    if (usedBits && !words.isEmpty()) {
+        // Clear Unused Bits
+        words.last() &= (quint64(1) << usedBits) - 1;
+    }
+}
@@ -0,0 +1,61 @@
+#ifndef FILESELECTIONSET_H
+#define FILESELECTIONSET_H
+
+#include <QVector>
+#include <QtGlobal>
+
+
+//==============================================================================
+// File Selection Set Class - One Bit Per Row
+//==============================================================================
+class FileSelectionSet
+{
+public:
+    // Constructor
+    explicit FileSelectionSet();
+
+    // Get Size
+    int size() const;
+    // Get Set Bits Count - Popcount Over Words
+    int count() const;
+    // Is Any Bit Set
+    bool any() const;
+
+    // Test Bit
+    bool test(const int& aIndex) const;
+    // Set Bit, Returns True If Changed
+    bool set(const int& aIndex, const bool& aValue);
+
+    // Insert Bit - Shifts Following Bits Up
+    void insert(const int& aIndex, const bool& aValue = false);
+    // Append Bit
+    void append(const bool& aValue = false);
+    // Remove Bit - Shifts Following Bits Down
+    void remove(const int& aIndex);
+    // Clear - Size Becomes 0
+    void clear();
+
+    // Set All Bits
+    void fill(const bool& aValue);
+    // Invert All Bits
+    void invert();
+    // Clear Bits Set In Mask
+    void subtract(const FileSelectionSet& aMask);
+
+    // Find Next Set Bit From Index, Returns -1 If None
+    int nextSetBit(const int& aIndex) const;
+
+protected:
+
+    // Clear Unused Bits Of The Last Word
+    void trimLastWord();
+
+protected:
+
+    // Words
+    QVector<quint64>    words;
+    // Size In Bits
+    int                 bitCount;
+};
+
+#endif // FILESELECTIONSET_H
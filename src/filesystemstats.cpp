@@ -0,0 +1,488 @@
+#include <QFile>
+#include <QDateTime>
+#include <QStorageInfo>
+#include <QMutexLocker>
+#include <QTimerEvent>
+#include <QDebug>
+
+#include <algorithm>
+
+#if defined(Q_OS_UNIX)
+
+#include <sys/statvfs.h>
+
+#endif // Q_OS_UNIX
+
+#include "filesystemstats.h"
+#include "constants.h"
+
+
+// File System Stats Singleton
+static FileSystemStats* fileSystemStatsSingleton = NULL;
+// Singleton Mutex
+static QMutex fileSystemStatsMutex;
+
+
+//==============================================================================
+// Compare Mount Points - Longest First
+//==============================================================================
+static bool mountPointLonger(const QString& aLeft, const QString& aRight)
+{
+    return aLeft.length() > aRight.length();
+}
+
+
+//==============================================================================
+// Constructor
+//==============================================================================
+FileSystemStatsItem::FileSystemStatsItem(const qint64& aFree, const qint64& aTotal, const qint64& aUpdated)
+    : free(aFree)
+    , total(aTotal)
+    , updated(aUpdated)
+    , queried(0)
+{
+}
+
+
+
+
+
+
+
+//==============================================================================
+// Constructor
+//==============================================================================
+FileSystemStatsOwner::FileSystemStatsOwner(FileSystemStats* aStats)
+    : stats(aStats)
+{
+}
+
+
+
+
+
+
+
+//==============================================================================
+// Get Instance - Static Constructor
+//==============================================================================
+FileSystemStats* FileSystemStats::getInstance()
+{
+    QMutexLocker locker(&fileSystemStatsMutex);
+
+    // Check Singleton
+    if (!fileSystemStatsSingleton) {
+        // Create Singleton
+        fileSystemStatsSingleton = new FileSystemStats();
+    } else {
+        // Inc Ref Count
+        fileSystemStatsSingleton->refCount++;
+    }
+
+    return fileSystemStatsSingleton;
+}
+
+//==============================================================================
+// Constructor
+//==============================================================================
+FileSystemStats::FileSystemStats(QObject* aParent)
+    : QObject(aParent)
+    , refCount(1)
+    , mountTableLoaded(0)
+    , refreshTimerID(-1)
+    , owner(new FileSystemStatsOwner(this))
+    , statsPool(new QThreadPool())
+{
+    qDebug() << "FileSystemStats::FileSystemStats";
+
+    // Set Max Thread Count - A Hung Mount Holds One Thread Only
+    statsPool->setMaxThreadCount(DEFAULT_FS_STATS_THREADS);
+
+    // Start Refresh Timer
+    refreshTimerID = startTimer(DEFAULT_FS_STATS_REFRESH_INTERVAL);
+}
+
+//==============================================================================
+// Release
+//==============================================================================
+void FileSystemStats::release()
+{
+    QMutexLocker locker(&fileSystemStatsMutex);
+
+    // Dec Ref Count
+    refCount--;
+
+    // Check Ref Count
+    if (refCount <= 0 && fileSystemStatsSingleton) {
+        // Delete Singleton
+        delete fileSystemStatsSingleton;
+        fileSystemStatsSingleton = NULL;
+    }
+}
+
+//==============================================================================
+// Get Mount Point For Path
+//==============================================================================
+QString FileSystemStats::mountPoint(const QString& aPath)
+{
+    QMutexLocker locker(&cacheMutex);
+
+    return findMountPoint(aPath);
+}
+
+//==============================================================================
+// Get Stats
+//==============================================================================
+bool FileSystemStats::stats(const QString& aPath, qint64& aFree, qint64& aTotal)
+{
+    QMutexLocker locker(&cacheMutex);
+
+    // Get Mount Point
+    QString mp = findMountPoint(aPath);
+    // Get Now
+    qint64 now = QDateTime::currentMSecsSinceEpoch();
+    // Get Item
+    FileSystemStatsItem& item = cache[mp];
+
+    // Set Queried
+    item.queried = now;
+
+    // Check If Stale
+    if (now - item.updated >= DEFAULT_FS_STATS_TTL) {
+        // Schedule Refresh - Stale Values Are Still Returned
+        scheduleRefresh(mp);
+    }
+
+    // Set Free
+    aFree = item.free;
+    // Set Total
+    aTotal = item.total;
+
+    return item.total >= 0;
+}
+
+//==============================================================================
+// Invalidate
+//==============================================================================
+void FileSystemStats::invalidate(const QString& aPath)
+{
+    QMutexLocker locker(&cacheMutex);
+
+    // Get Mount Point
+    QString mp = findMountPoint(aPath);
+
+    // Check Cache
+    if (cache.contains(mp)) {
+        // Reset Updated
+        cache[mp].updated = 0;
+    }
+
+    // Schedule Refresh
+    scheduleRefresh(mp);
+}
+
+//==============================================================================
+// Load Mount Table
+//==============================================================================
+void FileSystemStats::loadMountTable()
+{
+    // Clear Mount Points
+    mountPoints.clear();
+
+#if defined(Q_OS_LINUX)
+
+    // Init Mount Info File - Kernel Table, Reading It Never Touches The Mounts
+    QFile mountInfoFile("/proc/self/mountinfo");
+
+    // Open File
+    if (mountInfoFile.open(QIODevice::ReadOnly)) {
+        // Init Line
+        QByteArray line;
+
+        // Go Thru Lines - Proc Files Have No Size, Read Until Empty
+        while (!(line = mountInfoFile.readLine()).isEmpty()) {
+            // Split Line - ID, Parent ID, Major:Minor, Root, Mount Point, ...
+            QList<QByteArray> fields = line.split(' ');
+
+            // Check Fields
+            if (fields.count() > 4) {
+                // Add Mount Point
+                mountPoints << unescapeMountField(fields[4]);
+            }
+        }
+
+        // Close File
+        mountInfoFile.close();
+    }
+
+#else // Q_OS_LINUX
+
+    // Go Thru Mounted Volumes
+    foreach (const QStorageInfo& volume, QStorageInfo::mountedVolumes()) {
+        // Add Mount Point
+        mountPoints << volume.rootPath();
+    }
+
+#endif // Q_OS_LINUX
+
+    // Remove Duplicates - Over Mounts
+    mountPoints.removeDuplicates();
+
+    // Sort Mount Points - Longest Prefix Wins
+    std::sort(mountPoints.begin(), mountPoints.end(), mountPointLonger);
+
+    // Set Mount Table Loaded
+    mountTableLoaded = QDateTime::currentMSecsSinceEpoch();
+}
+
+//==============================================================================
+// Find Mount Point
+//==============================================================================
+QString FileSystemStats::findMountPoint(const QString& aPath)
+{
+    // Check Mount Table Age
+    if (QDateTime::currentMSecsSinceEpoch() - mountTableLoaded >= DEFAULT_FS_STATS_MOUNT_TABLE_TTL) {
+        // Load Mount Table
+        loadMountTable();
+    }
+
+    // Go Thru Mount Points
+    foreach (const QString& mp, mountPoints) {
+        // Get Prefix
+        QString prefix = mp.endsWith('/') ? mp : mp + "/";
+
+        // Check Path
+        if (aPath == mp || aPath.startsWith(prefix)) {
+            return mp;
+        }
+    }
+
+    return aPath;
+}
+
+//==============================================================================
+// Schedule Refresh
+//==============================================================================
+void FileSystemStats::scheduleRefresh(const QString& aMountPoint)
+{
+    // Check Pending Mounts
+    if (pendingMounts.contains(aMountPoint)) {
+        return;
+    }
+
+    // Add Pending Mount
+    pendingMounts << aMountPoint;
+
+    // Start Resolver
+    statsPool->start(new FileSystemStatsResolver(owner, aMountPoint));
+}
+
+//==============================================================================
+// Store Resolved Stats
+//==============================================================================
+void FileSystemStats::storeStats(const QString& aMountPoint, const qint64& aFree, const qint64& aTotal)
+{
+    // Init Changed
+    bool changed = false;
+
+    {
+        QMutexLocker locker(&cacheMutex);
+
+        // Remove Pending Mount
+        pendingMounts.remove(aMountPoint);
+
+        // Get Item
+        FileSystemStatsItem& item = cache[aMountPoint];
+
+        // Set Changed
+        changed = item.free != aFree || item.total != aTotal;
+        // Set Free
+        item.free = aFree;
+        // Set Total
+        item.total = aTotal;
+        // Set Updated
+        item.updated = QDateTime::currentMSecsSinceEpoch();
+    }
+
+    // Check Changed
+    if (changed) {
+        //qDebug() << "FileSystemStats::storeStats - aMountPoint: " << aMountPoint << " - aFree: " << aFree << " - aTotal: " << aTotal;
+
+        // Emit Stats Changed Signal
+        emit statsChanged(aMountPoint, aFree, aTotal);
+    }
+}
+
+//==============================================================================
+// Resolve Stats - Blocking
+//==============================================================================
+bool FileSystemStats::resolve(const QString& aMountPoint, qint64& aFree, qint64& aTotal)
+{
+#if defined(Q_OS_UNIX)
+
+    // Init Stat
+    struct statvfs st;
+
+    // Get File System Stat
+    if (statvfs(QFile::encodeName(aMountPoint).constData(), &st) != 0) {
+        return false;
+    }
+
+    // Set Free - Available To Unprivileged Users
+    aFree = (qint64)st.f_bavail * (qint64)st.f_frsize;
+    // Set Total
+    aTotal = (qint64)st.f_blocks * (qint64)st.f_frsize;
+
+#else // Q_OS_UNIX
+
+    // Init Storage Info
+    QStorageInfo storageInfo(aMountPoint);
+
+    // Check Storage Info
+    if (!storageInfo.isValid()) {
+        return false;
+    }
+
+    // Set Free
+    aFree = storageInfo.bytesAvailable();
+    // Set Total
+    aTotal = storageInfo.bytesTotal();
+
+#endif // Q_OS_UNIX
+
+    return true;
+}
+
+//==============================================================================
+// Unescape Mount Info Field - Octal Escapes Like \040
+//==============================================================================
+QString FileSystemStats::unescapeMountField(const QByteArray& aField)
+{
+    // Init Result
+    QByteArray result;
+    // Get Field Length
+    int fLength = aField.length();
+
+    // Reserve Result
+    result.reserve(fLength);
+
+    // Go Thru Field
+    for (int i = 0; i < fLength; ++i) {
+        // Check Escape
+        if (aField[i] == '\\' && i + 3 < fLength && aField[i + 1] >= '0' && aField[i + 1] <= '7') {
+            // Add Unescaped Char
+            result += (char)aField.mid(i + 1, 3).toInt(NULL, 8);
+            // Skip Escape
+            i += 3;
+        } else {
+            // Add Char
+            result += aField[i];
+        }
+    }
+
+    return QFile::decodeName(result.trimmed());
+}
+
+//==============================================================================
+// Timer Event
+//==============================================================================
+void FileSystemStats::timerEvent(QTimerEvent* aEvent)
+{
+    // Check Event
+    if (!aEvent || aEvent->timerId() != refreshTimerID) {
+        return;
+    }
+
+    QMutexLocker locker(&cacheMutex);
+
+    // Get Now
+    qint64 now = QDateTime::currentMSecsSinceEpoch();
+
+    // Go Thru Cache
+    QHash<QString, FileSystemStatsItem>::const_iterator it = cache.constBegin();
+    while (it != cache.constEnd()) {
+        // Check If Recently Queried And Stale
+        if (now - it.value().queried < DEFAULT_FS_STATS_WATCH_TIME && now - it.value().updated >= DEFAULT_FS_STATS_TTL) {
+            // Schedule Refresh
+            scheduleRefresh(it.key());
+        }
+
+        ++it;
+    }
+}
+
+//==============================================================================
+// Destructor
+//==============================================================================
+FileSystemStats::~FileSystemStats()
+{
+    // Check Refresh Timer ID
+    if (refreshTimerID != -1) {
+        // Kill Refresh Timer
+        killTimer(refreshTimerID);
+        refreshTimerID = -1;
+    }
+
+    {
+        QMutexLocker locker(&owner->mutex);
+        // Detach Resolvers
+        owner->stats = NULL;
+    }
+
+    // Drop Queued Resolvers
+    statsPool->clear();
+
+    // Wait For Running Resolvers
+    if (statsPool->waitForDone(DEFAULT_FS_STATS_SHUTDOWN_TIMEOUT)) {
+        // Delete Stats Pool
+        delete statsPool;
+    } else {
+        qWarning() << "FileSystemStats::~FileSystemStats - STATS POOL BUSY, LEAKING!!";
+    }
+
+    statsPool = NULL;
+
+    qDebug() << "FileSystemStats::~FileSystemStats";
+}
+
+
+
+
+
+
+
+//==============================================================================
+// Constructor
+//==============================================================================
+FileSystemStatsResolver::FileSystemStatsResolver(const QSharedPointer<FileSystemStatsOwner>& aOwner, const QString& aMountPoint)
+    : QRunnable()
+    , owner(aOwner)
+    , mountPoint(aMountPoint)
+{
+}
+
+//==============================================================================
+// Run
+//==============================================================================
+void FileSystemStatsResolver::run()
+{
+    // Init Free
+    qint64 free = -1;
+    // Init Total
+    qint64 total = -1;
+
+    // Resolve Stats - May Block On Hung Network Mounts
+    if (!FileSystemStats::resolve(mountPoint, free, total)) {
+        // Reset Free & Total
+        free = -1;
+        total = -1;
+    }
+
+    QMutexLocker locker(&owner->mutex);
+
+    // Check Stats
+    if (owner->stats) {
+        // Store Stats
+        owner->stats->storeStats(mountPoint, free, total);
+    }
+}
@@ -0,0 +1,172 @@
+#ifndef FILESYSTEMSTATS_H
+#define FILESYSTEMSTATS_H
+
+#include <QObject>
+#include <QString>
+#include <QStringList>
+#include <QHash>
+#include <QSet>
+#include <QMutex>
+#include <QSharedPointer>
+#include <QThreadPool>
+#include <QRunnable>
+
+class FileSystemStats;
+
+
+//==============================================================================
+// File System Stats Item Class
+//==============================================================================
+class FileSystemStatsItem
+{
+public:
+    // Constructor
+    explicit FileSystemStatsItem(const qint64& aFree = -1, const qint64& aTotal = -1, const qint64& aUpdated = 0);
+
+    // Free Bytes Available To The User
+    qint64          free;
+    // Total Bytes
+    qint64          total;
+    // Last Updated - msecs Since Epoch, 0 Forces A Refresh
+    qint64          updated;
+    // Last Queried - msecs Since Epoch
+    qint64          queried;
+};
+
+
+
+
+//==============================================================================
+// File System Stats Owner Class - Outlives The Cache While Workers Are Stuck
+//==============================================================================
+class FileSystemStatsOwner
+{
+public:
+    // Constructor
+    explicit FileSystemStatsOwner(FileSystemStats* aStats);
+
+    // Owner Mutex
+    QMutex              mutex;
+    // Stats - NULL Once The Cache Is Gone
+    FileSystemStats*    stats;
+};
+
+
+
+
+//==============================================================================
+// File System Stats Class - Per Mount Free/Total Space Cache, Never Blocks
+//==============================================================================
+class FileSystemStats : public QObject
+{
+    Q_OBJECT
+
+public:
+
+    // Get Instance - Static Constructor
+    static FileSystemStats* getInstance();
+
+    // Release
+    void release();
+
+    // Get Mount Point For Path - Uses The Mount Table, No I/O On The Path
+    QString mountPoint(const QString& aPath);
+
+    // Get Stats - Returns Cached Values, Schedules Refresh If Stale Or Missing
+    bool stats(const QString& aPath, qint64& aFree, qint64& aTotal);
+
+    // Invalidate - Refresh Mount Of Path, Call After Writes
+    void invalidate(const QString& aPath);
+
+signals:
+
+    // Stats Changed Signal
+    void statsChanged(const QString& aMountPoint, const qint64& aFree, const qint64& aTotal);
+
+protected: // From QObject
+
+    // Timer Event
+    virtual void timerEvent(QTimerEvent* aEvent);
+
+protected: // Constructor/Destructor
+
+    // Constructor
+    explicit FileSystemStats(QObject* aParent = NULL);
+
+    // Destructor
+    virtual ~FileSystemStats();
+
+protected:
+    friend class FileSystemStatsResolver;
+
+    // Load Mount Table - /proc/self/mountinfo On Linux
+    void loadMountTable();
+    // Find Mount Point - Cache Mutex Must Be Held
+    QString findMountPoint(const QString& aPath);
+
+    // Schedule Refresh - At Most One Request In Flight Per Mount
+    void scheduleRefresh(const QString& aMountPoint);
+
+    // Store Resolved Stats
+    void storeStats(const QString& aMountPoint, const qint64& aFree, const qint64& aTotal);
+
+    // Resolve Stats - Blocking, Runs On The Stats Pool
+    static bool resolve(const QString& aMountPoint, qint64& aFree, qint64& aTotal);
+
+    // Unescape Mount Info Field
+    static QString unescapeMountField(const QByteArray& aField);
+
+protected:
+
+    // Int Ref Counter
+    int                                     refCount;
+
+    // Cache Mutex
+    QMutex                                  cacheMutex;
+
+    // Mount Points - Longest First
+    QStringList                             mountPoints;
+    // Mount Table Loaded - msecs Since Epoch
+    qint64                                  mountTableLoaded;
+
+    // Stats Cache By Mount Point
+    QHash<QString, FileSystemStatsItem>     cache;
+    // Mounts With Requests In Flight
+    QSet<QString>                           pendingMounts;
+
+    // Refresh Timer ID
+    int                                     refreshTimerID;
+
+    // Owner - Shared With Resolvers
+    QSharedPointer<FileSystemStatsOwner>    owner;
+
+    // Stats Thread Pool - Leaked On Exit If A Mount Hangs
+    QThreadPool*                            statsPool;
+};
+
+
+
+
+//==============================================================================
+// File System Stats Resolver Class - Runs statvfs On The Stats Pool
+//==============================================================================
+class FileSystemStatsResolver : public QRunnable
+{
+public:
+    // Constructor
+    explicit FileSystemStatsResolver(const QSharedPointer<FileSystemStatsOwner>& aOwner, const QString& aMountPoint);
+
+protected: // From QRunnable
+
+    // Run
+    virtual void run();
+
+protected:
+
+    // Owner
+    QSharedPointer<FileSystemStatsOwner>    owner;
+    // Mount Point
+    QString                                 mountPoint;
+};
+
+#endif // FILESYSTEMSTATS_H
@@ -1,5 +1,7 @@
 #include <QSettings>
 #include <QKeyEvent>
+#include <QImageReader>
+#include <QFileInfo>
 #include <QDebug>
 
 #include "helpwindow.h"
@@ -22,9 +24,17 @@ HelpWindow::HelpWindow(QWidget* aParent)
 void HelpWindow::loadContent(const QUrl& aURL)
 {
     // Check URL
-    if (!aURL.isEmpty()) {
-        // Set URL
-        ui->webView->load(aURL);
+    if (aURL.isEmpty()) {
+        return;
+    }
+
+    // Check If Image - Text Browser Shows Images Only Embedded In HTML
+    if (QImageReader::supportedImageFormats().contains(QFileInfo(aURL.path()).suffix().toLower().toLatin1())) {
+        // Set HTML
+        ui->contentView->setHtml(QString("<img src=\"%1\">").arg(aURL.toString().toHtmlEscaped()));
+    } else {
+        // Set Source
+        ui->contentView->setSource(aURL);
     }
 }
 
@@ -0,0 +1,502 @@
+#include <QMutexLocker>
+#include <QDirIterator>
+#include <QFileInfo>
+#include <QSaveFile>
+#include <QFile>
+#include <QDir>
+#include <QDateTime>
+#include <QMimeDatabase>
+#include <QIcon>
+#include <QDebug>
+
+#include "iconthemeindex.h"
+#include "constants.h"
+
+
+// Icon Theme Index Singleton
+static IconThemeIndex* iconThemeIndexSingleton = NULL;
+// Singleton Mutex
+static QMutex iconThemeIndexMutex;
+
+// Icon Theme Index File Magic
+#define ICON_THEME_INDEX_MAGIC          0x4d434954
+// Icon Theme Index File Version
+#define ICON_THEME_INDEX_VERSION        1
+
+
+//==============================================================================
+// Constructor
+//==============================================================================
+IconThemeIndexItem::IconThemeIndexItem()
+{
+}
+
+//==============================================================================
+// Get Best Path For Size
+//==============================================================================
+QString IconThemeIndexItem::path(const int& aSize) const
+{
+    // Get Exact Size Path
+    QString exactPath = sizes.value(aSize);
+
+    // Check Exact Size Path
+    if (!exactPath.isEmpty()) {
+        return exactPath;
+    }
+
+    // Check Scalable Path
+    if (!scalable.isEmpty()) {
+        return scalable;
+    }
+
+    // Init Best Size
+    int bestSize = -1;
+
+    // Go Thru Sizes - Smallest Larger Size, Or The Largest One
+    QHash<int, QString>::const_iterator it = sizes.constBegin();
+    while (it != sizes.constEnd()) {
+        // Check Size
+        if (bestSize < 0 || (bestSize < aSize && it.key() > bestSize) || (it.key() >= aSize && it.key() < bestSize)) {
+            // Set Best Size
+            bestSize = it.key();
+        }
+
+        // Next Size
+        ++it;
+    }
+
+    return sizes.value(bestSize);
+}
+
+//==============================================================================
+// Write Icon Theme Index Item
+//==============================================================================
+QDataStream& operator<<(QDataStream& aStream, const IconThemeIndexItem& aItem)
+{
+    return aStream << aItem.sizes << aItem.scalable;
+}
+
+//==============================================================================
+// Read Icon Theme Index Item
+//==============================================================================
+QDataStream& operator>>(QDataStream& aStream, IconThemeIndexItem& aItem)
+{
+    return aStream >> aItem.sizes >> aItem.scalable;
+}
+
+
+
+
+
+
+
+//==============================================================================
+// Get Instance - Static Constructor
+//==============================================================================
+IconThemeIndex* IconThemeIndex::getInstance()
+{
+    QMutexLocker locker(&iconThemeIndexMutex);
+
+    // Check Singleton
+    if (!iconThemeIndexSingleton) {
+        // Create Singleton
+        iconThemeIndexSingleton = new IconThemeIndex();
+    } else {
+        // Inc Ref Count
+        iconThemeIndexSingleton->refCount++;
+    }
+
+    return iconThemeIndexSingleton;
+}
+
+//==============================================================================
+// Constructor
+//==============================================================================
+IconThemeIndex::IconThemeIndex()
+    : refCount(1)
+    , indexChecked(false)
+    , themeName(QIcon::themeName())
+{
+}
+
+//==============================================================================
+// Release
+//==============================================================================
+void IconThemeIndex::release()
+{
+    QMutexLocker locker(&iconThemeIndexMutex);
+
+    // Dec Ref Count
+    refCount--;
+
+    // Check Ref Count
+    if (refCount <= 0 && iconThemeIndexSingleton) {
+        // Delete Singleton
+        delete iconThemeIndexSingleton;
+        iconThemeIndexSingleton = NULL;
+    }
+}
+
+//==============================================================================
+// Get Index File Path
+//==============================================================================
+QString IconThemeIndex::indexFilePath()
+{
+    return QDir::homePath() + "/" + DEFAULT_ICON_THEME_INDEX_FILENAME;
+}
+
+//==============================================================================
+// Get Theme Names - Current Theme First
+//==============================================================================
+QStringList IconThemeIndex::themeNames()
+{
+    // Get Theme Names
+    QStringList names = QDir(DEFAULT_ICONS_PATH_LINUX).entryList(QDir::Dirs | QDir::NoDotAndDotDot, QDir::Name);
+
+    // Move Fallback Theme To Front
+    if (names.removeAll(DEFAULT_ICONS_FALLBACK_THEME) > 0) {
+        names.prepend(DEFAULT_ICONS_FALLBACK_THEME);
+    }
+
+    // Move Current Theme To Front
+    if (!themeName.isEmpty() && names.removeAll(themeName) > 0) {
+        names.prepend(themeName);
+    }
+
+    return names;
+}
+
+//==============================================================================
+// Check Index
+//==============================================================================
+void IconThemeIndex::checkIndex()
+{
+    // Check Index Checked
+    if (indexChecked) {
+        return;
+    }
+
+    // Set Index Checked
+    indexChecked = true;
+
+    // Load Index
+    if (!loadIndex()) {
+        // Build Index
+        buildIndex();
+        // Save Index
+        saveIndex();
+    }
+}
+
+//==============================================================================
+// Load Index
+//==============================================================================
+bool IconThemeIndex::loadIndex()
+{
+    // Init Index File
+    QFile indexFile(indexFilePath());
+
+    // Open Index File
+    if (!indexFile.open(QIODevice::ReadOnly)) {
+        return false;
+    }
+
+    // Init Data Stream
+    QDataStream stream(&indexFile);
+    // Set Version
+    stream.setVersion(QDataStream::Qt_5_0);
+
+    // Init Header
+    quint32 magic = 0;
+    quint32 version = 0;
+    QString rootPath;
+    QString indexedThemeName;
+
+    // Read Header
+    stream >> magic >> version >> rootPath >> indexedThemeName;
+
+    // Check Header
+    if (magic != ICON_THEME_INDEX_MAGIC || version != ICON_THEME_INDEX_VERSION || rootPath != QString(DEFAULT_ICONS_PATH_LINUX) || indexedThemeName != themeName) {
+        return false;
+    }
+
+    // Read Dir Modification Times
+    stream >> dirTimes;
+
+    // Go Thru Dirs - Any Change In The Theme Tree Invalidates The Index
+    QHash<QString, qint64>::const_iterator it = dirTimes.constBegin();
+    while (it != dirTimes.constEnd()) {
+        // Get Dir Info
+        QFileInfo dirInfo(it.key());
+
+        // Check Dir Info
+        if (!dirInfo.isDir() || dirInfo.lastModified().toMSecsSinceEpoch() != it.value()) {
+            qDebug() << "IconThemeIndex::loadIndex - dir: " << it.key() << " - CHANGED";
+            // Clear Dir Times
+            dirTimes.clear();
+            return false;
+        }
+
+        // Next Dir
+        ++it;
+    }
+
+    // Read Icons
+    stream >> mimeIcons >> otherIcons;
+
+    // Check Stream Status
+    if (stream.status() != QDataStream::Ok) {
+        qWarning() << "IconThemeIndex::loadIndex - INVALID INDEX!!";
+        // Clear Index
+        dirTimes.clear();
+        mimeIcons.clear();
+        otherIcons.clear();
+        return false;
+    }
+
+    qDebug() << "IconThemeIndex::loadIndex - mimeIcons: " << mimeIcons.count() << " - otherIcons: " << otherIcons.count();
+
+    return true;
+}
+
+//==============================================================================
+// Save Index
+//==============================================================================
+void IconThemeIndex::saveIndex()
+{
+    // Init Index File - Written Atomically
+    QSaveFile indexFile(indexFilePath());
+
+    // Open Index File
+    if (!indexFile.open(QIODevice::WriteOnly)) {
+        qWarning() << "IconThemeIndex::saveIndex - ERROR OPENING FILE!!";
+        return;
+    }
+
+    // Init Data Stream
+    QDataStream stream(&indexFile);
+    // Set Version
+    stream.setVersion(QDataStream::Qt_5_0);
+
+    // Write Index
+    stream << (quint32)ICON_THEME_INDEX_MAGIC << (quint32)ICON_THEME_INDEX_VERSION << QString(DEFAULT_ICONS_PATH_LINUX) << themeName;
+    stream << dirTimes << mimeIcons << otherIcons;
+
+    // Commit
+    indexFile.commit();
+}
+
+//==============================================================================
+// Build Index
+//==============================================================================
+void IconThemeIndex::buildIndex()
+{
+    qDebug() << "IconThemeIndex::buildIndex - themeName: " << themeName;
+
+    // Clear Index
+    dirTimes.clear();
+    mimeIcons.clear();
+    otherIcons.clear();
+
+    // Get Root Dir Info
+    QFileInfo rootInfo(DEFAULT_ICONS_PATH_LINUX);
+
+    // Check Root Dir Info
+    if (!rootInfo.isDir()) {
+        return;
+    }
+
+    // Add Root Dir Modification Time - Catches Added/Removed Themes
+    dirTimes[rootInfo.absoluteFilePath()] = rootInfo.lastModified().toMSecsSinceEpoch();
+
+    // Go Thru Themes - In Priority Order, First Theme Wins
+    foreach (const QString& theme, themeNames()) {
+        // Get Theme Dir Path
+        QString themeDirPath = QString(DEFAULT_ICONS_PATH_LINUX) + "/" + theme;
+        // Add Theme Dir Modification Time
+        dirTimes[themeDirPath] = QFileInfo(themeDirPath).lastModified().toMSecsSinceEpoch();
+
+        // Init Dir Iterator
+        QDirIterator it(themeDirPath, QDir::Files | QDir::Dirs | QDir::NoDotAndDotDot, QDirIterator::Subdirectories);
+
+        // Go Thru Theme Tree
+        while (it.hasNext()) {
+            // Next Entry
+            it.next();
+
+            // Get Entry Info
+            QFileInfo entryInfo = it.fileInfo();
+
+            // Check If Is Dir
+            if (entryInfo.isDir()) {
+                // Add Dir Modification Time
+                dirTimes[entryInfo.absoluteFilePath()] = entryInfo.lastModified().toMSecsSinceEpoch();
+            } else {
+                // Add Icon File
+                addIconFile(theme, it.filePath().mid(themeDirPath.length() + 1));
+            }
+        }
+    }
+
+    qDebug() << "IconThemeIndex::buildIndex - dirs: " << dirTimes.count() << " - mimeIcons: " << mimeIcons.count() << " - otherIcons: " << otherIcons.count();
+}
+
+//==============================================================================
+// Add Icon File
+//==============================================================================
+void IconThemeIndex::addIconFile(const QString& aThemeName, const QString& aRelativePath)
+{
+    // Get Path Components - size/context/name.ext Or context/size/name.ext
+    QStringList components = aRelativePath.split('/');
+    // Get File Name
+    QString fileName = components.takeLast();
+    // Get Suffix Pos
+    int suffixPos = fileName.lastIndexOf('.');
+
+    // Check Suffix Pos
+    if (suffixPos <= 0) {
+        return;
+    }
+
+    // Get Suffix
+    QString suffix = fileName.mid(suffixPos + 1).toLower();
+
+    // Check Suffix
+    if (suffix != QString("png") && suffix != QString("svg") && suffix != QString("svgz") && suffix != QString("xpm")) {
+        return;
+    }
+
+    // Init Size - 0 Is Scalable
+    int size = -1;
+    // Init MIME Context
+    bool mimeContext = false;
+
+    // Go Thru Path Components
+    foreach (const QString& component, components) {
+        // Check Component
+        if (component == QString(DEFAULT_ICONS_MIMETYPES_DIR) || component == QString(DEFAULT_ICONS_MIMES_DIR)) {
+            // Set MIME Context
+            mimeContext = true;
+        } else if (component == QString("scalable")) {
+            // Set Size
+            size = 0;
+        } else if (size < 0) {
+            // Init Ok
+            bool ok = false;
+            // Get Size - "48x48", "48x48@2" Or "48"
+            int componentSize = component.section('x', 0, 0).toInt(&ok);
+
+            // Check Ok
+            if (ok && componentSize > 0) {
+                // Set Size
+                size = componentSize;
+            }
+        }
+    }
+
+    // Check Size
+    if (size < 0) {
+        return;
+    }
+
+    // Get Item
+    IconThemeIndexItem& item = mimeContext ? mimeIcons[fileName.left(suffixPos)] : otherIcons[fileName.left(suffixPos)];
+    // Get Icon Path
+    QString iconPath = QString(DEFAULT_ICONS_PATH_LINUX) + "/" + aThemeName + "/" + aRelativePath;
+
+    // Check Size
+    if (size == 0) {
+        // Check Scalable Path - First Theme Wins
+        if (item.scalable.isEmpty()) {
+            // Set Scalable Path
+            item.scalable = iconPath;
+        }
+    } else if (!item.sizes.contains(size)) {
+        // Set Size Path
+        item.sizes[size] = iconPath;
+    }
+}
+
+//==============================================================================
+// Get Icon Path For MIME Type
+//==============================================================================
+QString IconThemeIndex::mimeIconPath(const QString& aMimeType, const int& aWidth, const int& aHeight)
+{
+    QMutexLocker locker(&indexMutex);
+
+    // Check Index
+    checkIndex();
+
+    // Get Size
+    int size = qMax(aWidth, aHeight);
+
+    // Get MIME Type
+    QMimeType mimeType = QMimeDatabase().mimeTypeForName(aMimeType);
+
+    // Init Icon Names - ORDER IS IMPORTANT!!
+    QStringList iconNames;
+
+    // Add Full MIME Icon Name - "text/plain" -> "text-plain"
+    iconNames << QString(aMimeType).replace('/', '-');
+
+    // Check MIME Type
+    if (mimeType.isValid()) {
+        // Add Icon Name
+        iconNames << mimeType.iconName();
+        // Add Generic Icon Name
+        iconNames << mimeType.genericIconName();
+    }
+
+    // Go Thru Icon Names
+    foreach (const QString& iconName, iconNames) {
+        // Find Icon
+        QHash<QString, IconThemeIndexItem>::const_iterator it = mimeIcons.constFind(iconName);
+
+        // Check Icon
+        if (it != mimeIcons.constEnd()) {
+            return it.value().path(size);
+        }
+    }
+
+    // Get MIME Sub Type
+    QString mimeSubType = aMimeType.section('/', 1);
+
+    // Find Icon By Sub Type In Other Contexts
+    QHash<QString, IconThemeIndexItem>::const_iterator it = otherIcons.constFind(mimeSubType);
+
+    // Check Icon
+    if (!mimeSubType.isEmpty() && it != otherIcons.constEnd()) {
+        return it.value().path(size);
+    }
+
+    return QString();
+}
+
+//==============================================================================
+// Rebuild Index
+//==============================================================================
+void IconThemeIndex::rebuild()
+{
+    QMutexLocker locker(&indexMutex);
+
+    // Update Theme Name
+    themeName = QIcon::themeName();
+    // Set Index Checked
+    indexChecked = true;
+
+    // Build Index
+    buildIndex();
+    // Save Index
+    saveIndex();
+}
+
+//==============================================================================
+// Destructor
+//==============================================================================
+IconThemeIndex::~IconThemeIndex()
+{
+    // Clear Index
+    dirTimes.clear();
+    mimeIcons.clear();
+    otherIcons.clear();
+}
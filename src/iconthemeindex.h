@@ -0,0 +1,107 @@
+#ifndef ICONTHEMEINDEX_H
+#define ICONTHEMEINDEX_H
+
+#include <QString>
+#include <QStringList>
+#include <QHash>
+#include <QMutex>
+#include <QDataStream>
+
+
+//==============================================================================
+// Icon Theme Index Item Class - All Sizes Of One Icon Name
+//==============================================================================
+class IconThemeIndexItem
+{
+public:
+    // Constructor
+    explicit IconThemeIndexItem();
+
+    // Get Best Path For Size
+    QString path(const int& aSize) const;
+
+    // Paths By Size
+    QHash<int, QString> sizes;
+    // Scalable Path
+    QString             scalable;
+};
+
+// Write Icon Theme Index Item
+QDataStream& operator<<(QDataStream& aStream, const IconThemeIndexItem& aItem);
+// Read Icon Theme Index Item
+QDataStream& operator>>(QDataStream& aStream, IconThemeIndexItem& aItem);
+
+
+
+
+//==============================================================================
+// Icon Theme Index Class - Icon Theme Tree Indexed Once, Persisted On Disk
+//==============================================================================
+class IconThemeIndex
+{
+public:
+
+    // Get Instance - Static Constructor
+    static IconThemeIndex* getInstance();
+
+    // Release
+    void release();
+
+    // Get Icon Path For MIME Type
+    QString mimeIconPath(const QString& aMimeType, const int& aWidth, const int& aHeight);
+
+    // Rebuild Index
+    void rebuild();
+
+protected: // Constructor/Destructor
+
+    // Constructor
+    explicit IconThemeIndex();
+
+    // Destructor
+    virtual ~IconThemeIndex();
+
+protected:
+
+    // Get Index File Path
+    QString indexFilePath();
+
+    // Check Index - Built And Still Valid
+    void checkIndex();
+
+    // Load Index - Returns False If Missing Or Outdated
+    bool loadIndex();
+    // Save Index
+    void saveIndex();
+    // Build Index
+    void buildIndex();
+
+    // Add Icon File
+    void addIconFile(const QString& aThemeName, const QString& aRelativePath);
+
+    // Get Theme Names - Current Theme First
+    QStringList themeNames();
+
+protected:
+
+    // Int Ref Counter
+    int                                 refCount;
+
+    // Index Mutex
+    QMutex                              indexMutex;
+    // Index Checked
+    bool                                indexChecked;
+
+    // Theme Name
+    QString                             themeName;
+
+    // MIME Type Icons By Name
+    QHash<QString, IconThemeIndexItem>  mimeIcons;
+    // Other Icons By Name
+    QHash<QString, IconThemeIndexItem>  otherIcons;
+
+    // Dir Modification Times - Validates The Persisted Index
+    QHash<QString, qint64>              dirTimes;
+};
+
+#endif // ICONTHEMEINDEX_H
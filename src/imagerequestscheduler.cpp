@@ -0,0 +1,286 @@
+#include <QMutexLocker>
+#include <QDateTime>
+#include <QDir>
+#include <QDebug>
+
+#include "imagerequestscheduler.h"
+#include "constants.h"
+
+
+//==============================================================================
+// Constructor
+//==============================================================================
+ScheduledImageResponse::ScheduledImageResponse(const QString& aFilePath, const QSize& aRequestedSize)
+    : QQuickImageResponse()
+    , filePath(aFilePath)
+    , requestedSize(aRequestedSize)
+    , cancelled(0)
+    , scheduleKey(QDir::cleanPath(aFilePath))
+    , enqueued(QDateTime::currentMSecsSinceEpoch())
+{
+}
+
+//==============================================================================
+// Get Texture Factory
+//==============================================================================
+QQuickTextureFactory* ScheduledImageResponse::textureFactory() const
+{
+    return QQuickTextureFactory::textureFactoryForImage(image);
+}
+
+//==============================================================================
+// Get Error String
+//==============================================================================
+QString ScheduledImageResponse::errorString() const
+{
+    return error;
+}
+
+//==============================================================================
+// Cancel
+//==============================================================================
+void ScheduledImageResponse::cancel()
+{
+    // Set Cancelled - Picked Up Next And Finished Without Work
+    cancelled = 1;
+}
+
+//==============================================================================
+// Execute
+//==============================================================================
+void ScheduledImageResponse::execute()
+{
+    // Check Cancelled
+    if (!cancelled.loadAcquire()) {
+        // Generate Image
+        image = generateImage();
+    }
+
+    // Emit Finished - Must Be The Last Thing Touching This Response
+    emit finished();
+}
+
+//==============================================================================
+// Destructor
+//==============================================================================
+ScheduledImageResponse::~ScheduledImageResponse()
+{
+}
+
+
+
+
+
+
+
+//==============================================================================
+// Constructor
+//==============================================================================
+ImageRequestWorker::ImageRequestWorker(ImageRequestScheduler* aScheduler)
+    : QRunnable()
+    , scheduler(aScheduler)
+{
+}
+
+//==============================================================================
+// Run
+//==============================================================================
+void ImageRequestWorker::run()
+{
+    // Take Next Response
+    ScheduledImageResponse* response = scheduler->takeNext();
+
+    // Check Response - Shutdown May Have Taken It
+    if (!response) {
+        return;
+    }
+
+    // Get Enqueued - The Response May Be Deleted Once Finished
+    qint64 enqueued = response->enqueued;
+
+    // Execute Response
+    response->execute();
+
+    // Request Done
+    scheduler->requestDone(QDateTime::currentMSecsSinceEpoch() - enqueued);
+}
+
+
+
+
+
+
+
+//==============================================================================
+// Constructor
+//==============================================================================
+ImageRequestScheduler::ImageRequestScheduler(const int& aMaxThreads)
+    : completed(0)
+    , avgLatency(0.0)
+    , maxDepth(0)
+{
+    // Set Max Thread Count
+    workerPool.setMaxThreadCount(aMaxThreads);
+}
+
+//==============================================================================
+// Submit Response
+//==============================================================================
+void ImageRequestScheduler::submit(ScheduledImageResponse* aResponse)
+{
+    // Check Response
+    if (!aResponse) {
+        return;
+    }
+
+    // Lock
+    mutex.lock();
+    // Append Response
+    pending << aResponse;
+    // Update Max Depth
+    maxDepth = qMax(maxDepth, pending.count());
+    // Unlock
+    mutex.unlock();
+
+    // Start Worker - One Worker Per Request, Each Picks The Best Pending One
+    workerPool.start(new ImageRequestWorker(this));
+}
+
+//==============================================================================
+// Set Visible Items
+//==============================================================================
+void ImageRequestScheduler::setVisibleItems(const QStringList& aFilePaths)
+{
+    QMutexLocker locker(&mutex);
+
+    // Clear Visible Items
+    visibleItems.clear();
+
+    // Go Thru File Paths
+    foreach (const QString& filePath, aFilePaths) {
+        // Add Visible Item
+        visibleItems << QDir::cleanPath(filePath);
+    }
+}
+
+//==============================================================================
+// Take Next Response
+//==============================================================================
+ScheduledImageResponse* ImageRequestScheduler::takeNext()
+{
+    QMutexLocker locker(&mutex);
+
+    // Get Pending Count
+    int pCount = pending.count();
+
+    // Check Pending Count
+    if (pCount <= 0) {
+        return NULL;
+    }
+
+    // Init Index
+    int index = -1;
+
+    // Go Thru Pending Responses - Newest First
+    for (int i = pCount - 1; i >= 0 && index < 0; --i) {
+        // Check Cancelled - Finishing These Costs Nothing
+        if (pending[i]->cancelled.loadAcquire()) {
+            // Set Index
+            index = i;
+        }
+    }
+
+    // Go Thru Pending Responses - Newest First
+    for (int j = pCount - 1; j >= 0 && index < 0 && !visibleItems.isEmpty(); --j) {
+        // Check Visible
+        if (visibleItems.contains(pending[j]->scheduleKey)) {
+            // Set Index
+            index = j;
+        }
+    }
+
+    // Check Index - Nothing On Screen Pending, Off Screen Rows Go Newest First
+    if (index < 0) {
+        // Set Index
+        index = pCount - 1;
+    }
+
+    return pending.takeAt(index);
+}
+
+//==============================================================================
+// Request Done
+//==============================================================================
+void ImageRequestScheduler::requestDone(const qint64& aLatency)
+{
+    QMutexLocker locker(&mutex);
+
+    // Update Average Latency
+    avgLatency = completed > 0 ? avgLatency + (aLatency - avgLatency) * DEFAULT_IMAGE_REQUEST_LATENCY_WEIGHT : (double)aLatency;
+    // Inc Completed
+    completed++;
+
+    // Check Completed
+    if (completed % DEFAULT_IMAGE_REQUEST_STATS_INTERVAL == 0) {
+        qDebug() << "ImageRequestScheduler::requestDone - completed: " << completed << " - queueDepth: " << pending.count() << " - maxDepth: " << maxDepth << " - avgLatency: " << (int)avgLatency << "ms";
+        // Reset Max Depth
+        maxDepth = pending.count();
+    }
+}
+
+//==============================================================================
+// Get Queue Depth
+//==============================================================================
+int ImageRequestScheduler::queueDepth()
+{
+    QMutexLocker locker(&mutex);
+
+    return pending.count();
+}
+
+//==============================================================================
+// Get Average Latency
+//==============================================================================
+int ImageRequestScheduler::averageLatency()
+{
+    QMutexLocker locker(&mutex);
+
+    return (int)avgLatency;
+}
+
+//==============================================================================
+// Shutdown
+//==============================================================================
+void ImageRequestScheduler::shutdown()
+{
+    // Lock
+    mutex.lock();
+    // Take Pending Responses
+    QList<ScheduledImageResponse*> remaining = pending;
+    // Clear Pending Responses
+    pending.clear();
+    // Unlock
+    mutex.unlock();
+
+    // Go Thru Remaining Responses
+    foreach (ScheduledImageResponse* response, remaining) {
+        // Set Cancelled
+        response->cancel();
+        // Execute - Finishes Without Work
+        response->execute();
+    }
+
+    // Clear Queued Workers
+    workerPool.clear();
+    // Wait For Running Workers
+    workerPool.waitForDone();
+}
+
+//==============================================================================
+// Destructor
+//==============================================================================
+ImageRequestScheduler::~ImageRequestScheduler()
+{
+    // Shutdown
+    shutdown();
+}
@@ -0,0 +1,149 @@
+#ifndef IMAGEREQUESTSCHEDULER_H
+#define IMAGEREQUESTSCHEDULER_H
+
+#include <QQuickImageResponse>
+#include <QQuickTextureFactory>
+#include <QThreadPool>
+#include <QRunnable>
+#include <QMutex>
+#include <QAtomicInt>
+#include <QStringList>
+#include <QList>
+#include <QSet>
+#include <QImage>
+#include <QSize>
+
+class ImageRequestScheduler;
+
+
+//==============================================================================
+// Scheduled Image Response Class - Image Generated By The Scheduler's Workers
+//==============================================================================
+class ScheduledImageResponse : public QQuickImageResponse
+{
+public:
+    // Constructor
+    explicit ScheduledImageResponse(const QString& aFilePath, const QSize& aRequestedSize);
+
+    // Get Texture Factory
+    virtual QQuickTextureFactory* textureFactory() const;
+    // Get Error String
+    virtual QString errorString() const;
+
+    // Cancel - Delegate Destroyed, Still Finishes
+    virtual void cancel();
+
+    // Destructor
+    virtual ~ScheduledImageResponse();
+
+protected:
+    friend class ImageRequestScheduler;
+    friend class ImageRequestWorker;
+
+    // Generate Image - Worker Thread
+    virtual QImage generateImage() = 0;
+
+    // Execute - Generates The Image Unless Cancelled And Emits Finished
+    void execute();
+
+protected:
+
+    // File Path
+    QString         filePath;
+    // Requested Size
+    QSize           requestedSize;
+    // Cancelled
+    QAtomicInt      cancelled;
+
+    // Image
+    QImage          image;
+    // Error String
+    QString         error;
+
+    // Scheduling Key - Clean Path Matched Against The Visible Range
+    QString         scheduleKey;
+    // Enqueued - msecs Since Epoch
+    qint64          enqueued;
+};
+
+
+
+
+//==============================================================================
+// Image Request Worker Class - Runs The Best Pending Request
+//==============================================================================
+class ImageRequestWorker : public QRunnable
+{
+public:
+    // Constructor
+    explicit ImageRequestWorker(ImageRequestScheduler* aScheduler);
+
+protected: // From QRunnable
+
+    // Run
+    virtual void run();
+
+protected:
+
+    // Scheduler
+    ImageRequestScheduler*  scheduler;
+};
+
+
+
+
+//==============================================================================
+// Image Request Scheduler Class - Visible Rows First, Newest First
+//==============================================================================
+class ImageRequestScheduler
+{
+public:
+    // Constructor
+    explicit ImageRequestScheduler(const int& aMaxThreads);
+
+    // Submit Response
+    void submit(ScheduledImageResponse* aResponse);
+
+    // Set Visible Items - File Paths Of The Rows On Screen
+    void setVisibleItems(const QStringList& aFilePaths);
+
+    // Get Queue Depth
+    int queueDepth();
+    // Get Average Latency - msecs From Request To Image
+    int averageLatency();
+
+    // Shutdown - Finishes Pending Responses As Cancelled And Waits For Workers
+    void shutdown();
+
+    // Destructor
+    virtual ~ImageRequestScheduler();
+
+protected:
+    friend class ImageRequestWorker;
+
+    // Take Next Response - Cancelled, Then Visible, Then Newest
+    ScheduledImageResponse* takeNext();
+    // Request Done
+    void requestDone(const qint64& aLatency);
+
+protected:
+
+    // Scheduler Mutex
+    QMutex                          mutex;
+    // Pending Responses - Oldest First
+    QList<ScheduledImageResponse*>  pending;
+    // Visible Items
+    QSet<QString>                   visibleItems;
+
+    // Worker Pool
+    QThreadPool                     workerPool;
+
+    // Completed Requests
+    qint64                          completed;
+    // Average Latency - Exponentially Weighted
+    double                          avgLatency;
+    // Max Queue Depth Since Last Stats
+    int                             maxDepth;
+};
+
+#endif // IMAGEREQUESTSCHEDULER_H
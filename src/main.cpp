@@ -1,54 +1,107 @@
 
 #include <QApplication>
 #include <QDir>
+#include <QElapsedTimer>
+#include <QEvent>
+#include <QSettings>
+#include <QStringList>
 #include <QDebug>
 
+#include <stdio.h>
+
 #include <mcwinterface.h>
 
+#if defined(Q_OS_UNIX)
+
+#include <sys/resource.h>
+
+#endif // Q_OS_UNIX
+
 #include "mainwindow.h"
+#include "asynclogger.h"
+#include "filecopyengine.h"
+#include "transferbatch.h"
 #include "utility.h"
 #include "constants.h"
 
 
 
 //==============================================================================
-// My Message Handler
+// Get Peak Resident Set Size - KB, -1 If Unknown
 //==============================================================================
-void myMessageHandler(QtMsgType type, const QMessageLogContext& context, const QString &msg)
+static qint64 peakRSS()
 {
-    Q_UNUSED(context);
-
-    // Init Output String
-    QString txt;
-
-    // Switch Type
-    switch (type) {
-        default:
-        case QtDebugMsg:    txt = QString("Debug: %1").arg(msg);    break;
-        case QtWarningMsg:  txt = QString("Warning: %1").arg(msg);  break;
-        case QtCriticalMsg: txt = QString("Critical: %1").arg(msg); break;
-        case QtFatalMsg:    txt = QString("Fatal: %1").arg(msg);    break;
-    }
+#if defined(Q_OS_UNIX)
+
+    // Init Resource Usage
+    struct rusage usage;
+
+    // Get Resource Usage
+    if (getrusage(RUSAGE_SELF, &usage) == 0) {
+
+#if defined(Q_OS_MAC)
+        // Bytes On Mac
+        return (qint64)usage.ru_maxrss >> 10;
+#else // Q_OS_MAC
+        // KB Elsewhere
+        return (qint64)usage.ru_maxrss;
+#endif // Q_OS_MAC
 
-    // Init Output File
-    QFile outFile(QDir::homePath() + "/log.txt");
-    // Open Output File
-    if (outFile.open(QIODevice::WriteOnly | QIODevice::Append)) {
-        // Init Text Stream
-        QTextStream ts(&outFile);
-        ts << txt << "\n";
-        // Close Output File
-        outFile.close();
     }
+
+#endif // Q_OS_UNIX
+
+    return -1;
 }
 
+//==============================================================================
+// Startup Frame Watcher Class - Reports Time To The First Painted Frame
+//==============================================================================
+class StartupFrameWatcher : public QObject
+{
+public:
+    // Constructor
+    explicit StartupFrameWatcher(const QElapsedTimer& aTimer)
+        : QObject(NULL)
+        , timer(aTimer)
+    {
+    }
+
+protected: // From QObject
+
+    // Event Filter
+    virtual bool eventFilter(QObject* aObject, QEvent* aEvent)
+    {
+        // Check Event - First Paint Happens After The Event Loop Is Up, Window Is Interactive
+        if (aEvent && aEvent->type() == QEvent::Paint) {
+            qDebug() << "main - startup - first frame: " << timer.elapsed() << "ms - peak RSS: " << peakRSS() << "KB";
+
+            // Remove Event Filter - Report Once
+            qApp->removeEventFilter(this);
+        }
+
+        return QObject::eventFilter(aObject, aEvent);
+    }
+
+protected:
+
+    // Startup Timer
+    const QElapsedTimer&    timer;
+};
+
 //==============================================================================
 // Main
 //==============================================================================
 int main(int argc, char* argv[])
 {
+    // Init Startup Timer
+    QElapsedTimer startupTimer;
+    // Start Startup Timer
+    startupTimer.start();
+
 #ifdef FILE_LOG
-    qInstallMessageHandler(myMessageHandler);
+    // Install Async Logger
+    AsyncLogger::install(QDir::homePath() + "/" + DEFAULT_LOG_FILENAME);
 #endif
 
     qDebug() << " ";
@@ -70,15 +123,70 @@ int main(int argc, char* argv[])
     // Store App Exec Path
     storeAppExecPath(argv[0]);
 
+    // Get Copy Benchmark Argument Index
+    int benchmarkIndex = app.arguments().indexOf(DEFAULT_ARGUMENT_COPY_BENCHMARK);
+
+    // Check Copy Benchmark Argument - Source Dir, Optional Target Dir On Another File System
+    if (benchmarkIndex >= 0 && benchmarkIndex + 1 < app.arguments().count()) {
+        // Run Copy Benchmark
+        QString report = FileCopyEngine::benchmark(app.arguments()[benchmarkIndex + 1], app.arguments().value(benchmarkIndex + 2));
+
+        // Print Report
+        fprintf(stdout, "%s\n", qPrintable(report));
+
+#ifdef FILE_LOG
+        // Uninstall Async Logger
+        AsyncLogger::uninstall();
+#endif
+
+        return 0;
+    }
+
+    // Get Batch Benchmark Argument Index
+    int batchBenchmarkIndex = app.arguments().indexOf(DEFAULT_ARGUMENT_BATCH_BENCHMARK);
+
+    // Check Batch Benchmark Argument - Source Dir, Optional Target Dir And File Count
+    if (batchBenchmarkIndex >= 0 && batchBenchmarkIndex + 1 < app.arguments().count()) {
+        // Init Settings
+        QSettings settings;
+        // Get File Count
+        int fileCount = app.arguments().value(batchBenchmarkIndex + 3).toInt();
+
+        // Run Batch Benchmark
+        QString report = TransferBatch::benchmark(app.arguments()[batchBenchmarkIndex + 1],
+                                                  app.arguments().value(batchBenchmarkIndex + 2),
+                                                  fileCount > 0 ? fileCount : DEFAULT_TRANSFER_BATCH_BENCH_FILES,
+                                                  qMax(1, settings.value(SETTINGS_KEY_TRANSFER_THREADS, DEFAULT_TRANSFER_THREADS).toInt()));
+
+        // Print Report
+        fprintf(stdout, "%s\n", qPrintable(report));
+
+#ifdef FILE_LOG
+        // Uninstall Async Logger
+        AsyncLogger::uninstall();
+#endif
+
+        return 0;
+    }
+
+    // Init Startup Frame Watcher
+    StartupFrameWatcher startupFrameWatcher(startupTimer);
+    // Install Event Filter
+    app.installEventFilter(&startupFrameWatcher);
+
     // Init Result
     int result = 0;
 
     // Init Main Window
     MainWindow* mainWindow = MainWindow::getInstance();
 
+    qDebug() << "main - startup - main window created: " << startupTimer.elapsed() << "ms - peak RSS: " << peakRSS() << "KB";
+
     // Show Main Window
     mainWindow->showWindow();
 
+    qDebug() << "main - startup - main window shown: " << startupTimer.elapsed() << "ms - peak RSS: " << peakRSS() << "KB";
+
     // Execute App
     result = app.exec();
 
@@ -91,6 +199,11 @@ int main(int argc, char* argv[])
     qDebug() << "================================================================================";
     qDebug() << " ";
 
+#ifdef FILE_LOG
+    // Uninstall Async Logger - Drains Pending Lines
+    AsyncLogger::uninstall();
+#endif
+
     return result;
 }
 
@@ -25,6 +25,7 @@
 #include "remotefileutilclient.h"
 #include "infodialog.h"
 #include "comparedialog.h"
+#include "treemapdialog.h"
 #include "settingscontroller.h"
 #include "filelistmodel.h"
 #include "utility.h"
@@ -95,6 +96,7 @@ MainWindow::MainWindow(QWidget* aParent)
     , searchFileDialog(NULL)
     , selectFilesDialog(NULL)
     , compareDialog(NULL)
+    , treeMapDialog(NULL)
     , viewSearchResult(false)
 
 {
@@ -580,8 +582,8 @@ void MainWindow::launchFileTransfer(const QString& aOperation)
     // Set Copy Hidden Visibility
     transferFileDialog->setCopyHiddenVisible(true);
 
-    // Init Selected Files
-    QStringList selectedFiles = focusedPanel->getSelectedFiles();
+    // Get Selected Files Count - No Path List Is Built
+    int selectedCount = focusedPanel->getSelectedFilesCount();
 
     // Get Source Panel
     FilePanel* sourcePanel = (focusedPanel == leftPanel) ? leftPanel : rightPanel;
@@ -606,22 +608,27 @@ void MainWindow::launchFileTransfer(const QString& aOperation)
     }
 
     // Check Selected Files Count
-    if (selectedFiles.count() > 1) {
+    if (selectedCount > 1) {
 
         // Set Transfer Dialog Source File Text
         transferFileDialog->setSourceFileText(transferSourceDir + "*", focusedPanel->getSearchResultsMode());
         // Set Transfer Dialog Target File Text
         transferFileDialog->setTargetFileText(transferTargetDir + "*", focusedPanel->getSearchResultsMode());
 
-    } else if (selectedFiles.count() == 1) {
+    } else if (selectedCount == 1) {
+
+        // Get Selection
+        FileListSelection selection = focusedPanel->getSelection();
+        // Get Selected File
+        QString selectedFile = selection.filePath(selection.first());
 
         // Set Transfer Dialog Source File Text
         //transferFileDialog->setSourceFileText(transferSourceDir + selectedFiles[0], focusedPanel->getSearchResultsMode());
-        transferFileDialog->setSourceFileText(selectedFiles[0], focusedPanel->getSearchResultsMode());
+        transferFileDialog->setSourceFileText(selectedFile, focusedPanel->getSearchResultsMode());
 
         // Set Transfer Dialog Target File Text
         //transferFileDialog->setTargetFileText(transferTargetDir + selectedFiles[0], focusedPanel->getSearchResultsMode());
-        transferFileDialog->setTargetFileText(transferTargetDir + QFileInfo(selectedFiles[0]).fileName(), focusedPanel->getSearchResultsMode());
+        transferFileDialog->setTargetFileText(transferTargetDir + QFileInfo(selectedFile).fileName(), focusedPanel->getSearchResultsMode());
 
     } else {
 
@@ -634,7 +641,7 @@ void MainWindow::launchFileTransfer(const QString& aOperation)
         return;
     }
 
-    qDebug() << "MainWindow::launchFileTransfer - aOperation: " << aOperation << " - count: " << selectedFiles.count();
+    qDebug() << "MainWindow::launchFileTransfer - aOperation: " << aOperation << " - count: " << selectedCount;
 
     // ...
 
@@ -651,9 +658,6 @@ void MainWindow::launchFileTransfer(const QString& aOperation)
         // Check If Source Changed
         if (transferFileDialog->getSourceChanged() || transferFileDialog->getTargetChanged()) {
 
-            // Clear Selected Files
-            selectedFiles.clear();
-
             // Get Transfer Source
             QString sourceText = isPathRelative(transferFileDialog->getSourceFileText()) ? transferSourceDir + transferFileDialog->getSourceFileText() : transferFileDialog->getSourceFileText();
             // Get Transfer Target
@@ -724,12 +728,12 @@ void MainWindow::launchFileTransfer(const QString& aOperation)
             transferProgressDialogs << newTransferProgressDialog;
 
             // Check Selected Files Count
-            if (selectedFiles.count() == 1) {
+            if (selectedCount == 1) {
                 // Launch Progress Dialog
                 newTransferProgressDialog->launch(transferFileDialog->getSourceFileText(), transferFileDialog->getTargetFileText(), copyOptions);
             } else {
-                // Launch Progress Dialog
-                newTransferProgressDialog->launch(transferSourceDir, transferTargetDir, selectedFiles, copyOptions);
+                // Launch Progress Dialog - Selection Taken After The Dialog Closed, Rows Match The Current Listing
+                newTransferProgressDialog->launch(transferSourceDir, transferTargetDir, focusedPanel->getSelection(), copyOptions);
             }
         }
 
@@ -767,8 +771,8 @@ void MainWindow::launchFileExtract()
     transferFileDialog->setCopyHiddenVisible(false);
 
 
-    // Init Selected Files
-    QStringList selectedFiles = focusedPanel->getSelectedFiles();
+    // Get Selection
+    FileListSelection selection = focusedPanel->getSelection();
 
     // Get Source Panel
     FilePanel* sourcePanel = (focusedPanel == leftPanel) ? leftPanel : rightPanel;
@@ -793,7 +797,7 @@ void MainWindow::launchFileExtract()
     }
 
     // Set Transfer Dialog Source File Text
-    transferFileDialog->setSourceFileText(selectedFiles[0], false);
+    transferFileDialog->setSourceFileText(selection.filePath(selection.first()), false);
 
     // Set Transfer Dialog Target File Text
     transferFileDialog->setTargetFileText(transferTargetDir);
@@ -969,11 +973,11 @@ void MainWindow::launchDelete()
         deleteFileDialog = new DeleteFileDialog();
     }
 
-    // Get Selected File List
-    QStringList selectedFileList = focusedPanel->getSelectedFiles();
+    // Get Selection
+    FileListSelection selection = focusedPanel->getSelection();
 
-    // Check Selected File List
-    if (selectedFileList.count() == 0) {
+    // Check Selection
+    if (selection.isEmpty()) {
         qDebug() << "MainWindow::launchDelete - NO SELECTED FILE!";
 
         return;
@@ -990,10 +994,10 @@ void MainWindow::launchDelete()
         currDir += "/";
     }
 
-    // Check Selected File List
-    if (selectedFileList.count() == 1) {
+    // Check Selection Count
+    if (selection.count() == 1) {
         // Setup Delete File Dialog
-        deleteFileDialog->setFileName(selectedFileList[0]);
+        deleteFileDialog->setFileName(selection.filePath(selection.first()));
     } else {
         // Setup Delete File Dialog
         deleteFileDialog->setFileName(currDir);
@@ -1022,7 +1026,7 @@ void MainWindow::launchDelete()
             // Check If File Exists
             if (fileInfo.exists()) {
                 // Launch
-                newDialog->launch(focusedPanel->getCurrentDir(), focusedPanel->getSelectedFiles());
+                newDialog->launch(focusedPanel->getCurrentDir(), focusedPanel->getSelection());
             } else {
                 // Get Path Elements
                 QStringList pathElements = splitPath(fileNameEditorText);
@@ -1031,7 +1035,7 @@ void MainWindow::launchDelete()
             }
         } else {
             // Launch
-            newDialog->launch(focusedPanel->getCurrentDir(), focusedPanel->getSelectedFiles());
+            newDialog->launch(focusedPanel->getCurrentDir(), focusedPanel->getSelection());
         }
 
         // Clear Selected Files
@@ -1569,7 +1573,7 @@ void MainWindow::updateFunctionKeys()
         ui->terminalButton->setText("");
         ui->viewButton->setText("");
         ui->editButton->setText("");
-        if (focusedPanel && focusedPanel->isCurrentArchive() && !focusedPanel->getArchiveMode() && focusedPanel->getSelectedFiles().count() == 1)
+        if (focusedPanel && focusedPanel->isCurrentArchive() && !focusedPanel->getArchiveMode() && focusedPanel->getSelectedFilesCount() == 1)
             ui->copyButton->setText(tr(DEFAULT_FUNCTION_KEY_TEXT_EXTRACT));
         else
             ui->copyButton->setText("");
@@ -2153,6 +2157,33 @@ void MainWindow::on_actionOptions_triggered()
     showPreferences();
 }
 
+//==============================================================================
+// Launch Disk Usage Slot
+//==============================================================================
+void MainWindow::launchDiskUsage()
+{
+    // Check Focused Panel - Archives Have No Disk Usage
+    if (!focusedPanel || focusedPanel->getArchiveMode()) {
+        return;
+    }
+
+    // Reset Modifier Keys
+    focusedPanel->resetModifierKeys();
+
+    // Check Disk Usage Dialog
+    if (!treeMapDialog) {
+        // Create Disk Usage Dialog
+        treeMapDialog = new TreeMapDialog();
+    }
+
+    // Set Dir Path
+    treeMapDialog->setDirPath(focusedPanel->getCurrentDir());
+    // Show Dialog
+    treeMapDialog->show();
+    // Raise Dialog
+    treeMapDialog->raise();
+}
+
 //==============================================================================
 // Action Compare Files Triggered Slot
 //==============================================================================
@@ -2453,6 +2484,15 @@ void MainWindow::on_actionSwap_Dirs_triggered()
     }
 }
 
+//==============================================================================
+// Action Disk Usage Triggered Slot
+//==============================================================================
+void MainWindow::on_actionDisk_Usage_triggered()
+{
+    // Launch Disk Usage
+    launchDiskUsage();
+}
+
 //==============================================================================
 // Action Exit Triggered Slot
 //==============================================================================
@@ -2551,6 +2591,13 @@ MainWindow::~MainWindow()
         compareDialog = NULL;
     }
 
+    // Check Disk Usage Dialog
+    if (treeMapDialog) {
+        // Delete Dialog
+        delete treeMapDialog;
+        treeMapDialog = NULL;
+    }
+
     qDebug() << "MainWindow::~MainWindow";
 }
 
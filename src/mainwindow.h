@@ -27,6 +27,7 @@ class SearchDialog;
 class SettingsController;
 class SelectFilesDialog;
 class CompareDialog;
+class TreeMapDialog;
 
 
 //==============================================================================
@@ -98,6 +99,9 @@ public slots:
     // Launch File Compare Slot
     void launchFileCompare();
 
+    // Launch Disk Usage Slot
+    void launchDiskUsage();
+
     // Get Current Dir
     QString getCurrentDir(const QString& aPanelName);
 
@@ -252,6 +256,8 @@ protected slots: // Actions & Button
     void on_actionVolumes_triggered();
     // Action Swap Dirs Triggered Slot
     void on_actionSwap_Dirs_triggered();
+    // Action Disk Usage Triggered Slot
+    void on_actionDisk_Usage_triggered();
 
     // Action Exit Triggered Slot
     void on_actionExit_triggered();
@@ -309,6 +315,8 @@ private:
     SelectFilesDialog*              selectFilesDialog;
     // Compare Dialog
     CompareDialog*                  compareDialog;
+    // Disk Usage Dialog
+    TreeMapDialog*                  treeMapDialog;
 
     // Transfer Progress Dialogs
     QList<TransferProgressDialog*>  transferProgressDialogs;
@@ -0,0 +1,346 @@
+#include <QMimeDatabase>
+#include <QMimeType>
+#include <QDateTime>
+#include <QReadLocker>
+#include <QWriteLocker>
+#include <QMutexLocker>
+#include <QDebug>
+
+#if defined(Q_OS_UNIX)
+
+#include <sys/types.h>
+#include <sys/stat.h>
+
+#endif // Q_OS_UNIX
+
+#include "mimetypecache.h"
+#include "constants.h"
+
+
+// Mime Type Cache Singleton
+static MimeTypeCache* mimeTypeCacheSingleton = NULL;
+// Singleton Mutex
+static QMutex mimeTypeCacheMutex;
+
+
+//==============================================================================
+// Constructor
+//==============================================================================
+MimeTypeCacheItem::MimeTypeCacheItem(const QString& aName, const QString& aComment, const qint64& aModified)
+    : name(aName)
+    , comment(aComment)
+    , modified(aModified)
+{
+}
+
+
+
+
+
+
+
+//==============================================================================
+// Get Instance - Static Constructor
+//==============================================================================
+MimeTypeCache* MimeTypeCache::getInstance()
+{
+    QMutexLocker locker(&mimeTypeCacheMutex);
+
+    // Check Singleton
+    if (!mimeTypeCacheSingleton) {
+        // Create Singleton
+        mimeTypeCacheSingleton = new MimeTypeCache();
+    } else {
+        // Inc Ref Count
+        mimeTypeCacheSingleton->refCount++;
+    }
+
+    return mimeTypeCacheSingleton;
+}
+
+//==============================================================================
+// Constructor
+//==============================================================================
+MimeTypeCache::MimeTypeCache(QObject* aParent)
+    : QObject(aParent)
+    , refCount(1)
+{
+    qDebug() << "MimeTypeCache::MimeTypeCache";
+
+    // Set Max Thread Count - Content Sniffing Is I/O Bound
+    resolverPool.setMaxThreadCount(DEFAULT_MIME_TYPE_RESOLVER_THREADS);
+}
+
+//==============================================================================
+// Release
+//==============================================================================
+void MimeTypeCache::release()
+{
+    QMutexLocker locker(&mimeTypeCacheMutex);
+
+    // Dec Ref Count
+    refCount--;
+
+    // Check Ref Count
+    if (refCount <= 0 && mimeTypeCacheSingleton) {
+        // Delete Singleton
+        delete mimeTypeCacheSingleton;
+        mimeTypeCacheSingleton = NULL;
+    }
+}
+
+//==============================================================================
+// Get Mime Type Name
+//==============================================================================
+QString MimeTypeCache::mimeType(const QFileInfo& aFileInfo, const bool& aWait)
+{
+    return lookup(aFileInfo, aWait).name;
+}
+
+//==============================================================================
+// Get Mime Type Comment
+//==============================================================================
+QString MimeTypeCache::mimeComment(const QFileInfo& aFileInfo, const bool& aWait)
+{
+    return lookup(aFileInfo, aWait).comment;
+}
+
+//==============================================================================
+// Clear Cache
+//==============================================================================
+void MimeTypeCache::clear()
+{
+    QWriteLocker locker(&cacheLock);
+
+    // Clear Extension Cache
+    extensionCache.clear();
+    // Clear Content Cache
+    contentCache.clear();
+    // Clear Path Cache
+    pathCache.clear();
+}
+
+//==============================================================================
+// Lookup Item
+//==============================================================================
+MimeTypeCacheItem MimeTypeCache::lookup(const QFileInfo& aFileInfo, const bool& aWait)
+{
+    // Get File Path
+    QString filePath = aFileInfo.absoluteFilePath();
+    // Get Last Modified - QFileInfo Caches Stat Data
+    qint64 modified = aFileInfo.lastModified().toMSecsSinceEpoch();
+
+    {
+        QReadLocker locker(&cacheLock);
+
+        // Find Path Item
+        QHash<QString, MimeTypeCacheItem>::const_iterator pit = pathCache.constFind(filePath);
+
+        // Check Path Item
+        if (pit != pathCache.constEnd() && pit.value().modified == modified) {
+            return pit.value();
+        }
+
+        // Check If Dir
+        if (!aWait && !aFileInfo.isDir()) {
+            // Find Extension Item
+            QHash<QString, MimeTypeCacheItem>::const_iterator eit = extensionCache.constFind(extensionKey(aFileInfo.fileName()));
+
+            // Check Extension Item - Good Enough For The File List, Viewer Waits For The Exact Type
+            if (eit != extensionCache.constEnd()) {
+                return eit.value();
+            }
+        }
+    }
+
+    // Check Wait
+    if (aWait) {
+        // Resolve Mime Type Synchronously
+        MimeTypeCacheItem item = resolve(filePath);
+        // Store Item
+        storeItem(filePath, item);
+
+        return item;
+    }
+
+    {
+        QWriteLocker locker(&cacheLock);
+
+        // Check If Already Pending
+        if (!pendingPaths.contains(filePath)) {
+            // Add To Pending
+            pendingPaths << filePath;
+            // Start Resolver
+            resolverPool.start(new MimeTypeResolver(this, filePath));
+        }
+    }
+
+    return MimeTypeCacheItem();
+}
+
+//==============================================================================
+// Resolve Mime Type - Blocking
+//==============================================================================
+MimeTypeCacheItem MimeTypeCache::resolve(const QString& aFilePath)
+{
+    // Init Mime Database
+    QMimeDatabase mimeDatabase;
+    // Init File Info
+    QFileInfo fileInfo(aFilePath);
+    // Get Last Modified
+    qint64 modified = fileInfo.lastModified().toMSecsSinceEpoch();
+
+    // Check If Dir
+    if (!fileInfo.isDir()) {
+        // Get Extension Key
+        QString extKey = extensionKey(fileInfo.fileName());
+        // Get Mime Types By File Name - Glob Matching Only, No I/O
+        QList<QMimeType> nameTypes = mimeDatabase.mimeTypesForFileName(fileInfo.fileName());
+
+        // Check For Unambiguous Match
+        if (nameTypes.count() == 1) {
+            // Init Item
+            MimeTypeCacheItem item(nameTypes[0].name(), nameTypes[0].comment(), modified);
+
+            // Check Extension Key - Only Cache If The Bare Extension Maps To The Same Type
+            if (!extKey.isEmpty() && mimeDatabase.mimeTypesForFileName(QString("x.") + extKey) == nameTypes) {
+                QWriteLocker locker(&cacheLock);
+                // Store Extension Item
+                extensionCache[extKey] = item;
+            }
+
+            return item;
+        }
+    }
+
+#if defined(Q_OS_UNIX)
+
+    // Init Stat
+    struct stat st;
+
+    // Get Stat
+    if (stat(aFilePath.toLocal8Bit().constData(), &st) == 0) {
+        // Init Content Key
+        QPair<quint64, quint64> contentKey((quint64)st.st_dev, (quint64)st.st_ino);
+        // Get Content Modified
+        qint64 contentModified = (qint64)st.st_mtime * DEFAULT_ONE_SEC;
+
+        {
+            QReadLocker locker(&cacheLock);
+
+            // Find Content Item
+            QHash<QPair<quint64, quint64>, MimeTypeCacheItem>::const_iterator cit = contentCache.constFind(contentKey);
+
+            // Check Content Item - Same Inode, Not Modified Since Sniffed
+            if (cit != contentCache.constEnd() && cit.value().modified == contentModified) {
+                return MimeTypeCacheItem(cit.value().name, cit.value().comment, modified);
+            }
+        }
+
+        // Get Mime Type - Sniffs Content
+        QMimeType mime = mimeDatabase.mimeTypeForFile(fileInfo);
+
+        {
+            QWriteLocker locker(&cacheLock);
+            // Store Content Item
+            contentCache[contentKey] = MimeTypeCacheItem(mime.name(), mime.comment(), contentModified);
+        }
+
+        return MimeTypeCacheItem(mime.name(), mime.comment(), modified);
+    }
+
+#endif // Q_OS_UNIX
+
+    // Get Mime Type
+    QMimeType mime = mimeDatabase.mimeTypeForFile(fileInfo);
+
+    return MimeTypeCacheItem(mime.name(), mime.comment(), modified);
+}
+
+//==============================================================================
+// Store Resolved Item
+//==============================================================================
+void MimeTypeCache::storeItem(const QString& aFilePath, const MimeTypeCacheItem& aItem)
+{
+    {
+        QWriteLocker locker(&cacheLock);
+
+        // Check Path Cache Size
+        if (pathCache.count() >= DEFAULT_MIME_TYPE_CACHE_MAX_ITEMS) {
+            // Clear Path Cache
+            pathCache.clear();
+        }
+
+        // Check Content Cache Size
+        if (contentCache.count() >= DEFAULT_MIME_TYPE_CACHE_MAX_ITEMS) {
+            // Clear Content Cache
+            contentCache.clear();
+        }
+
+        // Store Path Item
+        pathCache[aFilePath] = aItem;
+        // Remove From Pending
+        pendingPaths.remove(aFilePath);
+    }
+
+    // Emit Mime Type Resolved Signal
+    emit mimeTypeResolved(aFilePath, aItem.name);
+}
+
+//==============================================================================
+// Get Extension Key
+//==============================================================================
+QString MimeTypeCache::extensionKey(const QString& aFileName)
+{
+    // Get Dot Index - Skip Leading Dot Of Hidden Files
+    int dotIndex = aFileName.indexOf(QChar('.'), 1);
+
+    // Check Dot Index
+    if (dotIndex < 0) {
+        return QString("");
+    }
+
+    // Complete Suffix - Keeps Case, Globs Like *.C And *.c Differ
+    return aFileName.mid(dotIndex + 1);
+}
+
+//==============================================================================
+// Destructor
+//==============================================================================
+MimeTypeCache::~MimeTypeCache()
+{
+    // Drop Queued Lookups
+    resolverPool.clear();
+    // Wait For Running Lookups
+    resolverPool.waitForDone();
+
+    qDebug() << "MimeTypeCache::~MimeTypeCache";
+}
+
+
+
+
+
+
+
+//==============================================================================
+// Constructor
+//==============================================================================
+MimeTypeResolver::MimeTypeResolver(MimeTypeCache* aCache, const QString& aFilePath)
+    : QRunnable()
+    , cache(aCache)
+    , filePath(aFilePath)
+{
+}
+
+//==============================================================================
+// Run
+//==============================================================================
+void MimeTypeResolver::run()
+{
+    // Resolve Mime Type
+    MimeTypeCacheItem item = cache->resolve(filePath);
+
+    // Store Item
+    cache->storeItem(filePath, item);
+}
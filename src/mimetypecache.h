@@ -0,0 +1,134 @@
+#ifndef MIMETYPECACHE_H
+#define MIMETYPECACHE_H
+
+#include <QObject>
+#include <QString>
+#include <QFileInfo>
+#include <QHash>
+#include <QPair>
+#include <QSet>
+#include <QMutex>
+#include <QReadWriteLock>
+#include <QThreadPool>
+#include <QRunnable>
+
+
+//==============================================================================
+// Mime Type Cache Item Class
+//==============================================================================
+class MimeTypeCacheItem
+{
+public:
+    // Constructor
+    explicit MimeTypeCacheItem(const QString& aName = "", const QString& aComment = "", const qint64& aModified = 0);
+
+    // Mime Type Name
+    QString         name;
+    // Mime Type Comment
+    QString         comment;
+    // Last Modified - msecs Since Epoch, Used To Validate Path/Content Entries
+    qint64          modified;
+};
+
+
+
+
+//==============================================================================
+// Mime Type Cache Class - Process Wide Mime Type Cache
+//==============================================================================
+class MimeTypeCache : public QObject
+{
+    Q_OBJECT
+
+public:
+
+    // Get Instance - Static Constructor
+    static MimeTypeCache* getInstance();
+
+    // Release
+    void release();
+
+    // Get Mime Type Name - Never Blocks Unless aWait Is Set, Returns Empty String While Pending
+    QString mimeType(const QFileInfo& aFileInfo, const bool& aWait = false);
+    // Get Mime Type Comment - Never Blocks Unless aWait Is Set, Returns Empty String While Pending
+    QString mimeComment(const QFileInfo& aFileInfo, const bool& aWait = false);
+
+    // Clear Cache
+    void clear();
+
+signals:
+
+    // Mime Type Resolved Signal
+    void mimeTypeResolved(const QString& aFilePath, const QString& aMimeType);
+
+protected: // Constructor/Destructor
+
+    // Constructor
+    explicit MimeTypeCache(QObject* aParent = NULL);
+
+    // Destructor
+    virtual ~MimeTypeCache();
+
+protected:
+    friend class MimeTypeResolver;
+
+    // Lookup Item
+    MimeTypeCacheItem lookup(const QFileInfo& aFileInfo, const bool& aWait);
+
+    // Resolve Mime Type - Blocking
+    MimeTypeCacheItem resolve(const QString& aFilePath);
+
+    // Store Resolved Item
+    void storeItem(const QString& aFilePath, const MimeTypeCacheItem& aItem);
+
+    // Get Extension Key
+    static QString extensionKey(const QString& aFileName);
+
+protected:
+
+    // Int Ref Counter
+    int                                                     refCount;
+
+    // Cache Lock
+    QReadWriteLock                                          cacheLock;
+
+    // Extension Cache - Unambiguous Glob Matches, No I/O Needed
+    QHash<QString, MimeTypeCacheItem>                       extensionCache;
+    // Content Cache - Sniffed Types Keyed By Device + Inode
+    QHash<QPair<quint64, quint64>, MimeTypeCacheItem>       contentCache;
+    // Path Cache - Last Resolved Type By Path
+    QHash<QString, MimeTypeCacheItem>                       pathCache;
+
+    // Pending Lookups
+    QSet<QString>                                           pendingPaths;
+
+    // Resolver Thread Pool
+    QThreadPool                                             resolverPool;
+};
+
+
+
+
+//==============================================================================
+// Mime Type Resolver Class - Runs Mime Detection On Resolver Thread Pool
+//==============================================================================
+class MimeTypeResolver : public QRunnable
+{
+public:
+    // Constructor
+    explicit MimeTypeResolver(MimeTypeCache* aCache, const QString& aFilePath);
+
+protected: // From QRunnable
+
+    // Run
+    virtual void run();
+
+protected:
+
+    // Cache
+    MimeTypeCache*      cache;
+    // File Path
+    QString             filePath;
+};
+
+#endif // MIMETYPECACHE_H
@@ -0,0 +1,337 @@
+#include <QDateTime>
+#include <QReadLocker>
+#include <QWriteLocker>
+#include <QMutexLocker>
+#include <QDebug>
+
+#if defined(Q_OS_UNIX)
+
+#include <pwd.h>
+#include <grp.h>
+#include <unistd.h>
+
+#endif // Q_OS_UNIX
+
+#include "ownernamecache.h"
+#include "constants.h"
+
+
+// Owner Name Cache Singleton
+static OwnerNameCache* ownerNameCacheSingleton = NULL;
+// Singleton Mutex
+static QMutex ownerNameCacheMutex;
+
+
+//==============================================================================
+// Constructor
+//==============================================================================
+OwnerNameCacheItem::OwnerNameCacheItem(const QString& aName, const qint64& aExpires)
+    : name(aName)
+    , expires(aExpires)
+{
+}
+
+
+
+
+
+
+
+//==============================================================================
+// Get Instance - Static Constructor
+//==============================================================================
+OwnerNameCache* OwnerNameCache::getInstance()
+{
+    QMutexLocker locker(&ownerNameCacheMutex);
+
+    // Check Singleton
+    if (!ownerNameCacheSingleton) {
+        // Create Singleton
+        ownerNameCacheSingleton = new OwnerNameCache();
+    } else {
+        // Inc Ref Count
+        ownerNameCacheSingleton->refCount++;
+    }
+
+    return ownerNameCacheSingleton;
+}
+
+//==============================================================================
+// Constructor
+//==============================================================================
+OwnerNameCache::OwnerNameCache(QObject* aParent)
+    : QObject(aParent)
+    , refCount(1)
+    , timeToLive(DEFAULT_OWNER_NAME_CACHE_TTL)
+{
+    qDebug() << "OwnerNameCache::OwnerNameCache";
+
+    // Set Max Thread Count - NSS Backends Don't Like Being Hammered
+    resolverPool.setMaxThreadCount(DEFAULT_OWNER_NAME_RESOLVER_THREADS);
+}
+
+//==============================================================================
+// Release
+//==============================================================================
+void OwnerNameCache::release()
+{
+    QMutexLocker locker(&ownerNameCacheMutex);
+
+    // Dec Ref Count
+    refCount--;
+
+    // Check Ref Count
+    if (refCount <= 0 && ownerNameCacheSingleton) {
+        // Delete Singleton
+        delete ownerNameCacheSingleton;
+        ownerNameCacheSingleton = NULL;
+    }
+}
+
+//==============================================================================
+// Get User Name
+//==============================================================================
+QString OwnerNameCache::userName(const uint& aUID, const bool& aWait)
+{
+    return lookup(aUID, false, aWait);
+}
+
+//==============================================================================
+// Get Group Name
+//==============================================================================
+QString OwnerNameCache::groupName(const uint& aGID, const bool& aWait)
+{
+    return lookup(aGID, true, aWait);
+}
+
+//==============================================================================
+// Get Time To Live
+//==============================================================================
+int OwnerNameCache::getTimeToLive()
+{
+    return timeToLive;
+}
+
+//==============================================================================
+// Set Time To Live
+//==============================================================================
+void OwnerNameCache::setTimeToLive(const int& aTimeToLive)
+{
+    QWriteLocker locker(&cacheLock);
+
+    // Set Time To Live
+    timeToLive = aTimeToLive;
+}
+
+//==============================================================================
+// Clear Cache
+//==============================================================================
+void OwnerNameCache::clear()
+{
+    QWriteLocker locker(&cacheLock);
+
+    // Clear User Cache
+    userCache.clear();
+    // Clear Group Cache
+    groupCache.clear();
+}
+
+//==============================================================================
+// Lookup Name
+//==============================================================================
+QString OwnerNameCache::lookup(const uint& aID, const bool& aGroup, const bool& aWait)
+{
+    // Get Current Time
+    qint64 now = QDateTime::currentMSecsSinceEpoch();
+    // Init Stale Name
+    QString staleName;
+
+    {
+        QReadLocker locker(&cacheLock);
+
+        // Get Cache
+        const QHash<uint, OwnerNameCacheItem>& cache = aGroup ? groupCache : userCache;
+        // Find Item
+        QHash<uint, OwnerNameCacheItem>::const_iterator it = cache.constFind(aID);
+
+        // Check Item
+        if (it != cache.constEnd()) {
+            // Check If Still Valid
+            if (it.value().expires > now) {
+                return it.value().name;
+            }
+
+            // Keep Stale Name Until Refreshed
+            staleName = it.value().name;
+        }
+    }
+
+    // Check Wait
+    if (aWait) {
+        // Resolve Name Synchronously
+        QString name = aGroup ? resolveGroupName(aID) : resolveUserName(aID);
+        // Store Name
+        storeName(aID, aGroup, name);
+
+        return name;
+    }
+
+    {
+        QWriteLocker locker(&cacheLock);
+
+        // Get Pending Set
+        QSet<uint>& pending = aGroup ? pendingGroups : pendingUsers;
+
+        // Check If Already Pending
+        if (!pending.contains(aID)) {
+            // Add To Pending
+            pending << aID;
+            // Start Resolver
+            resolverPool.start(new OwnerNameResolver(this, aID, aGroup));
+        }
+    }
+
+    // Return Stale Name Or Numeric ID Until Resolved
+    return staleName.isEmpty() ? QString::number(aID) : staleName;
+}
+
+//==============================================================================
+// Store Resolved Name
+//==============================================================================
+void OwnerNameCache::storeName(const uint& aID, const bool& aGroup, const QString& aName)
+{
+    {
+        QWriteLocker locker(&cacheLock);
+
+        // Init Item
+        OwnerNameCacheItem item(aName, QDateTime::currentMSecsSinceEpoch() + timeToLive);
+
+        // Check Group
+        if (aGroup) {
+            // Store Item
+            groupCache[aID] = item;
+            // Remove From Pending
+            pendingGroups.remove(aID);
+        } else {
+            // Store Item
+            userCache[aID] = item;
+            // Remove From Pending
+            pendingUsers.remove(aID);
+        }
+    }
+
+    // Check Group
+    if (aGroup) {
+        // Emit Group Name Resolved Signal
+        emit groupNameResolved(aID, aName);
+    } else {
+        // Emit User Name Resolved Signal
+        emit userNameResolved(aID, aName);
+    }
+}
+
+//==============================================================================
+// Resolve User Name - Blocking
+//==============================================================================
+QString OwnerNameCache::resolveUserName(const uint& aUID)
+{
+#if defined(Q_OS_UNIX)
+
+    // Get Buffer Size
+    long bufferSize = sysconf(_SC_GETPW_R_SIZE_MAX);
+    // Check Buffer Size
+    if (bufferSize <= 0) {
+        // Set Default Buffer Size
+        bufferSize = DEFAULT_OWNER_NAME_BUFFER_SIZE;
+    }
+
+    // Init Buffer
+    QByteArray buffer(bufferSize, 0);
+    // Init Password Entry
+    struct passwd pwd;
+    // Init Result
+    struct passwd* result = NULL;
+
+    // Get Password Entry
+    if (getpwuid_r((uid_t)aUID, &pwd, buffer.data(), buffer.size(), &result) == 0 && result) {
+        return QString::fromLocal8Bit(result->pw_name);
+    }
+
+#endif // Q_OS_UNIX
+
+    return QString::number(aUID);
+}
+
+//==============================================================================
+// Resolve Group Name - Blocking
+//==============================================================================
+QString OwnerNameCache::resolveGroupName(const uint& aGID)
+{
+#if defined(Q_OS_UNIX)
+
+    // Get Buffer Size
+    long bufferSize = sysconf(_SC_GETGR_R_SIZE_MAX);
+    // Check Buffer Size
+    if (bufferSize <= 0) {
+        // Set Default Buffer Size
+        bufferSize = DEFAULT_OWNER_NAME_BUFFER_SIZE;
+    }
+
+    // Init Buffer
+    QByteArray buffer(bufferSize, 0);
+    // Init Group Entry
+    struct group grp;
+    // Init Result
+    struct group* result = NULL;
+
+    // Get Group Entry
+    if (getgrgid_r((gid_t)aGID, &grp, buffer.data(), buffer.size(), &result) == 0 && result) {
+        return QString::fromLocal8Bit(result->gr_name);
+    }
+
+#endif // Q_OS_UNIX
+
+    return QString::number(aGID);
+}
+
+//==============================================================================
+// Destructor
+//==============================================================================
+OwnerNameCache::~OwnerNameCache()
+{
+    // Drop Queued Lookups
+    resolverPool.clear();
+    // Wait For Running Lookups
+    resolverPool.waitForDone();
+
+    qDebug() << "OwnerNameCache::~OwnerNameCache";
+}
+
+
+
+
+
+
+
+//==============================================================================
+// Constructor
+//==============================================================================
+OwnerNameResolver::OwnerNameResolver(OwnerNameCache* aCache, const uint& aID, const bool& aGroup)
+    : QRunnable()
+    , cache(aCache)
+    , id(aID)
+    , group(aGroup)
+{
+}
+
+//==============================================================================
+// Run
+//==============================================================================
+void OwnerNameResolver::run()
+{
+    // Resolve Name
+    QString name = group ? OwnerNameCache::resolveGroupName(id) : OwnerNameCache::resolveUserName(id);
+
+    // Store Name
+    cache->storeName(id, group, name);
+}
@@ -0,0 +1,141 @@
+#ifndef OWNERNAMECACHE_H
+#define OWNERNAMECACHE_H
+
+#include <QObject>
+#include <QString>
+#include <QHash>
+#include <QSet>
+#include <QMutex>
+#include <QReadWriteLock>
+#include <QThreadPool>
+#include <QRunnable>
+
+
+//==============================================================================
+// Owner Name Cache Item Class
+//==============================================================================
+class OwnerNameCacheItem
+{
+public:
+    // Constructor
+    explicit OwnerNameCacheItem(const QString& aName = "", const qint64& aExpires = 0);
+
+    // Resolved Name
+    QString         name;
+    // Expiration Time - msecs Since Epoch
+    qint64          expires;
+};
+
+
+
+
+//==============================================================================
+// Owner Name Cache Class - Process Wide uid/gid To Name Cache
+//==============================================================================
+class OwnerNameCache : public QObject
+{
+    Q_OBJECT
+
+public:
+
+    // Get Instance - Static Constructor
+    static OwnerNameCache* getInstance();
+
+    // Release
+    void release();
+
+    // Get User Name - Never Blocks Unless aWait Is Set
+    QString userName(const uint& aUID, const bool& aWait = false);
+    // Get Group Name - Never Blocks Unless aWait Is Set
+    QString groupName(const uint& aGID, const bool& aWait = false);
+
+    // Get Time To Live
+    int getTimeToLive();
+    // Set Time To Live
+    void setTimeToLive(const int& aTimeToLive);
+
+    // Clear Cache
+    void clear();
+
+signals:
+
+    // User Name Resolved Signal
+    void userNameResolved(const uint& aUID, const QString& aUserName);
+    // Group Name Resolved Signal
+    void groupNameResolved(const uint& aGID, const QString& aGroupName);
+
+protected: // Constructor/Destructor
+
+    // Constructor
+    explicit OwnerNameCache(QObject* aParent = NULL);
+
+    // Destructor
+    virtual ~OwnerNameCache();
+
+protected:
+    friend class OwnerNameResolver;
+
+    // Lookup Name
+    QString lookup(const uint& aID, const bool& aGroup, const bool& aWait);
+
+    // Store Resolved Name
+    void storeName(const uint& aID, const bool& aGroup, const QString& aName);
+
+    // Resolve User Name - Blocking
+    static QString resolveUserName(const uint& aUID);
+    // Resolve Group Name - Blocking
+    static QString resolveGroupName(const uint& aGID);
+
+protected:
+
+    // Int Ref Counter
+    int                                 refCount;
+
+    // Time To Live - msecs
+    int                                 timeToLive;
+
+    // Cache Lock
+    QReadWriteLock                      cacheLock;
+
+    // User Name Cache
+    QHash<uint, OwnerNameCacheItem>     userCache;
+    // Group Name Cache
+    QHash<uint, OwnerNameCacheItem>     groupCache;
+
+    // Pending User Lookups
+    QSet<uint>                          pendingUsers;
+    // Pending Group Lookups
+    QSet<uint>                          pendingGroups;
+
+    // Resolver Thread Pool
+    QThreadPool                         resolverPool;
+};
+
+
+
+
+//==============================================================================
+// Owner Name Resolver Class - Runs NSS Lookup On Resolver Thread Pool
+//==============================================================================
+class OwnerNameResolver : public QRunnable
+{
+public:
+    // Constructor
+    explicit OwnerNameResolver(OwnerNameCache* aCache, const uint& aID, const bool& aGroup);
+
+protected: // From QRunnable
+
+    // Run
+    virtual void run();
+
+protected:
+
+    // Cache
+    OwnerNameCache*     cache;
+    // uid/gid
+    uint                id;
+    // Group Lookup
+    bool                group;
+};
+
+#endif // OWNERNAMECACHE_H
@@ -1,3 +1,5 @@
+#include <QCoreApplication>
+#include <QTimerEvent>
 #include <QDebug>
 
 #include "settingscontroller.h"
@@ -35,6 +37,7 @@ SettingsController::SettingsController(QObject* aParent)
     : QObject(aParent)
     , refCount(1)
     , dirty(false)
+    , flushTimerID(-1)
 
     , showFunctionKeys(DEFAULT_SETTINGS_SHOW_FUNCTION_KEYS)
     , showDirHotKeys(DEFAULT_SETTINGS_SHOW_DIRECTORIY_HOT_KEYS)
@@ -86,6 +89,15 @@ SettingsController::SettingsController(QObject* aParent)
 {
     qDebug() << "SettingsController::SettingsController";
 
+    // Set Max Thread Count
+    flushPool.setMaxThreadCount(1);
+
+    // Check Application
+    if (QCoreApplication::instance()) {
+        // Connect Signals - Flush Even If The Singleton Is Never Released
+        connect(QCoreApplication::instance(), SIGNAL(aboutToQuit()), this, SLOT(flush()));
+    }
+
     // ...
 
 }
@@ -113,6 +125,16 @@ void SettingsController::release()
 //==============================================================================
 QVariant SettingsController::value(const QString& aKey, const QVariant& aDefaultValue)
 {
+    // Check Pending Values - Not Written To QSettings Yet
+    if (pendingValues.contains(aKey)) {
+        return pendingValues.value(aKey);
+    }
+
+    // Check Flushing Values - The Flush Task May Not Have Written Them Yet
+    if (flushingValues.contains(aKey)) {
+        return flushingValues.value(aKey);
+    }
+
     return settings.value(aKey, aDefaultValue);
 }
 
@@ -121,11 +143,11 @@ QVariant SettingsController::value(const QString& aKey, const QVariant& aDefault
 //==============================================================================
 void SettingsController::setValue(const QString& aKey, const QVariant& aValue)
 {
-    // Set Value Directly
-    settings.setValue(aKey, aValue);
+    // Set Pending Value - QSettings Is Only Written By The Flush Task
+    pendingValues[aKey] = aValue;
 
-    // Sync Values
-    settings.sync();
+    // Schedule Flush
+    scheduleFlush();
 
     // Set Dirty
     //setDirty(true);
@@ -234,60 +256,180 @@ void SettingsController::saveSettings()
 
     qDebug() << "SettingsController::saveSettings";
 
-    settings.setValue(SETTINGS_KEY_SHOW_FUNCTION_KEYS, showFunctionKeys);
-    settings.setValue(SETTINGS_KEY_SHOW_DIR_HOT_KEYS, showDirHotKeys);
-    settings.setValue(SETTINGS_KEY_SHOW_DRIVE_BUTTONS, showDriveButtons);
-    settings.setValue(SETTINGS_KEY_CLOSE_WHEN_FINISHED, closeWhenFinished);
-
-    settings.setValue(SETTINGS_KEY_SELECT_DIRS, selectDirectories);
-    settings.setValue(SETTINGS_KEY_SHOW_HIDDEN_FILES, showHiddenFiles);
-    settings.setValue(SETTINGS_KEY_DIRFIRST, showDirsFirst);
-    settings.setValue(SETTINGS_KEY_CASE_SENSITIVE, caseSensitiveSort);
-
-    settings.setValue(SETTINGS_KEY_PANEL_USE_DEFAULT_ICONS, useDefaultIcons);
-    settings.setValue(SETTINGS_KEY_SHOW_FULL_SIZES, showFullSizes);
-    settings.setValue(SETTINGS_KEY_PANEL_COPY_HIDDEN_FILES, copyHiddenFiles);
-    settings.setValue(SETTINGS_KEY_FOLLOW_LINKS, followLinks);
-
-    settings.setValue(SETTINGS_KEY_PANEL_COLOR_TEXT, textColor);
-    settings.setValue(SETTINGS_KEY_PANEL_COLOR_TEXT_BG, textBGColor);
-    settings.setValue(SETTINGS_KEY_PANEL_COLOR_CURRENT, currentColor);
-    settings.setValue(SETTINGS_KEY_PANEL_COLOR_CURRENT_BG, currentBGColor);
-    settings.setValue(SETTINGS_KEY_PANEL_COLOR_SELECTED, selectedColor);
-    settings.setValue(SETTINGS_KEY_PANEL_COLOR_SELECTED_BG, selectedBGColor);
-    settings.setValue(SETTINGS_KEY_PANEL_COLOR_CURRENT_SELECTED, currentSelectedColor);
-    settings.setValue(SETTINGS_KEY_PANEL_COLOR_CURRENT_SELECTED_BG, currentSelectedBGColor);
-    settings.setValue(SETTINGS_KEY_PANEL_COLOR_HIDDEN, hiddenColor);
-    settings.setValue(SETTINGS_KEY_PANEL_COLOR_HIDDEN_BG, hiddenBGColor);
-    settings.setValue(SETTINGS_KEY_PANEL_COLOR_LINK, linkColor);
-    settings.setValue(SETTINGS_KEY_PANEL_COLOR_LINK_BG, linkBGColor);
-    settings.setValue(SETTINGS_KEY_PANEL_COLOR_ARCHIVE, archiveColor);
-    settings.setValue(SETTINGS_KEY_PANEL_COLOR_ARCHIVE_BG, archiveBGColor);
-
-    settings.setValue(SETTINGS_KEY_PANEL_FONT_NAME, fontName);
-    settings.setValue(SETTINGS_KEY_PANEL_FONT_SIZE, fontSize);
-    settings.setValue(SETTINGS_KEY_PANEL_FONT_BOLD, fontBold);
-    settings.setValue(SETTINGS_KEY_PANEL_FONT_ITALIC, fontItalic);
-
-    settings.setValue(SETTINGS_KEY_THUMBS_WIDTH, thumbWidth);
-    settings.setValue(SETTINGS_KEY_THUMBS_HEIGHT, thumbHeight);
-
-    settings.setValue(SETTINGS_KEY_GRID_THUMBS_WIDTH, gridThumbWidth);
-    settings.setValue(SETTINGS_KEY_GRID_THUMBS_HEIGHT, gridThumbHeight);
-
-    settings.setValue(SETTINGS_KEY_APPS_TERMINAL, terminalPath);
-    settings.setValue(SETTINGS_KEY_APPS_VIEWER, viewerPath);
-    settings.setValue(SETTINGS_KEY_APPS_EDITOR, editorPath);
-    settings.setValue(SETTINGS_KEY_APPS_COMPARE, comparePath);
-    settings.setValue(SETTINGS_KEY_APPS_PACKER, packerPath);
-    settings.setValue(SETTINGS_KEY_APPS_UNPACKER, unPackerPath);
+    pendingValues.insert(SETTINGS_KEY_SHOW_FUNCTION_KEYS, showFunctionKeys);
+    pendingValues.insert(SETTINGS_KEY_SHOW_DIR_HOT_KEYS, showDirHotKeys);
+    pendingValues.insert(SETTINGS_KEY_SHOW_DRIVE_BUTTONS, showDriveButtons);
+    pendingValues.insert(SETTINGS_KEY_CLOSE_WHEN_FINISHED, closeWhenFinished);
+
+    pendingValues.insert(SETTINGS_KEY_SELECT_DIRS, selectDirectories);
+    pendingValues.insert(SETTINGS_KEY_SHOW_HIDDEN_FILES, showHiddenFiles);
+    pendingValues.insert(SETTINGS_KEY_DIRFIRST, showDirsFirst);
+    pendingValues.insert(SETTINGS_KEY_CASE_SENSITIVE, caseSensitiveSort);
+
+    pendingValues.insert(SETTINGS_KEY_PANEL_USE_DEFAULT_ICONS, useDefaultIcons);
+    pendingValues.insert(SETTINGS_KEY_SHOW_FULL_SIZES, showFullSizes);
+    pendingValues.insert(SETTINGS_KEY_PANEL_COPY_HIDDEN_FILES, copyHiddenFiles);
+    pendingValues.insert(SETTINGS_KEY_FOLLOW_LINKS, followLinks);
+
+    pendingValues.insert(SETTINGS_KEY_PANEL_COLOR_TEXT, textColor);
+    pendingValues.insert(SETTINGS_KEY_PANEL_COLOR_TEXT_BG, textBGColor);
+    pendingValues.insert(SETTINGS_KEY_PANEL_COLOR_CURRENT, currentColor);
+    pendingValues.insert(SETTINGS_KEY_PANEL_COLOR_CURRENT_BG, currentBGColor);
+    pendingValues.insert(SETTINGS_KEY_PANEL_COLOR_SELECTED, selectedColor);
+    pendingValues.insert(SETTINGS_KEY_PANEL_COLOR_SELECTED_BG, selectedBGColor);
+    pendingValues.insert(SETTINGS_KEY_PANEL_COLOR_CURRENT_SELECTED, currentSelectedColor);
+    pendingValues.insert(SETTINGS_KEY_PANEL_COLOR_CURRENT_SELECTED_BG, currentSelectedBGColor);
+    pendingValues.insert(SETTINGS_KEY_PANEL_COLOR_HIDDEN, hiddenColor);
+    pendingValues.insert(SETTINGS_KEY_PANEL_COLOR_HIDDEN_BG, hiddenBGColor);
+    pendingValues.insert(SETTINGS_KEY_PANEL_COLOR_LINK, linkColor);
+    pendingValues.insert(SETTINGS_KEY_PANEL_COLOR_LINK_BG, linkBGColor);
+    pendingValues.insert(SETTINGS_KEY_PANEL_COLOR_ARCHIVE, archiveColor);
+    pendingValues.insert(SETTINGS_KEY_PANEL_COLOR_ARCHIVE_BG, archiveBGColor);
+
+    pendingValues.insert(SETTINGS_KEY_PANEL_FONT_NAME, fontName);
+    pendingValues.insert(SETTINGS_KEY_PANEL_FONT_SIZE, fontSize);
+    pendingValues.insert(SETTINGS_KEY_PANEL_FONT_BOLD, fontBold);
+    pendingValues.insert(SETTINGS_KEY_PANEL_FONT_ITALIC, fontItalic);
+
+    pendingValues.insert(SETTINGS_KEY_THUMBS_WIDTH, thumbWidth);
+    pendingValues.insert(SETTINGS_KEY_THUMBS_HEIGHT, thumbHeight);
+
+    pendingValues.insert(SETTINGS_KEY_GRID_THUMBS_WIDTH, gridThumbWidth);
+    pendingValues.insert(SETTINGS_KEY_GRID_THUMBS_HEIGHT, gridThumbHeight);
+
+    pendingValues.insert(SETTINGS_KEY_APPS_TERMINAL, terminalPath);
+    pendingValues.insert(SETTINGS_KEY_APPS_VIEWER, viewerPath);
+    pendingValues.insert(SETTINGS_KEY_APPS_EDITOR, editorPath);
+    pendingValues.insert(SETTINGS_KEY_APPS_COMPARE, comparePath);
+    pendingValues.insert(SETTINGS_KEY_APPS_PACKER, packerPath);
+    pendingValues.insert(SETTINGS_KEY_APPS_UNPACKER, unPackerPath);
 
     // ...
 
-    // Sync
+    // Schedule Flush
+    scheduleFlush();
+}
+
+//==============================================================================
+// Schedule Flush
+//==============================================================================
+void SettingsController::scheduleFlush()
+{
+    // Check Flush Timer ID - Debounce, Bursts Of Writes Share One Sync
+    if (flushTimerID == -1) {
+        // Start Flush Timer
+        flushTimerID = startTimer(DEFAULT_SETTINGS_FLUSH_DELAY);
+    }
+}
+
+//==============================================================================
+// Start Background Flush
+//==============================================================================
+void SettingsController::startFlush()
+{
+    // Check Flush Timer ID
+    if (flushTimerID != -1) {
+        // Kill Flush Timer
+        killTimer(flushTimerID);
+        flushTimerID = -1;
+    }
+
+    // Check Pending Values
+    if (pendingValues.isEmpty()) {
+        return;
+    }
+
+    //qDebug() << "SettingsController::startFlush - pendingValues: " << pendingValues.count();
+
+    // Create Flush Task - Gets Its Own Copy Of The Batch
+    SettingsFlushTask* task = new SettingsFlushTask(pendingValues);
+
+    // Go Thru Pending Values
+    foreach (QString key, pendingValues.keys()) {
+        // Add Flushing Value
+        flushingValues[key] = pendingValues.value(key);
+    }
+
+    // Clear Pending Values
+    pendingValues.clear();
+
+    // Add Flush Task
+    flushTasks << task;
+
+    // Connect Signals - Queued, Emitted From The Worker Thread
+    connect(task, SIGNAL(flushFinished()), this, SLOT(flushTaskFinished()), Qt::QueuedConnection);
+
+    // Start Flush Task
+    flushPool.start(task);
+}
+
+//==============================================================================
+// Flush Task Finished Slot
+//==============================================================================
+void SettingsController::flushTaskFinished()
+{
+    // Get Flush Task
+    SettingsFlushTask* task = qobject_cast<SettingsFlushTask*>(sender());
+
+    // Check Flush Task
+    if (!task || !flushTasks.contains(task)) {
+        return;
+    }
+
+    // Remove Flush Task
+    flushTasks.removeAll(task);
+    // Delete Flush Task - The Worker May Still Be Returning From Run
+    task->deleteLater();
+
+    // Check Flush Tasks - Values Are In QSettings Once All Handed Off Batches Are Written
+    if (flushTasks.isEmpty()) {
+        // Clear Flushing Values
+        flushingValues.clear();
+    }
+}
+
+//==============================================================================
+// Flush
+//==============================================================================
+void SettingsController::flush()
+{
+    // Check Flush Timer ID
+    if (flushTimerID != -1) {
+        // Kill Flush Timer
+        killTimer(flushTimerID);
+        flushTimerID = -1;
+    }
+
+    // Wait For Flush Tasks - Earlier Batches Land First
+    flushPool.waitForDone();
+
+    // Go Thru Pending Values
+    foreach (QString key, pendingValues.keys()) {
+        // Set Value
+        settings.setValue(key, pendingValues.value(key));
+    }
+
+    // Clear Pending Values
+    pendingValues.clear();
+    // Clear Flushing Values - Written By The Finished Tasks
+    flushingValues.clear();
+
+    // Sync - Synchronous, Durable On Exit
     settings.sync();
 }
 
+//==============================================================================
+// Timer Event
+//==============================================================================
+void SettingsController::timerEvent(QTimerEvent* aEvent)
+{
+    // Check Event
+    if (aEvent && aEvent->timerId() == flushTimerID) {
+        // Start Background Flush
+        startFlush();
+    }
+}
+
 //==============================================================================
 // Restore Defaults
 //==============================================================================
@@ -1380,6 +1522,58 @@ SettingsController::~SettingsController()
     // Save Settings
     saveSettings();
 
+    // Flush - Durable On Exit
+    flush();
+
+    // Delete Flush Tasks - Finished, Their Signals Are Not Delivered Any More
+    qDeleteAll(flushTasks);
+    // Clear Flush Tasks
+    flushTasks.clear();
+
     qDebug() << "SettingsController::~SettingsController";
 }
 
+
+
+
+
+
+
+//==============================================================================
+// Constructor
+//==============================================================================
+SettingsFlushTask::SettingsFlushTask(const QHash<QString, QVariant>& aValues)
+    : QObject(NULL)
+    , QRunnable()
+    , values(aValues)
+{
+    // Set Auto Delete - Deleted By The Controller
+    setAutoDelete(false);
+}
+
+//==============================================================================
+// Run
+//==============================================================================
+void SettingsFlushTask::run()
+{
+    // Init Settings - Owned By This Thread, The GUI Thread Instance Is Never Written
+    QSettings settings;
+
+    // Go Thru Values
+    foreach (QString key, values.keys()) {
+        // Set Value
+        settings.setValue(key, values.value(key));
+    }
+
+    // Sync
+    settings.sync();
+
+    // Check Status
+    if (settings.status() != QSettings::NoError) {
+        qWarning() << "SettingsFlushTask::run - status: " << settings.status() << " - SYNC FAILED!!";
+    }
+
+    // Emit Flush Finished - Must Be The Last Access, The Receiver Deletes The Task
+    emit flushFinished();
+}
+
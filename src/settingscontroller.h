@@ -4,6 +4,12 @@
 #include <QObject>
 #include <QSettings>
 #include <QVariant>
+#include <QHash>
+#include <QList>
+#include <QThreadPool>
+#include <QRunnable>
+
+class SettingsFlushTask;
 
 //==============================================================================
 // Settings Settings Controller
@@ -78,7 +84,7 @@ public:
 
     // Get Value
     QVariant value(const QString& aKey, const QVariant& aDefaultValue = QVariant());
-    // Set Value
+    // Set Value - Written Behind, Flushed To Disk After A Short Delay
     void setValue(const QString& aKey, const QVariant& aValue);
 
     // Begin Global Settings Update
@@ -393,6 +399,21 @@ signals:
     // Unpacker Path Changed Signal
     void unpackerPathChanged(const QString& aUnpackerPath);
 
+public slots:
+
+    // Flush - Waits For The Pending Writes To Reach The Disk
+    void flush();
+
+protected slots:
+
+    // Flush Task Finished Slot
+    void flushTaskFinished();
+
+protected: // From QObject
+
+    // Timer Event
+    virtual void timerEvent(QTimerEvent* aEvent);
+
 protected: // Constructor/Destructor
 
     // Constructor
@@ -411,6 +432,11 @@ protected:
     // Set Dirty
     void setDirty(const bool& aDirty);
 
+    // Schedule Flush - Batches Writes Until The Flush Timer Fires
+    void scheduleFlush();
+    // Start Background Flush
+    void startFlush();
+
 protected:
 
     // Int Ref Counter
@@ -421,6 +447,17 @@ protected:
     // Dirty
     bool                    dirty;
 
+    // Pending Values - Dirty Keys Not Yet Handed To A Flush Task
+    QHash<QString, QVariant>    pendingValues;
+    // Flushing Values - Handed To Flush Tasks That Have Not Finished Yet
+    QHash<QString, QVariant>    flushingValues;
+    // Flush Tasks - Running Or Queued
+    QList<SettingsFlushTask*>   flushTasks;
+    // Flush Timer ID
+    int                     flushTimerID;
+    // Flush Thread Pool - Single Thread, Syncs Run In Order
+    QThreadPool             flushPool;
+
 
     // Show Function Keys
     bool                    showFunctionKeys;
@@ -512,4 +549,35 @@ protected:
     // ...
 };
 
+
+
+
+
+//==============================================================================
+// Settings Flush Task Class - Writes And Syncs Settings Off The GUI Thread
+//==============================================================================
+class SettingsFlushTask : public QObject, public QRunnable
+{
+    Q_OBJECT
+
+public:
+    // Constructor
+    explicit SettingsFlushTask(const QHash<QString, QVariant>& aValues);
+
+signals:
+
+    // Flush Finished Signal - Emitted From The Worker Thread
+    void flushFinished();
+
+protected: // From QRunnable
+
+    // Run
+    virtual void run();
+
+protected:
+
+    // Values To Write
+    QHash<QString, QVariant>    values;
+};
+
 #endif // SETTINGSCONTROLLER_H
@@ -0,0 +1,124 @@
+#include <QPainter>
+#include <QFontMetrics>
+#include <QDebug>
+
+#include "throughputgraphwidget.h"
+#include "constants.h"
+
+
+//==============================================================================
+// Constructor
+//==============================================================================
+ThroughputGraphWidget::ThroughputGraphWidget(QWidget* aParent)
+    : QWidget(aParent)
+{
+}
+
+//==============================================================================
+// Clear
+//==============================================================================
+void ThroughputGraphWidget::clear()
+{
+    // Clear Rates
+    rates.clear();
+    // Clear Text
+    text = "";
+
+    // Update
+    update();
+}
+
+//==============================================================================
+// Set Rates
+//==============================================================================
+void ThroughputGraphWidget::setRates(const QList<quint64>& aRates)
+{
+    // Set Rates
+    rates = aRates;
+
+    // Update
+    update();
+}
+
+//==============================================================================
+// Set Text
+//==============================================================================
+void ThroughputGraphWidget::setText(const QString& aText)
+{
+    // Check Text
+    if (text != aText) {
+        // Set Text
+        text = aText;
+
+        // Update
+        update();
+    }
+}
+
+//==============================================================================
+// Paint Event
+//==============================================================================
+void ThroughputGraphWidget::paintEvent(QPaintEvent* aEvent)
+{
+    // Check Event
+    if (!aEvent) {
+        return;
+    }
+
+    // Init Painter
+    QPainter painter(this);
+
+    // Fill Background
+    painter.fillRect(rect(), palette().color(QPalette::Base));
+
+    // Init Max Rate
+    quint64 maxRate = 1;
+
+    // Go Thru Rates
+    foreach (quint64 rate, rates) {
+        // Update Max Rate
+        maxRate = qMax(maxRate, rate);
+    }
+
+    // Get Bar Width - Fixed Slots So The Graph Scrolls Instead Of Stretching
+    qreal barWidth = (qreal)width() / DEFAULT_TRANSFER_GRAPH_SAMPLES;
+    // Get Rates Count
+    int rCount = rates.count();
+
+    // Set Pen
+    painter.setPen(Qt::NoPen);
+    // Set Brush
+    painter.setBrush(palette().color(QPalette::Highlight));
+
+    // Go Thru Rates - Newest On The Right
+    for (int i=0; i<rCount; ++i) {
+        // Get Bar Height
+        qreal barHeight = (qreal)rates[i] * (height() - 1) / maxRate;
+        // Draw Bar
+        painter.drawRect(QRectF(width() - (rCount - i) * barWidth, height() - barHeight, qMax(barWidth - 1.0, 1.0), barHeight));
+    }
+
+    // Check Text
+    if (!text.isEmpty()) {
+        // Get Font Metrics
+        QFontMetrics fontMetrics = painter.fontMetrics();
+        // Set Pen
+        painter.setPen(palette().color(QPalette::Text));
+        // Draw Text
+        painter.drawText(rect().adjusted(4, 2, -4, -2), Qt::AlignLeft | Qt::AlignTop, fontMetrics.elidedText(text, Qt::ElideRight, width() - 8));
+    }
+
+    // Set Pen
+    painter.setPen(palette().color(QPalette::Mid));
+    // Set Brush
+    painter.setBrush(Qt::NoBrush);
+    // Draw Frame
+    painter.drawRect(rect().adjusted(0, 0, -1, -1));
+}
+
+//==============================================================================
+// Destructor
+//==============================================================================
+ThroughputGraphWidget::~ThroughputGraphWidget()
+{
+}
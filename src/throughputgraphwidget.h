@@ -0,0 +1,45 @@
+#ifndef THROUGHPUTGRAPHWIDGET_H
+#define THROUGHPUTGRAPHWIDGET_H
+
+#include <QWidget>
+#include <QPaintEvent>
+#include <QString>
+#include <QList>
+
+
+//==============================================================================
+// Throughput Graph Widget Class - Recent Transfer Rates As Bars
+//==============================================================================
+class ThroughputGraphWidget : public QWidget
+{
+    Q_OBJECT
+
+public:
+    // Constructor
+    explicit ThroughputGraphWidget(QWidget* aParent = NULL);
+
+    // Clear
+    void clear();
+
+    // Set Rates - Oldest First
+    void setRates(const QList<quint64>& aRates);
+    // Set Text - Drawn Over The Graph
+    void setText(const QString& aText);
+
+    // Destructor
+    virtual ~ThroughputGraphWidget();
+
+protected: // From QWidget
+
+    // Paint Event
+    virtual void paintEvent(QPaintEvent* aEvent);
+
+protected:
+
+    // Rates
+    QList<quint64>      rates;
+    // Text
+    QString             text;
+};
+
+#endif // THROUGHPUTGRAPHWIDGET_H
@@ -0,0 +1,243 @@
+#include <QImageReader>
+#include <QFileInfo>
+#include <QFile>
+#include <QDir>
+#include <QSaveFile>
+#include <QDateTime>
+#include <QUrl>
+#include <QCryptographicHash>
+#include <QStandardPaths>
+#include <QDebug>
+
+#include "thumbnailimageprovider.h"
+#include "constants.h"
+
+
+//==============================================================================
+// Constructor
+//==============================================================================
+ThumbnailImageResponse::ThumbnailImageResponse(const QString& aFilePath, const QSize& aRequestedSize)
+    : ScheduledImageResponse(aFilePath, aRequestedSize)
+{
+}
+
+//==============================================================================
+// Generate Image
+//==============================================================================
+QImage ThumbnailImageResponse::generateImage()
+{
+    // Get Thumbnail
+    QImage thumbImage = ThumbnailImageProvider::thumbnail(filePath, requestedSize, &cancelled);
+
+    // Check Thumb Image
+    if (thumbImage.isNull() && !cancelled.loadAcquire()) {
+        return QImage(DEFAULT_FILE_ICON_FILE);
+    }
+
+    return thumbImage;
+}
+
+
+
+
+
+
+
+//==============================================================================
+// Constructor
+//==============================================================================
+ThumbnailImageProvider::ThumbnailImageProvider()
+    : QQuickAsyncImageProvider()
+    , requestScheduler(DEFAULT_THUMBNAIL_THREADS)
+{
+    qDebug() << "ThumbnailImageProvider::ThumbnailImageProvider";
+}
+
+//==============================================================================
+// Get Scheduler
+//==============================================================================
+ImageRequestScheduler* ThumbnailImageProvider::scheduler()
+{
+    return &requestScheduler;
+}
+
+//==============================================================================
+// Request Image Response
+//==============================================================================
+QQuickImageResponse* ThumbnailImageProvider::requestImageResponse(const QString& aID, const QSize& aRequestedSize)
+{
+    //qDebug() << "ThumbnailImageProvider::requestImageResponse - aID: " << aID << " - aRequestedSize: " << aRequestedSize;
+
+    // Create Response
+    ThumbnailImageResponse* response = new ThumbnailImageResponse(aID, aRequestedSize);
+
+    // Submit Response - Visible Rows First, Then Newest First
+    requestScheduler.submit(response);
+
+    return response;
+}
+
+//==============================================================================
+// Get Thumbnail Size For Requested Size
+//==============================================================================
+int ThumbnailImageProvider::thumbnailSize(const QSize& aRequestedSize)
+{
+    // Get Requested Size
+    int size = qMax(aRequestedSize.width(), aRequestedSize.height());
+
+    // Check Size - No Size Requested
+    if (size <= 0) {
+        return DEFAULT_THUMBNAIL_SIZE_LARGE;
+    }
+
+    // Check Size
+    if (size <= DEFAULT_THUMBNAIL_SIZE_NORMAL) {
+        return DEFAULT_THUMBNAIL_SIZE_NORMAL;
+    }
+
+    // Check Size
+    if (size <= DEFAULT_THUMBNAIL_SIZE_LARGE) {
+        return DEFAULT_THUMBNAIL_SIZE_LARGE;
+    }
+
+    return DEFAULT_THUMBNAIL_SIZE_XLARGE;
+}
+
+//==============================================================================
+// Get Cache File Path
+//==============================================================================
+QString ThumbnailImageProvider::cacheFilePath(const QByteArray& aUri, const int& aThumbnailSize)
+{
+    // Init Flavor
+    QString flavor = aThumbnailSize <= DEFAULT_THUMBNAIL_SIZE_NORMAL ? QString("normal") : aThumbnailSize <= DEFAULT_THUMBNAIL_SIZE_LARGE ? QString("large") : QString("x-large");
+
+    return QStandardPaths::writableLocation(QStandardPaths::GenericCacheLocation) + "/" + DEFAULT_THUMBNAIL_CACHE_DIR + "/" + flavor + "/" + QCryptographicHash::hash(aUri, QCryptographicHash::Md5).toHex() + ".png";
+}
+
+//==============================================================================
+// Get Thumbnail
+//==============================================================================
+QImage ThumbnailImageProvider::thumbnail(const QString& aFilePath, const QSize& aRequestedSize, const QAtomicInt* aCancelled)
+{
+    // Init File Info
+    QFileInfo fileInfo(aFilePath);
+
+    // Check File Info
+    if (!fileInfo.isFile()) {
+        return QImage();
+    }
+
+    // Get Thumbnail Size
+    int tSize = thumbnailSize(aRequestedSize);
+    // Get URI
+    QByteArray uri = QUrl::fromLocalFile(fileInfo.absoluteFilePath()).toEncoded();
+    // Get Modification Time - secs Since Epoch
+    QString mTime = QString::number(fileInfo.lastModified().toMSecsSinceEpoch() / 1000);
+    // Get Cache File Path
+    QString cachePath = cacheFilePath(uri, tSize);
+
+    // Init Cache Reader
+    QImageReader cacheReader(cachePath);
+
+    // Check Cached Thumbnail - Valid While URI And MTime Match
+    if (cacheReader.canRead() && cacheReader.text("Thumb::URI") == QString::fromUtf8(uri) && cacheReader.text("Thumb::MTime") == mTime) {
+        // Read Cached Thumbnail
+        QImage cachedImage = cacheReader.read();
+
+        // Check Cached Image
+        if (!cachedImage.isNull()) {
+            return cachedImage;
+        }
+    }
+
+    // Check Cancelled
+    if (aCancelled && aCancelled->loadAcquire()) {
+        return QImage();
+    }
+
+    // Init Image Reader
+    QImageReader reader(fileInfo.absoluteFilePath());
+    // Set Auto Transform
+    reader.setAutoTransform(true);
+
+    // Get Image Size - Read From The Header Only
+    QSize imageSize = reader.size();
+    // Init Scaled
+    bool scaled = false;
+
+    // Check Image Size
+    if (imageSize.isValid() && (imageSize.width() > tSize || imageSize.height() > tSize)) {
+        // Set Scaled Size - Decoders Like JPEG Skip Most Of The Full Resolution Work
+        reader.setScaledSize(imageSize.scaled(tSize, tSize, Qt::KeepAspectRatio));
+        // Set Scaled
+        scaled = true;
+    }
+
+    // Read Image
+    QImage image = reader.read();
+
+    // Check Image
+    if (image.isNull()) {
+        qDebug() << "ThumbnailImageProvider::thumbnail - aFilePath: " << aFilePath << " - error: " << reader.errorString();
+        return image;
+    }
+
+    // Check Image Size - Size Was Unknown Before Decoding
+    if (image.width() > tSize || image.height() > tSize) {
+        // Scale Image
+        image = image.scaled(tSize, tSize, Qt::KeepAspectRatio, Qt::SmoothTransformation);
+        // Set Scaled
+        scaled = true;
+    }
+
+    // Get Cache Dir Path
+    QString cacheDirPath = QFileInfo(cachePath).absolutePath();
+
+    // Check Scaled - Small Images Are Not Worth Caching, Neither Are Thumbnails
+    if (!scaled || fileInfo.absoluteFilePath().startsWith(QFileInfo(cacheDirPath).absolutePath())) {
+        return image;
+    }
+
+    // Set Thumbnail Attributes
+    image.setText("Thumb::URI", QString::fromUtf8(uri));
+    image.setText("Thumb::MTime", mTime);
+    image.setText("Thumb::Size", QString::number(fileInfo.size()));
+    image.setText("Software", DEFAULT_APPLICATION_NAME);
+
+    // Check Cache Dir
+    if (!QDir(cacheDirPath).exists()) {
+        // Make Cache Dir
+        QDir().mkpath(cacheDirPath);
+        // Set Permissions - Thumbnails Are Private
+        QFile::setPermissions(QFileInfo(cacheDirPath).absolutePath(), QFile::ReadOwner | QFile::WriteOwner | QFile::ExeOwner);
+        QFile::setPermissions(cacheDirPath, QFile::ReadOwner | QFile::WriteOwner | QFile::ExeOwner);
+    }
+
+    // Init Cache File - Written Atomically
+    QSaveFile cacheFile(cachePath);
+
+    // Open Cache File
+    if (cacheFile.open(QIODevice::WriteOnly)) {
+        // Save Thumbnail
+        image.save(&cacheFile, "PNG");
+
+        // Commit
+        if (cacheFile.commit()) {
+            // Set Permissions
+            QFile::setPermissions(cachePath, QFile::ReadOwner | QFile::WriteOwner);
+        }
+    }
+
+    return image;
+}
+
+//==============================================================================
+// Destructor
+//==============================================================================
+ThumbnailImageProvider::~ThumbnailImageProvider()
+{
+    // Shutdown Scheduler
+    requestScheduler.shutdown();
+
+    qDebug() << "ThumbnailImageProvider::~ThumbnailImageProvider";
+}
@@ -0,0 +1,66 @@
+#ifndef THUMBNAILIMAGEPROVIDER_H
+#define THUMBNAILIMAGEPROVIDER_H
+
+#include <QQuickAsyncImageProvider>
+#include <QAtomicInt>
+#include <QImage>
+#include <QSize>
+
+#include "imagerequestscheduler.h"
+
+
+//==============================================================================
+// Thumbnail Image Response Class
+//==============================================================================
+class ThumbnailImageResponse : public ScheduledImageResponse
+{
+public:
+    // Constructor
+    explicit ThumbnailImageResponse(const QString& aFilePath, const QSize& aRequestedSize);
+
+protected: // From ScheduledImageResponse
+
+    // Generate Image
+    virtual QImage generateImage();
+};
+
+
+
+
+//==============================================================================
+// Thumbnail Image Provider Class - Scaled Decodes, Freedesktop Thumbnail Cache
+//==============================================================================
+class ThumbnailImageProvider : public QQuickAsyncImageProvider
+{
+public:
+    // Constructor
+    explicit ThumbnailImageProvider();
+
+    // Get Thumbnail - Cached Or Generated, Called On Worker Threads
+    static QImage thumbnail(const QString& aFilePath, const QSize& aRequestedSize, const QAtomicInt* aCancelled = NULL);
+
+    // Get Scheduler
+    ImageRequestScheduler* scheduler();
+
+    // Destructor
+    virtual ~ThumbnailImageProvider();
+
+public: // From QQuickAsyncImageProvider
+
+    // Request Image Response
+    virtual QQuickImageResponse* requestImageResponse(const QString& aID, const QSize& aRequestedSize);
+
+protected:
+
+    // Get Thumbnail Size For Requested Size - 128, 256 Or 512
+    static int thumbnailSize(const QSize& aRequestedSize);
+    // Get Cache File Path
+    static QString cacheFilePath(const QByteArray& aUri, const int& aThumbnailSize);
+
+protected:
+
+    // Request Scheduler
+    ImageRequestScheduler   requestScheduler;
+};
+
+#endif // THUMBNAILIMAGEPROVIDER_H
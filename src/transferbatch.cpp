@@ -0,0 +1,458 @@
+#include <QFile>
+#include <QDir>
+#include <QFileInfo>
+#include <QStringList>
+#include <QByteArray>
+#include <QElapsedTimer>
+#include <QThreadPool>
+#include <QDebug>
+
+#if defined(Q_OS_UNIX)
+
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <errno.h>
+#include <stdio.h>
+
+#endif // Q_OS_UNIX
+
+#if defined(Q_OS_LINUX)
+
+#include <sys/syscall.h>
+
+#ifndef RENAME_NOREPLACE
+#define RENAME_NOREPLACE    (1 << 0)
+#endif // RENAME_NOREPLACE
+
+#endif // Q_OS_LINUX
+
+#include "transferbatch.h"
+#include "filecopyengine.h"
+#include "constants.h"
+
+
+//==============================================================================
+// Get Transfer Device - Targets Not Created Yet Use Their Parent Dir
+//==============================================================================
+quint64 transferDevice(const QString& aPath)
+{
+#if defined(Q_OS_UNIX)
+
+    // Init Path
+    QString path = aPath;
+    // Init Stat
+    struct stat st;
+
+    // Go Up Until An Existing Path Is Found
+    while (!path.isEmpty()) {
+        // Get Stat
+        if (stat(QFile::encodeName(path).constData(), &st) == 0) {
+            return (quint64)st.st_dev;
+        }
+
+        // Get Parent Path
+        QString parentPath = QFileInfo(path).absolutePath();
+
+        // Check Parent Path
+        if (parentPath == path) {
+            break;
+        }
+
+        // Set Path
+        path = parentPath;
+    }
+
+#else // Q_OS_UNIX
+
+    Q_UNUSED(aPath);
+
+#endif // Q_OS_UNIX
+
+    return 0;
+}
+
+//==============================================================================
+// Rename Without Replacing - Returns 0 Or The Error
+//==============================================================================
+static int renameNoReplace(const QString& aSource, const QString& aTarget)
+{
+#if defined(Q_OS_LINUX) && defined(SYS_renameat2)
+
+    // Rename - Fails With EEXIST Instead Of Overwriting, No Check/Rename Race
+    if (syscall(SYS_renameat2, AT_FDCWD, QFile::encodeName(aSource).constData(), AT_FDCWD, QFile::encodeName(aTarget).constData(), RENAME_NOREPLACE) == 0) {
+        return 0;
+    }
+
+    return errno;
+
+#elif defined(Q_OS_MAC) && defined(RENAME_EXCL)
+
+    // Rename - Fails With EEXIST Instead Of Overwriting
+    if (renamex_np(QFile::encodeName(aSource).constData(), QFile::encodeName(aTarget).constData(), RENAME_EXCL) == 0) {
+        return 0;
+    }
+
+    return errno;
+
+#else // Q_OS_LINUX && SYS_renameat2
+
+    Q_UNUSED(aSource);
+    Q_UNUSED(aTarget);
+
+    return -1;
+
+#endif // Q_OS_LINUX && SYS_renameat2
+}
+
+//==============================================================================
+// Constructor
+//==============================================================================
+TransferBatch::TransferBatch(const QAtomicInt* aAborted, const qint64& aThreshold, const quint64& aSourceDevice, const quint64& aTargetDevice)
+    : QObject(NULL)
+    , QRunnable()
+    , aborted(aAborted)
+    , threshold(aThreshold)
+    , sourceDevice(aSourceDevice)
+    , targetDevice(aTargetDevice)
+{
+    // Set Auto Delete - Results Are Read After The Run
+    setAutoDelete(false);
+}
+
+//==============================================================================
+// Add Item
+//==============================================================================
+void TransferBatch::addItem(const int& aIndex, const QString& aSource, const QString& aTarget)
+{
+    // Add Index
+    indexes << aIndex;
+    // Add Source
+    sources << aSource;
+    // Add Target
+    targets << aTarget;
+    // Add Size
+    sizes << 0;
+    // Add Result
+    results << -2;
+}
+
+//==============================================================================
+// Get Items Count
+//==============================================================================
+int TransferBatch::count()
+{
+    return indexes.count();
+}
+
+//==============================================================================
+// Run
+//==============================================================================
+void TransferBatch::run()
+{
+    // Go Thru Items
+    for (int i=0; i<sources.count(); ++i) {
+        // Check Aborted - Rest Is Left Not Attempted
+        if (aborted && aborted->loadAcquire()) {
+            break;
+        }
+
+        // Init Source Info
+        QFileInfo sourceInfo(sources[i]);
+
+        // Check Source - Plain Small Files Only, The Rest Is Left To The File Server
+        if (!sourceInfo.isFile() || sourceInfo.isSymLink() || sourceInfo.size() > threshold) {
+            continue;
+        }
+
+        // Init Target Info
+        QFileInfo targetInfo(targets[i]);
+
+        // Check Target - Existing Targets Need Confirmation
+        if (targetInfo.exists() || targetInfo.isSymLink()) {
+            continue;
+        }
+
+        // Check Devices - Counted Against The First Item's Devices
+        if (transferDevice(sources[i]) != sourceDevice || transferDevice(targets[i]) != targetDevice) {
+            continue;
+        }
+
+        // Set Size
+        sizes[i] = sourceInfo.size();
+
+        // Copy File - O_EXCL, A Target Created Meanwhile Is Left For The File Server To Confirm
+        results[i] = FileCopyEngine::copyFile(sources[i], targets[i], EFCMAuto, aborted, false);
+    }
+
+    // Emit Batch Finished - Must Be The Last Access, The Receiver Deletes The Batch
+    emit batchFinished();
+}
+
+//==============================================================================
+// Benchmark
+//==============================================================================
+QString TransferBatch::benchmark(const QString& aSourceDirPath, const QString& aTargetDirPath, const int& aFileCount, const int& aMaxThreads)
+{
+    // Init Report
+    QStringList report;
+
+    // Init Source Dir Path
+    QString sourceDirPath = aSourceDirPath + "/" + DEFAULT_TRANSFER_BATCH_BENCH_DIR;
+    // Init Target Dir Path - Same File System When No Target Given
+    QString targetDirPath = (aTargetDirPath.isEmpty() ? aSourceDirPath : aTargetDirPath) + "/" + DEFAULT_TRANSFER_BATCH_BENCH_DIR + "_target";
+
+    // Init Dirs Count
+    int dirsCount = (aFileCount + DEFAULT_TRANSFER_BATCH_BENCH_DIR_FILES - 1) / DEFAULT_TRANSFER_BATCH_BENCH_DIR_FILES;
+    // Init Content
+    QByteArray content(DEFAULT_FILE_COPY_BENCH_SMALL_SIZE, 'x');
+    // Init Prepared
+    bool prepared = true;
+
+    // Go Thru Dirs - Large Flat Dirs Would Measure Directory Lookups Instead
+    for (int d=0; prepared && d<dirsCount; ++d) {
+        // Init Dir Path
+        QString dirPath = sourceDirPath + QString("/d%1").arg(d);
+        // Make Dir
+        prepared = QDir().mkpath(dirPath);
+
+        // Go Thru Files
+        for (int f=0; prepared && f<DEFAULT_TRANSFER_BATCH_BENCH_DIR_FILES && d * DEFAULT_TRANSFER_BATCH_BENCH_DIR_FILES + f < aFileCount; ++f) {
+            // Init File
+            QFile file(dirPath + QString("/f%1").arg(f));
+            // Write File
+            prepared = file.open(QIODevice::WriteOnly | QIODevice::Truncate) && file.write(content) == content.size();
+        }
+    }
+
+    // Check Prepared
+    if (!prepared) {
+        // Remove Source Dir
+        QDir(sourceDirPath).removeRecursively();
+
+        return QString("Unable to write benchmark files to %1").arg(sourceDirPath);
+    }
+
+    // Add Header
+    report << QString("Batch benchmark - source: %1 - target: %2").arg(sourceDirPath).arg(targetDirPath);
+    report << QString("Files: %1 x %2 KB in %3 dirs - batch: %4 files").arg(aFileCount).arg(DEFAULT_FILE_COPY_BENCH_SMALL_SIZE >> 10).arg(dirsCount).arg(DEFAULT_TRANSFER_BATCH_MAX_FILES);
+
+    // Init Passes - 0 Is One Call Per File, Otherwise Batches On That Many Threads
+    QList<int> passes;
+    // Set Up Passes
+    passes << 0 << 1;
+
+    // Check Max Threads
+    if (aMaxThreads > 1) {
+        // Add Pass
+        passes << aMaxThreads;
+    }
+
+    // Go Thru Passes
+    foreach (int threads, passes) {
+        // Go Thru Dirs - Dirs Are Made Before Timing, Transfers Create Them Ahead As Well
+        for (int d=0; d<dirsCount; ++d) {
+            // Make Dir
+            QDir().mkpath(targetDirPath + QString("/d%1").arg(d));
+        }
+
+        // Get Source Device
+        quint64 sourceDevice = transferDevice(sourceDirPath);
+        // Get Target Device
+        quint64 targetDevice = transferDevice(targetDirPath);
+
+        // Init Batches
+        QList<TransferBatch*> batches;
+        // Init Batch
+        TransferBatch* batch = NULL;
+
+        // Go Thru Files
+        for (int i=0; i<aFileCount; ++i) {
+            // Check Batch
+            if (!batch || batch->count() >= DEFAULT_TRANSFER_BATCH_MAX_FILES) {
+                // Create Batch
+                batch = new TransferBatch(NULL, DEFAULT_TRANSFER_BATCH_THRESHOLD, sourceDevice, targetDevice);
+                // Add Batch
+                batches << batch;
+            }
+
+            // Init Relative Path
+            QString relativePath = QString("/d%1/f%2").arg(i / DEFAULT_TRANSFER_BATCH_BENCH_DIR_FILES).arg(i % DEFAULT_TRANSFER_BATCH_BENCH_DIR_FILES);
+            // Add Item
+            batch->addItem(i, sourceDirPath + relativePath, targetDirPath + relativePath);
+        }
+
+        // Init Timer
+        QElapsedTimer timer;
+        // Start Timer
+        timer.start();
+        // Get CPU Start
+        qint64 cpuStart = FileCopyEngine::cpuTime();
+
+        // Check Threads
+        if (threads == 0) {
+            // Go Thru Batches
+            foreach (TransferBatch* item, batches) {
+                // Go Thru Items
+                for (int i=0; i<item->count(); ++i) {
+                    // Copy File
+                    item->results[i] = FileCopyEngine::copyFile(item->sources[i], item->targets[i]);
+                }
+            }
+        } else {
+            // Init Pool
+            QThreadPool pool;
+            // Set Max Thread Count
+            pool.setMaxThreadCount(threads);
+
+            // Go Thru Batches
+            foreach (TransferBatch* item, batches) {
+                // Start Batch
+                pool.start(item);
+            }
+
+            // Wait For Batches
+            pool.waitForDone();
+        }
+
+        // Get Elapsed - msecs
+        qint64 elapsed = qMax((qint64)1, timer.elapsed());
+        // Get CPU - msecs
+        qint64 cpu = FileCopyEngine::cpuTime() - cpuStart;
+
+        // Init Failed
+        int failed = 0;
+
+        // Go Thru Batches
+        foreach (TransferBatch* item, batches) {
+            // Go Thru Results
+            foreach (int result, item->results) {
+                // Check Result
+                if (result < 0) {
+                    // Inc Failed
+                    failed++;
+                }
+            }
+        }
+
+        // Delete Batches
+        qDeleteAll(batches);
+
+        // Add Line
+        report << QString("%1 - %2 files/s, %3 s, cpu %4 ms%5")
+                  .arg(threads == 0 ? QString("Per file") : QString("Batches x%1").arg(threads), -14)
+                  .arg((qint64)(aFileCount - failed) * 1000 / elapsed)
+                  .arg((double)elapsed / 1000.0, 0, 'f', 1)
+                  .arg(cpu)
+                  .arg(failed > 0 ? QString(" - failed: %1").arg(failed) : QString(""));
+
+        // Clear Target Dir
+        QDir(targetDirPath).removeRecursively();
+    }
+
+    // Remove Source Dir
+    QDir(sourceDirPath).removeRecursively();
+
+    return report.join("\n");
+}
+
+//==============================================================================
+// Destructor
+//==============================================================================
+TransferBatch::~TransferBatch()
+{
+}
+
+
+
+
+
+
+
+//==============================================================================
+// Constructor
+//==============================================================================
+TransferRenameBatch::TransferRenameBatch(const QAtomicInt* aAborted)
+    : QObject(NULL)
+    , QRunnable()
+    , aborted(aAborted)
+{
+    // Set Auto Delete - Results Are Read After The Run
+    setAutoDelete(false);
+}
+
+//==============================================================================
+// Add Item
+//==============================================================================
+void TransferRenameBatch::addItem(const int& aIndex, const QString& aSource, const QString& aTarget)
+{
+    // Add Index
+    indexes << aIndex;
+    // Add Source
+    sources << aSource;
+    // Add Target
+    targets << aTarget;
+    // Add Error
+    errors << -2;
+    // Add Size
+    sizes << 0;
+    // Add Dir
+    dirs << false;
+}
+
+//==============================================================================
+// Get Items Count
+//==============================================================================
+int TransferRenameBatch::count()
+{
+    return indexes.count();
+}
+
+//==============================================================================
+// Run
+//==============================================================================
+void TransferRenameBatch::run()
+{
+    // Go Thru Items
+    for (int i=0; i<sources.count(); ++i) {
+        // Check Aborted - Rest Is Left Not Attempted
+        if (aborted && aborted->loadAcquire()) {
+            break;
+        }
+
+        // Init Source Info
+        QFileInfo sourceInfo(sources[i]);
+
+        // Check Devices - Parent Dirs, The Source May Be A Link To Another Device
+        if (transferDevice(sourceInfo.absolutePath()) != transferDevice(QFileInfo(targets[i]).absolutePath())) {
+            // Set Error
+            errors[i] = EXDEV;
+            break;
+        }
+
+        // Set Dir
+        dirs[i] = sourceInfo.isDir() || sourceInfo.isBundle();
+        // Set Size - Dirs Are Not Counted In The Overall Size
+        sizes[i] = (!dirs[i] && !sourceInfo.isSymLink()) ? sourceInfo.size() : 0;
+
+        // Rename - Conflicts And Errors Go To The File Server For Confirmation
+        errors[i] = renameNoReplace(sources[i], targets[i]);
+
+        // Check Error
+        if (errors[i] != 0) {
+            qDebug() << "TransferRenameBatch::run - source: " << sources[i] << " - target: " << targets[i] << " - error: " << errors[i];
+            break;
+        }
+    }
+
+    // Emit Batch Finished - Must Be The Last Access, The Receiver Deletes The Batch
+    emit batchFinished();
+}
+
+//==============================================================================
+// Destructor
+//==============================================================================
+TransferRenameBatch::~TransferRenameBatch()
+{
+}
@@ -0,0 +1,129 @@
+#ifndef TRANSFERBATCH_H
+#define TRANSFERBATCH_H
+
+#include <QObject>
+#include <QRunnable>
+#include <QString>
+#include <QStringList>
+#include <QList>
+#include <QAtomicInt>
+
+
+// Get Transfer Device - Targets Not Created Yet Use Their Parent Dir
+quint64 transferDevice(const QString& aPath);
+
+
+//==============================================================================
+// Transfer Batch Class - Copies Many Small Files In One Worker Run
+//==============================================================================
+class TransferBatch : public QObject, public QRunnable
+{
+    Q_OBJECT
+
+public:
+    // Constructor
+    explicit TransferBatch(const QAtomicInt* aAborted, const qint64& aThreshold, const quint64& aSourceDevice, const quint64& aTargetDevice);
+
+    // Add Item - Checked By The Worker
+    void addItem(const int& aIndex, const QString& aSource, const QString& aTarget);
+
+    // Get Items Count
+    int count();
+
+    // Benchmark - Copies A Tree Of Small Files In Batches, Returns The Report
+    static QString benchmark(const QString& aSourceDirPath, const QString& aTargetDirPath, const int& aFileCount, const int& aMaxThreads);
+
+    // Destructor
+    virtual ~TransferBatch();
+
+signals:
+
+    // Batch Finished Signal - Emitted From The Worker Thread
+    void batchFinished();
+
+protected: // From QRunnable
+
+    // Run
+    virtual void run();
+
+protected:
+    friend class TransferProgressDialog;
+
+    // Aborted
+    const QAtomicInt*   aborted;
+    // Threshold - Max File Size
+    qint64              threshold;
+    // Source Device
+    quint64             sourceDevice;
+    // Target Device
+    quint64             targetDevice;
+
+    // Queue Indexes
+    QList<int>          indexes;
+    // Sources
+    QStringList         sources;
+    // Targets
+    QStringList         targets;
+    // Sizes - Set By The Worker
+    QList<qint64>       sizes;
+
+    // Results - Copy Method Used, -1 Failed, -2 Not Attempted Or Not Eligible
+    QList<int>          results;
+};
+
+
+
+
+
+//==============================================================================
+// Transfer Rename Batch Class - Renames Same Device Moves In One Worker Run
+//==============================================================================
+class TransferRenameBatch : public QObject, public QRunnable
+{
+    Q_OBJECT
+
+public:
+    // Constructor
+    explicit TransferRenameBatch(const QAtomicInt* aAborted);
+
+    // Add Item
+    void addItem(const int& aIndex, const QString& aSource, const QString& aTarget);
+
+    // Get Items Count
+    int count();
+
+    // Destructor
+    virtual ~TransferRenameBatch();
+
+signals:
+
+    // Batch Finished Signal - Emitted From The Worker Thread
+    void batchFinished();
+
+protected: // From QRunnable
+
+    // Run - Stops At The First Item The File Server Has To Handle
+    virtual void run();
+
+protected:
+    friend class TransferProgressDialog;
+
+    // Aborted
+    const QAtomicInt*   aborted;
+
+    // Queue Indexes
+    QList<int>          indexes;
+    // Sources
+    QStringList         sources;
+    // Targets
+    QStringList         targets;
+
+    // Errors - 0 Renamed, -2 Not Attempted, Otherwise errno Or -1
+    QList<int>          errors;
+    // Sizes - 0 For Dirs And Links
+    QList<qint64>       sizes;
+    // Dirs - Not Counted In The Overall Files
+    QList<bool>         dirs;
+};
+
+#endif // TRANSFERBATCH_H
@@ -5,6 +5,7 @@
 #include <QQmlEngine>
 #include <QQmlContext>
 #include <QImageReader>
+#include <QFileDialog>
 #include <QDebug>
 
 #include <mcwinterface.h>
@@ -17,12 +18,62 @@
 #include "infodialog.h"
 #include "busyindicator.h"
 #include "remotefileutilclient.h"
+#include "dirsizescanner.h"
+#include "transferbatch.h"
+#include "filelistmodel.h"
 #include "filelistimageprovider.h"
 #include "settingscontroller.h"
 #include "utility.h"
 #include "constants.h"
 
 
+//==============================================================================
+// Constructor
+//==============================================================================
+TransferSlot::TransferSlot(RemoteFileUtilClient* aClient)
+    : client(aClient)
+    , active(false)
+    , barrier(false)
+    , queueIndex(-1)
+    , sourceDevice(0)
+    , targetDevice(0)
+    , progress(0)
+    , size(0)
+{
+}
+
+
+
+
+
+
+
+//==============================================================================
+// Constructor
+//==============================================================================
+TransferConfirmRequest::TransferConfirmRequest(const unsigned int& aID,
+                                               const QString& aOp,
+                                               const int& aCode,
+                                               const QString& aPath,
+                                               const QString& aSource,
+                                               const QString& aTarget,
+                                               const bool& aError)
+    : cID(aID)
+    , op(aOp)
+    , code(aCode)
+    , path(aPath)
+    , source(aSource)
+    , target(aTarget)
+    , error(aError)
+{
+}
+
+
+
+
+
+
+
 //==============================================================================
 // Constructor
 //==============================================================================
@@ -41,9 +92,7 @@ TransferProgressDialog::TransferProgressDialog(const QString& aOperation, QWidge
     , targetPattern("")
     , needQueue(false)
     , transferSpeedTimerID(-1)
-    , lastTransferedSize(0)
     , currTransferedSize(0)
-    , speedMeasureLastSize(0)
     , transferSpeed(0)
     , currentProgress(0)
     , currentSize(0)
@@ -51,8 +100,22 @@ TransferProgressDialog::TransferProgressDialog(const QString& aOperation, QWidge
     , overallProgress(0)
     , overallSize(0)
     , overallProgressScale(0)
+    , overallFiles(0)
+    , totalsScanner(NULL)
+    , pendingScans(0)
+    , finishedFiles(0)
+    , exportTraceButton(NULL)
     , progressRefreshTimerID(-1)
     , archiveMode(false)
+    , maxTransfers(DEFAULT_TRANSFER_THREADS)
+    , maxPerDevice(DEFAULT_TRANSFER_DEVICE_THREADS)
+    , transferAborted(false)
+    , batchAborted(0)
+    , batchThreshold(DEFAULT_TRANSFER_BATCH_THRESHOLD)
+    , transferRenameBatch(NULL)
+    , renameSkipIndex(-1)
+    , confirmActive(false)
+    , skipAllErrors(false)
 {
     qDebug() << "TransferProgressDialog::TransferProgressDialog";
 
@@ -101,29 +164,39 @@ void TransferProgressDialog::init()
     // ...
 
     // Create File Util
-    fileUtil = new RemoteFileUtilClient();
+    fileUtil = createTransferClient();
 
-    // Check File Util
-    if (fileUtil) {
-        // Connect Signals
-        connect(fileUtil, SIGNAL(clientConnectionChanged(uint,bool)), this, SLOT(clientConnectionChanged(uint,bool)));
-        connect(fileUtil, SIGNAL(clientStatusChanged(uint,int)), this, SLOT(clientStatusChanged(uint,int)));
-        connect(fileUtil, SIGNAL(fileOpStarted(uint,QString,QString,QString,QString)), this, SLOT(fileOpStarted(uint,QString,QString,QString,QString)));
-        connect(fileUtil, SIGNAL(fileOpProgress(uint,QString,QString,quint64,quint64)), this, SLOT(fileOpProgress(uint,QString,QString,quint64,quint64)));
-        connect(fileUtil, SIGNAL(fileOpSuspended(uint,QString,QString,QString,QString)), this, SLOT(fileOpSuspended(uint,QString,QString,QString,QString)));
-        connect(fileUtil, SIGNAL(fileOpResumed(uint,QString,QString,QString,QString)), this, SLOT(fileOpResumed(uint,QString,QString,QString,QString)));
-        connect(fileUtil, SIGNAL(fileOpNeedConfirm(uint,QString,int,QString,QString,QString)), this, SLOT(fileOpNeedConfirm(uint,QString,int,QString,QString,QString)));
-        connect(fileUtil, SIGNAL(fileOpAborted(uint,QString,QString,QString,QString)), this, SLOT(fileOpAborted(uint,QString,QString,QString,QString)));
-        connect(fileUtil, SIGNAL(fileOpError(uint,QString,QString,QString,QString,int)), this, SLOT(fileOpError(uint,QString,QString,QString,QString,int)));
-        connect(fileUtil, SIGNAL(fileOpSkipped(uint,QString,QString,QString,QString)), this, SLOT(fileOpSkipped(uint,QString,QString,QString,QString)));
-        connect(fileUtil, SIGNAL(fileOpFinished(uint,QString,QString,QString,QString)), this, SLOT(fileOpFinished(uint,QString,QString,QString,QString)));
-        connect(fileUtil, SIGNAL(fileOpQueueItemFound(uint,QString,QString,QString,QString)), this, SLOT(fileOpQueueItemFound(uint,QString,QString,QString,QString)));
-    }
+    // Add Main Transfer Slot
+    transferSlots << new TransferSlot(fileUtil);
+
+    // Get Max Concurrent Transfers
+    maxTransfers = qMax(1, settings->value(SETTINGS_KEY_TRANSFER_THREADS, DEFAULT_TRANSFER_THREADS).toInt());
+    // Get Max Concurrent Transfers Per Device
+    maxPerDevice = qMax(1, settings->value(SETTINGS_KEY_TRANSFER_DEVICE_THREADS, DEFAULT_TRANSFER_DEVICE_THREADS).toInt());
+    // Get Batch Threshold
+    batchThreshold = qMax((qint64)0, settings->value(SETTINGS_KEY_TRANSFER_BATCH_THRESHOLD, DEFAULT_TRANSFER_BATCH_THRESHOLD).toLongLong());
+
+    // Set Batch Pool Max Thread Count
+    batchPool.setMaxThreadCount(maxTransfers);
+
+    // Create Totals Scanner
+    totalsScanner = new DirSizeScanner(settings->value(SETTINGS_KEY_DIR_SCAN_THREADS, DEFAULT_DIR_SCAN_THREADS).toInt(),
+                                       settings->value(SETTINGS_KEY_DIR_SCAN_DEVICE_THREADS, DEFAULT_DIR_SCAN_DEVICE_THREADS).toInt());
+
+    // Connect Signals
+    connect(totalsScanner, SIGNAL(scanProgress(QString,quint64,quint64,quint64)), this, SLOT(totalsScanProgress(QString,quint64,quint64,quint64)));
+    connect(totalsScanner, SIGNAL(scanFinished(QString,quint64,quint64,quint64)), this, SLOT(totalsScanFinished(QString,quint64,quint64,quint64)));
 
     // Connect Signals
     connect(ui->buttonBox, SIGNAL(accepted()), this, SLOT(buttonBoxAccepted()));
     connect(ui->buttonBox, SIGNAL(rejected()), this, SLOT(buttonBoxRejected()));
 
+    // Add Export Trace Button - Action Role, Survives Standard Button Changes
+    exportTraceButton = ui->buttonBox->addButton(tr(DEFAULT_BUTTON_TEXT_EXPORT_TRACE), QDialogButtonBox::ActionRole);
+
+    // Connect Signals
+    connect(exportTraceButton, SIGNAL(clicked()), this, SLOT(exportTraceButtonClicked()));
+
     // Connect Signals
     connect(ui->tabWidget, SIGNAL(currentChanged(int)), this, SLOT(tabChanged(int)));
 
@@ -143,9 +216,9 @@ void TransferProgressDialog::init()
 //==============================================================================
 // Launch Progress Dialog
 //==============================================================================
-void TransferProgressDialog::launch(const QString& aSourcePath, const QString& aTargetPath, const QStringList& aSelectedFiles, const int& aOptions)
+void TransferProgressDialog::launch(const QString& aSourcePath, const QString& aTargetPath, const FileListSelection& aSelection, const int& aOptions)
 {
-    qDebug() << "TransferProgressDialog::launch - aSourcePath: " << aSourcePath << " - aTargetPath: " << aTargetPath << " - count: " << aSelectedFiles.count();
+    qDebug() << "TransferProgressDialog::launch - aSourcePath: " << aSourcePath << " - aTargetPath: " << aTargetPath << " - count: " << aSelection.count();
 
     // Set Source Path
     sourcePath = aSourcePath;
@@ -162,8 +235,8 @@ void TransferProgressDialog::launch(const QString& aSourcePath, const QString& a
     // Show
     show();
 
-    // Build Queue
-    if (buildQueue(aSourcePath, aTargetPath, aSelectedFiles)) {
+    // Build Queue - Resolves The Selected Paths One By One
+    if (buildQueue(aSourcePath, aTargetPath, aSelection)) {
         // Set Queue Index
         setQueueIndex(0);
 
@@ -302,6 +375,11 @@ void TransferProgressDialog::launch(const QString& aSource, const QString& aTarg
             overallSize += sourceInfo.size();
             // Configure Overall Progress Bar
             configureOverallProgressBar(overallSize);
+            // Inc Overall Files
+            overallFiles++;
+        } else if (sourceInfo.isDir() && !sourceInfo.isSymLink() && !archiveMode) {
+            // Scan Totals
+            scanTotals(aSource, aTarget);
         }
 
         // Check Queue Count
@@ -414,6 +492,11 @@ void TransferProgressDialog::launch(const QStringList& aSourceList, const QStrin
                         overallSize += sourceInfo.size();
                         // Configure Overall Progress Bar
                         configureOverallProgressBar(overallSize);
+                        // Inc Overall Files
+                        overallFiles++;
+                    } else if (sourceInfo.isDir() && !sourceInfo.isSymLink()) {
+                        // Scan Totals
+                        scanTotals(sourceInfo.absoluteFilePath(), targetFilePath);
                     }
 
                     // Add To Queue Model
@@ -500,13 +583,10 @@ void TransferProgressDialog::launch(const QStringList& aSourceList, const QStrin
 //==============================================================================
 // Build Queue
 //==============================================================================
-bool TransferProgressDialog::buildQueue(const QString& aSourcePath, const QString& aTargetPath, const QStringList& aSelectedFiles)
+bool TransferProgressDialog::buildQueue(const QString& aSourcePath, const QString& aTargetPath, const FileListSelection& aSelection)
 {
-    // Get Selected Files Count
-    int sfCount = aSelectedFiles.count();
-
-    // Check Selected Files Count
-    if (sfCount <= 0) {
+    // Check Selection
+    if (aSelection.isEmpty()) {
         qDebug() << "TransferProgressDialog::buildQueue - aSourcePath: " << aSourcePath << " - aTargetPath: " << aTargetPath << " - NO SELECTED FILES TO TRANSFER!";
 
         return false;
@@ -519,12 +599,14 @@ bool TransferProgressDialog::buildQueue(const QString& aSourcePath, const QStrin
         return false;
     }
 
-    qDebug() << "TransferProgressDialog::buildQueue - aSourcePath: " << aSourcePath << " - aTargetPath: " << aTargetPath << " - count: " << aSelectedFiles.count();
+    qDebug() << "TransferProgressDialog::buildQueue - aSourcePath: " << aSourcePath << " - aTargetPath: " << aTargetPath << " - count: " << aSelection.count();
 
     // Reset Overall Progress
     overallProgress = 0;
     // Reset Overall Size
     overallSize = 0;
+    // Reset Overall Files
+    overallFiles = 0;
 
 
     // Init Local Source Path
@@ -557,14 +639,14 @@ bool TransferProgressDialog::buildQueue(const QString& aSourcePath, const QStrin
         localTargetPath += "/";
     }
 
-    // Go Thru Selected Files
-    for (int i=0; i<sfCount; ++i) {
+    // Go Thru Selected Rows
+    for (int row = aSelection.first(); row >= 0; row = aSelection.next(row)) {
         // Init Source File Path
         //QString sourceFilePath = localSourcePath + aSelectedFiles[i];
-        QString sourceFilePath = aSelectedFiles[i];
+        QString sourceFilePath = aSelection.filePath(row);
         // Init Target File Path
         //QString targetFilePath = localTargetPath + aSelectedFiles[i];
-        QString targetFilePath = localTargetPath + QFileInfo(aSelectedFiles[i]).fileName();
+        QString targetFilePath = localTargetPath + QFileInfo(sourceFilePath).fileName();
 
         // Init Source File Info
         QFileInfo sourceInfo(sourceFilePath);
@@ -577,6 +659,11 @@ bool TransferProgressDialog::buildQueue(const QString& aSourcePath, const QStrin
                 overallSize += sourceInfo.size();
                 // Configure Overall Progress Bar
                 configureOverallProgressBar(overallSize);
+                // Inc Overall Files
+                overallFiles++;
+            } else if (sourceInfo.isDir() && !sourceInfo.isSymLink()) {
+                // Scan Totals
+                scanTotals(sourceInfo.absoluteFilePath(), targetFilePath);
             }
 
             // Add To Queue Model
@@ -612,58 +699,187 @@ void TransferProgressDialog::processQueue()
 {
     // Check File Util & Queue Model
     if (fileUtil && queueModel) {
-        // Check Queue Index
-        if (queueIndex >= 0 && queueIndex < queueModel->rowCount()) {
-            qDebug() << "TransferProgressDialog::processQueue - queueIndex: " << queueIndex;
+        // Check Rename Batch - Runs Alone
+        if (transferRenameBatch) {
+            return;
+        }
+
+        // Go Thru Retry Indexes - Failed Batch Items Get Their Confirms And Errors From The File Server
+        while (!transferAborted && !retryIndexes.isEmpty()) {
+            // Get Source Device
+            quint64 sourceDevice = transferDevice(queueModel->getSourceFileName(retryIndexes.first()));
+            // Get Target Device
+            quint64 targetDevice = transferDevice(queueModel->getTargetFileName(retryIndexes.first()));
+
+            // Check Device Availability
+            if (!deviceAvailable(sourceDevice, targetDevice)) {
+                return;
+            }
+
+            // Get Idle Slot
+            TransferSlot* slot = idleSlot();
+
+            // Check Slot
+            if (!slot) {
+                return;
+            }
+
+            qDebug() << "TransferProgressDialog::processQueue - retry: " << retryIndexes.first() << " - active: " << activeTransfers();
+
+            // Set Source Device
+            slot->sourceDevice = sourceDevice;
+            // Set Target Device
+            slot->targetDevice = targetDevice;
+
+            // Start Transfer
+            startTransfer(slot, retryIndexes.takeFirst(), false);
+        }
+
+        // Go Thru Queue - Start As Many Items As Slots And Devices Allow
+        while (!transferAborted && queueIndex >= 0 && queueIndex < queueModel->rowCount()) {
+            // Check Barrier - Nothing Else Runs Next To It
+            if (transferSlots[0]->active && transferSlots[0]->barrier) {
+                return;
+            }
+
+            // Check Move - Same Device Moves Are Renamed On A Worker Without A File Server Round Trip
+            if (queueModel->getOperation(queueIndex) == DEFAULT_OPERATION_MOVE_FILE && !archiveMode && activeTransfers() == 0 && retryIndexes.isEmpty() && queueIndex != renameSkipIndex) {
+                // Start Rename Batch - Queue Index Stays On It Until It Finishes
+                startRenameBatch();
+
+                return;
+            }
+
+            // Check Batchable - Small Files Are Copied On Workers Without A File Server Round Trip Each
+            if (batchable(queueIndex)) {
+                // Check Active Transfers - Batches Share The Concurrency Limit With The Clients
+                if (activeTransfers() >= maxTransfers) {
+                    return;
+                }
+
+                // Get Source Device - First Item Only, The Worker Checks The Rest
+                quint64 batchSourceDevice = transferDevice(queueModel->getSourceFileName(queueIndex));
+                // Get Target Device
+                quint64 batchTargetDevice = transferDevice(queueModel->getTargetFileName(queueIndex));
+
+                // Check Device Availability
+                if (!deviceAvailable(batchSourceDevice, batchTargetDevice)) {
+                    return;
+                }
+
+                // Start Batch - Advances The Queue Index
+                startBatch(batchSourceDevice, batchTargetDevice);
+
+                continue;
+            }
 
             // Get Source File Name
             QString sourceFileName = queueModel->getSourceFileName(queueIndex);
             // Get Target File Name
             QString targetFileName = queueModel->getTargetFileName(queueIndex);
-            // Get Operation
-            operation = queueModel->getOperation(queueIndex);
+            // Init Source Info
+            QFileInfo sourceInfo(sourceFileName);
 
-            // Check Operation - Copy
-            if (operation == DEFAULT_OPERATION_COPY_FILE) {
-                // Copy File
-                fileUtil->copyFile(sourceFileName, targetFileName);
-            // Check Operation - Rename/Move
-            } else if (operation == DEFAULT_OPERATION_MOVE_FILE) {
-                // Move File
-                fileUtil->moveFile(sourceFileName, targetFileName);
-            } else if (operation == DEFAULT_OPERATION_EXTRACT_ARCHIVE) {
-                // Extract File
-                fileUtil->extractArchive(sourceFileName, targetFileName);
-            } else {
+            // Check Item - Only Plain File Copies Run In Parallel, Dirs, Moves And Archives Expand The Queue
+            if (queueModel->getOperation(queueIndex) != DEFAULT_OPERATION_COPY_FILE || archiveMode || sourceInfo.isDir() || sourceInfo.isBundle()) {
+                // Check Active Transfers - Barrier Waits For Parallel Items And Retries To Drain
+                if (activeTransfers() > 0 || !retryIndexes.isEmpty() || !fileUtil->isConnected()) {
+                    return;
+                }
 
-                qDebug() << "TransferProgressDialog::processQueue - queueIndex: " << queueIndex << " - UNKNOWN OPERATION!!";
+                qDebug() << "TransferProgressDialog::processQueue - queueIndex: " << queueIndex;
 
+                // Start Transfer - Queue Index Stays On The Barrier Until It Finishes
+                startTransfer(transferSlots[0], queueIndex, true);
+
+                return;
             }
 
-            // Configure Buttons
-            configureButtons(QDialogButtonBox::Abort);
+            // Get Source Device
+            quint64 sourceDevice = transferDevice(sourceFileName);
+            // Get Target Device
+            quint64 targetDevice = transferDevice(targetFileName);
 
-        } else {
-            qDebug() << "TransferProgressDialog::processQueue - FINISHED!";
+            // Check Device Availability
+            if (!deviceAvailable(sourceDevice, targetDevice)) {
+                return;
+            }
 
-            // Check Close When Finished
-            if (closeWhenFinished) {
-                // Close
-                close();
-            } else {
-                // Configure Buttons
-                configureButtons(QDialogButtonBox::Close);
-                // Set Current File
-                setCurrentFileName("");
-                // Set Overall Progress Max Value
-                ui->overallProgress->setMaximum(1);
-                // Set Overall Progress Value
-                ui->overallProgress->setValue(1);
+            // Get Idle Slot
+            TransferSlot* slot = idleSlot();
+
+            // Check Slot
+            if (!slot) {
+                return;
             }
+
+            qDebug() << "TransferProgressDialog::processQueue - queueIndex: " << queueIndex << " - active: " << activeTransfers();
+
+            // Set Source Device
+            slot->sourceDevice = sourceDevice;
+            // Set Target Device
+            slot->targetDevice = targetDevice;
+
+            // Start Transfer
+            startTransfer(slot, queueIndex, false);
+
+            // Increase Current Queue Index
+            setQueueIndex(queueIndex + 1);
+        }
+
+        // Check Active Transfers, Retries & Aborted
+        if (activeTransfers() > 0 || !retryIndexes.isEmpty() || transferAborted) {
+            return;
+        }
+
+        qDebug() << "TransferProgressDialog::processQueue - FINISHED!";
+
+        // Check Close When Finished
+        if (closeWhenFinished) {
+            // Close
+            close();
+        } else {
+            // Configure Buttons
+            configureButtons(QDialogButtonBox::Close);
+            // Set Current File
+            setCurrentFileName("");
+            // Set Overall Progress Max Value
+            ui->overallProgress->setMaximum(1);
+            // Set Overall Progress Value
+            ui->overallProgress->setValue(1);
         }
     }
 }
 
+//==============================================================================
+// Start Rename Batch
+//==============================================================================
+void TransferProgressDialog::startRenameBatch()
+{
+    // Create Rename Batch
+    transferRenameBatch = new TransferRenameBatch(&batchAborted);
+
+    // Go Thru Queue - Moves Only, No File System Access Here
+    for (int i = queueIndex; i >= 0 && i < queueModel->rowCount() && transferRenameBatch->count() < DEFAULT_TRANSFER_RENAME_BATCH && queueModel->getOperation(i) == DEFAULT_OPERATION_MOVE_FILE; ++i) {
+        // Add Item
+        transferRenameBatch->addItem(i, queueModel->getSourceFileName(i), queueModel->getTargetFileName(i));
+
+        // Set Progress State Running
+        queueModel->setProgressStatus(i, ETPRunning);
+    }
+
+    qDebug() << "TransferProgressDialog::startRenameBatch - count: " << transferRenameBatch->count() << " - queueIndex: " << queueIndex;
+
+    // Connect Signals - Queued, Emitted From The Worker Thread
+    connect(transferRenameBatch, SIGNAL(batchFinished()), this, SLOT(renameBatchFinished()), Qt::QueuedConnection);
+
+    // Start Rename Batch
+    batchPool.start(transferRenameBatch);
+
+    // Configure Buttons
+    configureButtons(QDialogButtonBox::Abort);
+}
+
 //==============================================================================
 // Clear Queue
 //==============================================================================
@@ -681,6 +897,489 @@ void TransferProgressDialog::clearQueue()
     }
 }
 
+//==============================================================================
+// Create Transfer Client
+//==============================================================================
+RemoteFileUtilClient* TransferProgressDialog::createTransferClient()
+{
+    // Create Client
+    RemoteFileUtilClient* client = new RemoteFileUtilClient();
+
+    // Connect Signals
+    connect(client, SIGNAL(clientConnectionChanged(uint,bool)), this, SLOT(clientConnectionChanged(uint,bool)));
+    connect(client, SIGNAL(clientStatusChanged(uint,int)), this, SLOT(clientStatusChanged(uint,int)));
+    connect(client, SIGNAL(fileOpStarted(uint,QString,QString,QString,QString)), this, SLOT(fileOpStarted(uint,QString,QString,QString,QString)));
+    connect(client, SIGNAL(fileOpProgress(uint,QString,QString,quint64,quint64)), this, SLOT(fileOpProgress(uint,QString,QString,quint64,quint64)));
+    connect(client, SIGNAL(fileOpSuspended(uint,QString,QString,QString,QString)), this, SLOT(fileOpSuspended(uint,QString,QString,QString,QString)));
+    connect(client, SIGNAL(fileOpResumed(uint,QString,QString,QString,QString)), this, SLOT(fileOpResumed(uint,QString,QString,QString,QString)));
+    connect(client, SIGNAL(fileOpNeedConfirm(uint,QString,int,QString,QString,QString)), this, SLOT(fileOpNeedConfirm(uint,QString,int,QString,QString,QString)));
+    connect(client, SIGNAL(fileOpAborted(uint,QString,QString,QString,QString)), this, SLOT(fileOpAborted(uint,QString,QString,QString,QString)));
+    connect(client, SIGNAL(fileOpError(uint,QString,QString,QString,QString,int)), this, SLOT(fileOpError(uint,QString,QString,QString,QString,int)));
+    connect(client, SIGNAL(fileOpSkipped(uint,QString,QString,QString,QString)), this, SLOT(fileOpSkipped(uint,QString,QString,QString,QString)));
+    connect(client, SIGNAL(fileOpFinished(uint,QString,QString,QString,QString)), this, SLOT(fileOpFinished(uint,QString,QString,QString,QString)));
+    connect(client, SIGNAL(fileOpQueueItemFound(uint,QString,QString,QString,QString)), this, SLOT(fileOpQueueItemFound(uint,QString,QString,QString,QString)));
+
+    return client;
+}
+
+//==============================================================================
+// Find Transfer Slot
+//==============================================================================
+TransferSlot* TransferProgressDialog::findSlot(const unsigned int& aID)
+{
+    // Go Thru Transfer Slots
+    foreach (TransferSlot* slot, transferSlots) {
+        // Check Client ID
+        if (slot->client->getID() == aID) {
+            return slot;
+        }
+    }
+
+    return NULL;
+}
+
+//==============================================================================
+// Get Idle Transfer Slot
+//==============================================================================
+TransferSlot* TransferProgressDialog::idleSlot()
+{
+    // Init Connecting
+    int connecting = 0;
+
+    // Go Thru Transfer Slots
+    foreach (TransferSlot* slot, transferSlots) {
+        // Check Active
+        if (!slot->active) {
+            // Check If Connected
+            if (slot->client->isConnected()) {
+                return slot;
+            }
+
+            // Inc Connecting
+            connecting++;
+        }
+    }
+
+    // Check Connecting & Slots Count - Clients On Their Way Pick Up Items Once Connected
+    if (connecting > 0 || transferSlots.count() >= maxTransfers) {
+        return NULL;
+    }
+
+    // Create Transfer Client
+    RemoteFileUtilClient* client = createTransferClient();
+    // Add Transfer Slot
+    transferSlots << new TransferSlot(client);
+    // Connect
+    client->connectToFileServer();
+
+    qDebug() << "TransferProgressDialog::idleSlot - slots: " << transferSlots.count();
+
+    return NULL;
+}
+
+//==============================================================================
+// Get Active Transfers
+//==============================================================================
+int TransferProgressDialog::activeTransfers()
+{
+    // Init Active
+    int active = 0;
+
+    // Go Thru Transfer Slots
+    foreach (TransferSlot* slot, transferSlots) {
+        // Check Active
+        if (slot->active) {
+            // Inc Active
+            active++;
+        }
+    }
+
+    return active + transferBatches.count() + (transferRenameBatch ? 1 : 0);
+}
+
+//==============================================================================
+// Check If Any Transfer Client Busy
+//==============================================================================
+bool TransferProgressDialog::transferBusy()
+{
+    // Check Transfer Batches
+    if (!transferBatches.isEmpty() || transferRenameBatch) {
+        return true;
+    }
+
+    // Go Thru Transfer Slots
+    foreach (TransferSlot* slot, transferSlots) {
+        // Check Status
+        if (slot->client->getStatus() == ECSTBusy || slot->client->getStatus() == ECSTWaiting) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+//==============================================================================
+// Get Slot Queue Index
+//==============================================================================
+int TransferProgressDialog::slotIndex(TransferSlot* aSlot)
+{
+    // Check Slot - Barriers And Unknown Clients Use The Current Queue Index
+    if (!aSlot || aSlot->barrier || !aSlot->active) {
+        return queueIndex;
+    }
+
+    return aSlot->queueIndex;
+}
+
+//==============================================================================
+// Check Device Availability
+//==============================================================================
+bool TransferProgressDialog::deviceAvailable(const quint64& aSourceDevice, const quint64& aTargetDevice)
+{
+    // Check Source Device
+    if (deviceActive.value(aSourceDevice) >= maxPerDevice) {
+        return false;
+    }
+
+    // Check Target Device
+    if (aTargetDevice != aSourceDevice && deviceActive.value(aTargetDevice) >= maxPerDevice) {
+        return false;
+    }
+
+    return true;
+}
+
+//==============================================================================
+// Start Transfer
+//==============================================================================
+void TransferProgressDialog::startTransfer(TransferSlot* aSlot, const int& aIndex, const bool& aBarrier)
+{
+    // Set Active
+    aSlot->active = true;
+    // Set Barrier
+    aSlot->barrier = aBarrier;
+    // Set Queue Index
+    aSlot->queueIndex = aBarrier ? -1 : aIndex;
+    // Reset Progress
+    aSlot->progress = 0;
+    // Reset Size
+    aSlot->size = 0;
+
+    // Check Barrier
+    if (!aBarrier) {
+        // Inc Active Transfers For Source Device
+        deviceActive[aSlot->sourceDevice]++;
+
+        // Check Target Device
+        if (aSlot->targetDevice != aSlot->sourceDevice) {
+            // Inc Active Transfers For Target Device
+            deviceActive[aSlot->targetDevice]++;
+        }
+    }
+
+    // Get Source File Name
+    QString sourceFileName = queueModel->getSourceFileName(aIndex);
+    // Get Target File Name
+    QString targetFileName = queueModel->getTargetFileName(aIndex);
+    // Get Operation
+    operation = queueModel->getOperation(aIndex);
+
+    // Check Operation - Copy
+    if (operation == DEFAULT_OPERATION_COPY_FILE) {
+        // Copy File
+        aSlot->client->copyFile(sourceFileName, targetFileName);
+    // Check Operation - Rename/Move
+    } else if (operation == DEFAULT_OPERATION_MOVE_FILE) {
+        // Move File
+        aSlot->client->moveFile(sourceFileName, targetFileName);
+    } else if (operation == DEFAULT_OPERATION_EXTRACT_ARCHIVE) {
+        // Extract File
+        aSlot->client->extractArchive(sourceFileName, targetFileName);
+    } else {
+
+        qDebug() << "TransferProgressDialog::startTransfer - aIndex: " << aIndex << " - UNKNOWN OPERATION!!";
+
+    }
+
+    // Configure Buttons
+    configureButtons(QDialogButtonBox::Abort);
+}
+
+//==============================================================================
+// Transfer Done
+//==============================================================================
+void TransferProgressDialog::transferDone(TransferSlot* aSlot)
+{
+    // Check Slot
+    if (!aSlot || !aSlot->active) {
+        return;
+    }
+
+    // Check Barrier
+    if (!aSlot->barrier) {
+        // Dec Active Transfers For Source Device
+        if (--deviceActive[aSlot->sourceDevice] <= 0) {
+            // Remove Device
+            deviceActive.remove(aSlot->sourceDevice);
+        }
+
+        // Check Target Device
+        if (aSlot->targetDevice != aSlot->sourceDevice && --deviceActive[aSlot->targetDevice] <= 0) {
+            // Remove Device
+            deviceActive.remove(aSlot->targetDevice);
+        }
+    }
+
+    // Reset Active
+    aSlot->active = false;
+    // Reset Barrier
+    aSlot->barrier = false;
+    // Reset Queue Index
+    aSlot->queueIndex = -1;
+    // Reset Progress
+    aSlot->progress = 0;
+    // Reset Size
+    aSlot->size = 0;
+}
+
+//==============================================================================
+// Check If Queue Item Can Be Copied In A Batch
+//==============================================================================
+bool TransferProgressDialog::batchable(const int& aIndex)
+{
+    // Check Threshold, Operation & Archive Mode
+    if (batchThreshold <= 0 || archiveMode || queueModel->getOperation(aIndex) != DEFAULT_OPERATION_COPY_FILE) {
+        return false;
+    }
+
+    // Check Admin Mode - Only The File Server Has The Rights
+    if (fileUtil->isAdminModeOn()) {
+        return false;
+    }
+
+    // Check Source - Dirs Expand The Queue, Links Are Left To The File Server, Size And Target Are Checked By The Worker
+    return !queueModel->getIsDir(aIndex) && !queueModel->getIsLink(aIndex);
+}
+
+//==============================================================================
+// Start Batch
+//==============================================================================
+void TransferProgressDialog::startBatch(const quint64& aSourceDevice, const quint64& aTargetDevice)
+{
+    // Create Batch
+    TransferBatch* batch = new TransferBatch(&batchAborted, batchThreshold, aSourceDevice, aTargetDevice);
+
+    // Go Thru Queue - No File System Access Here, Stops At The First Item That Does Not Fit
+    while (queueIndex < queueModel->rowCount() && batch->count() < DEFAULT_TRANSFER_BATCH_MAX_FILES && batchable(queueIndex)) {
+        // Add Item
+        batch->addItem(queueIndex, queueModel->getSourceFileName(queueIndex), queueModel->getTargetFileName(queueIndex));
+
+        // Set Progress State Running
+        queueModel->setProgressStatus(queueIndex, ETPRunning);
+
+        // Increase Current Queue Index
+        setQueueIndex(queueIndex + 1);
+    }
+
+    qDebug() << "TransferProgressDialog::startBatch - count: " << batch->count() << " - queueIndex: " << queueIndex;
+
+    // Inc Active Transfers For Source Device
+    deviceActive[aSourceDevice]++;
+
+    // Check Target Device
+    if (aTargetDevice != aSourceDevice) {
+        // Inc Active Transfers For Target Device
+        deviceActive[aTargetDevice]++;
+    }
+
+    // Add Batch
+    transferBatches << batch;
+
+    // Connect Signals - Queued, Emitted From The Worker Thread
+    connect(batch, SIGNAL(batchFinished()), this, SLOT(batchFinished()), Qt::QueuedConnection);
+
+    // Set Current File Name
+    setCurrentFileName(batch->sources.first());
+
+    // Start Batch
+    batchPool.start(batch);
+
+    // Configure Buttons
+    configureButtons(QDialogButtonBox::Abort);
+
+    // Start Transfer Speed Timer
+    startTransferSpeedTimer();
+    // Start Progress Refresh Timer
+    startProgressRefreshTimer();
+}
+
+//==============================================================================
+// Update Current Progress
+//==============================================================================
+void TransferProgressDialog::updateCurrentProgress()
+{
+    // Init Progress
+    quint64 progress = 0;
+    // Init Size
+    quint64 size = 0;
+
+    // Go Thru Transfer Slots
+    foreach (TransferSlot* slot, transferSlots) {
+        // Check Active
+        if (slot->active) {
+            // Add Progress
+            progress += slot->progress;
+            // Add Size
+            size += slot->size;
+        }
+    }
+
+    // Set Current Size
+    currentSize = size;
+    // Set Current Progress
+    currentProgress = progress;
+
+    // Configure Current Progress Bar - Finished Items Leave It At 1 Of 1
+    configureCurrentProgressBar(currentSize);
+}
+
+//==============================================================================
+// Process Pending Confirm
+//==============================================================================
+void TransferProgressDialog::processPendingConfirm()
+{
+    // Check Confirm Active & Pending Confirms
+    if (confirmActive || pendingConfirms.isEmpty()) {
+        return;
+    }
+
+    // Take First Pending Confirm
+    TransferConfirmRequest* request = pendingConfirms.takeFirst();
+
+    // Check Error
+    if (request->error) {
+        // Show Error
+        fileOpError(request->cID, request->op, request->path, request->source, request->target, request->code);
+    } else {
+        // Show Confirm
+        fileOpNeedConfirm(request->cID, request->op, request->code, request->path, request->source, request->target);
+    }
+
+    // Delete Request
+    delete request;
+}
+
+//==============================================================================
+// Scan Totals
+//==============================================================================
+void TransferProgressDialog::scanTotals(const QString& aSource, const QString& aTarget)
+{
+    // Check Totals Scanner & Scanned Sizes
+    if (!totalsScanner || scannedSizes.contains(aSource)) {
+        return;
+    }
+
+    // Check Operation - Same Device Moves Are Renamed, Nothing Is Transfered
+    if (operation == DEFAULT_OPERATION_MOVE_FILE && transferDevice(QFileInfo(aSource).absolutePath()) == transferDevice(QFileInfo(aTarget).absolutePath())) {
+        return;
+    }
+
+    qDebug() << "TransferProgressDialog::scanTotals - aSource: " << aSource;
+
+    // Set Scanned Size
+    scannedSizes[aSource] = 0;
+    // Set Scanned Files
+    scannedFiles[aSource] = 0;
+    // Inc Pending Scans
+    pendingScans++;
+
+    // Scan Dir
+    totalsScanner->scanDir(aSource);
+
+    // Update Overall Title
+    updateOverallTitle();
+}
+
+//==============================================================================
+// Check If Path Is Inside A Scanned Dir
+//==============================================================================
+bool TransferProgressDialog::totalsScanned(const QString& aPath)
+{
+    // Go Thru Scanned Dirs - Only The Selected Dirs, Usually A Handful
+    foreach (const QString& dirPath, scannedSizes.keys()) {
+        // Check Path
+        if (aPath.startsWith(dirPath) && (aPath.length() == dirPath.length() || aPath[dirPath.length()] == '/' || dirPath.endsWith("/"))) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+//==============================================================================
+// Update Overall Progress Title
+//==============================================================================
+void TransferProgressDialog::updateOverallTitle()
+{
+    // Check Overall Files
+    if (overallFiles == 0) {
+        // Set Title
+        ui->overallProgressTitleLabel->setText(tr(DEFAULT_LABEL_OVERALL_PROGRESS_TITLE));
+
+        return;
+    }
+
+    // Init Title
+    QString title = tr(DEFAULT_LABEL_OVERALL_PROGRESS_TOTALS).arg(overallFiles).arg(formattedSize(overallSize));
+
+    // Check Pending Scans
+    if (pendingScans > 0) {
+        // Add Scanning
+        title += tr(DEFAULT_LABEL_OVERALL_PROGRESS_SCANNING);
+    }
+
+    // Set Title
+    ui->overallProgressTitleLabel->setText(title);
+}
+
+//==============================================================================
+// Update Telemetry View
+//==============================================================================
+void TransferProgressDialog::updateTelemetryView()
+{
+    // Set Rates
+    ui->throughputGraph->setRates(telemetry.history(DEFAULT_TRANSFER_GRAPH_SAMPLES));
+
+    // Init Text
+    QString text = tr(DEFAULT_TRANSFER_TELEMETRY_TEXT_TEMPLATE).arg(formattedSize(telemetry.bytesPerSecond())).arg(telemetry.filesPerSecond(), 0, 'f', 1);
+
+    // Get Time Left
+    qint64 timeLeft = telemetry.timeLeft();
+
+    // Check Time Left
+    if (timeLeft >= 0) {
+        // Add ETA
+        text += tr(DEFAULT_TRANSFER_TELEMETRY_ETA_TEMPLATE).arg(timeLeft / 3600).arg((timeLeft / 60) % 60, 2, 10, QChar('0')).arg(timeLeft % 60, 2, 10, QChar('0'));
+    }
+
+    // Set Text
+    ui->throughputGraph->setText(text);
+
+    // Get Device Rates
+    QHash<quint64, quint64> deviceRates = telemetry.deviceRates();
+    // Init Tool Tip Lines
+    QStringList toolTipLines;
+
+    // Go Thru Device Rates
+    foreach (quint64 device, deviceRates.keys()) {
+        // Add Line
+        toolTipLines << tr(DEFAULT_TRANSFER_TELEMETRY_DEVICE_TEMPLATE).arg(device).arg(formattedSize(deviceRates.value(device)));
+    }
+
+    // Set Tool Tip
+    ui->throughputGraph->setToolTip(toolTipLines.join("\n"));
+}
+
 //==============================================================================
 // Restore UI
 //==============================================================================
@@ -722,6 +1421,48 @@ void TransferProgressDialog::restoreUI()
     overallProgress = 0;
     // Reset Overall Size
     overallSize = 0;
+    // Reset Overall Files
+    overallFiles = 0;
+
+    // Check Totals Scanner
+    if (totalsScanner) {
+        // Abort Totals Scans
+        totalsScanner->abort();
+    }
+
+    // Clear Scanned Sizes
+    scannedSizes.clear();
+    // Clear Scanned Files
+    scannedFiles.clear();
+    // Reset Pending Scans
+    pendingScans = 0;
+
+    // Update Overall Title
+    updateOverallTitle();
+
+    // Reset Current Transfered Size
+    currTransferedSize = 0;
+    // Reset Finished Files
+    finishedFiles = 0;
+    // Clear Device Bytes
+    deviceBytes.clear();
+    // Reset Telemetry
+    telemetry.reset();
+    // Clear Throughput Graph
+    ui->throughputGraph->clear();
+
+    // Reset Transfer Aborted
+    transferAborted = false;
+    // Reset Batch Aborted
+    batchAborted.storeRelease(0);
+    // Clear Retry Indexes
+    retryIndexes.clear();
+    // Reset Rename Skip Index
+    renameSkipIndex = -1;
+    // Reset Skip All Errors
+    skipAllErrors = false;
+    // Clear Yes/No To All Responses
+    confirmAllResponses.clear();
 
     // Chekc ARchive Mode
     if (archiveMode) {
@@ -827,8 +1568,6 @@ void TransferProgressDialog::startTransferSpeedTimer()
     // Check Transfer Speed Timer ID
     if (transferSpeedTimerID == -1) {
         //qDebug() <<"TransferProgressDialog::startTransferSpeedTimer";
-        // Reset Last Speed Measure
-        speedMeasureLastSize = 0;
         // Start Timer
         transferSpeedTimerID = startTimer(DEFAULT_ONE_SEC, Qt::PreciseTimer);
     }
@@ -846,8 +1585,6 @@ void TransferProgressDialog::stopTransferSpeedTimer()
         killTimer(transferSpeedTimerID);
         // Reset Timer ID
         transferSpeedTimerID = -1;
-        // Reset Last Speed Measure
-        speedMeasureLastSize = 0;
     }
 }
 
@@ -926,8 +1663,11 @@ void TransferProgressDialog::suspend()
     if (fileUtil) {
         qDebug() << "TransferProgressDialog::suspend";
 
-        // Suspend
-        fileUtil->suspend();
+        // Go Thru Transfer Slots
+        foreach (TransferSlot* slot, transferSlots) {
+            // Suspend
+            slot->client->suspend();
+        }
 
         // Stop Transfer Speed Timer
         stopTransferSpeedTimer();
@@ -945,8 +1685,11 @@ void TransferProgressDialog::resume()
     if (fileUtil) {
         qDebug() << "TransferProgressDialog::resume";
 
-        // Resume
-        fileUtil->resume();
+        // Go Thru Transfer Slots
+        foreach (TransferSlot* slot, transferSlots) {
+            // Resume
+            slot->client->resume();
+        }
 
         // Start Transfer Speed Timer
         startTransferSpeedTimer();
@@ -960,12 +1703,39 @@ void TransferProgressDialog::resume()
 //==============================================================================
 void TransferProgressDialog::abort()
 {
-    // Check File Util
-    if (fileUtil && (fileUtil->getStatus() == ECSTBusy || fileUtil->getStatus() == ECSTSuspended || fileUtil->getStatus() == ECSTWaiting)) {
-        qDebug() << "TransferProgressDialog::abort";
+    // Set Transfer Aborted - No New Items Are Started
+    transferAborted = true;
+    // Set Batch Aborted - Running Batches Stop After The Current File
+    batchAborted.storeRelease(1);
+
+    // Go Thru Retry Indexes - Batch Items Left Running By The Batch
+    foreach (int retryIndex, retryIndexes) {
+        // Set Progress State Idle
+        queueModel->setProgressStatus(retryIndex, ETPIdle);
+    }
+
+    // Clear Retry Indexes
+    retryIndexes.clear();
+
+    // Check Totals Scanner
+    if (totalsScanner && pendingScans > 0) {
+        // Abort Totals Scans
+        totalsScanner->abort();
+        // Reset Pending Scans
+        pendingScans = 0;
+        // Update Overall Title
+        updateOverallTitle();
+    }
+
+    // Go Thru Transfer Slots
+    foreach (TransferSlot* slot, transferSlots) {
+        // Check Status
+        if (slot->client->getStatus() == ECSTBusy || slot->client->getStatus() == ECSTSuspended || slot->client->getStatus() == ECSTWaiting) {
+            qDebug() << "TransferProgressDialog::abort - cID: " << slot->client->getID();
 
-        // Abort
-        fileUtil->abort();
+            // Abort
+            slot->client->abort();
+        }
     }
 
     // Stop Transfer Speed Timer
@@ -1108,6 +1878,19 @@ void TransferProgressDialog::clientConnectionChanged(const unsigned int& aID, co
 
     // Check If Connected
     if (aConnected) {
+        // Find Slot
+        TransferSlot* slot = findSlot(aID);
+
+        // Check Slot - Additional Clients Just Pick Up Queue Items
+        if (slot && slot->client != fileUtil) {
+            // Clear Options
+            slot->client->clearFileTransferOptions();
+            // Process Queue
+            QTimer::singleShot(1, this, SLOT(processQueue()));
+
+            return;
+        }
+
         // Check File Util
         if (fileUtil) {
             // Clear Options
@@ -1161,22 +1944,25 @@ void TransferProgressDialog::fileOpStarted(const unsigned int& aID,
         // Set Current File Name
         setCurrentFileName(aSource);
 
-        // Init File Info
-        QFileInfo sourceInfo(aSource);
+        // Find Slot
+        TransferSlot* slot = findSlot(aID);
 
-        // Reset Last Transfer Size
-        lastTransferedSize = 0;
-        // Reset Current Transfer Size
-        currTransferedSize = 0;
+        // Check Slot
+        if (slot) {
+            // Reset Slot Progress
+            slot->progress = 0;
+            // Set Slot Size
+            slot->size = QFileInfo(aSource).size();
 
-        // Set Current Progress
-        //setCurrentProgress(0, 0);
-        currentProgress = 0;
-        // Set Current Size
-        currentSize = sourceInfo.size();
+            // Check Barrier - Expanded Items Run On The Main Client, Device Is Not Known Up Front
+            if (slot->barrier) {
+                // Set Target Device - Telemetry Only
+                slot->targetDevice = transferDevice(aTarget);
+            }
+        }
 
-        // Configure Current Progress Bar
-        configureCurrentProgressBar(currentSize);
+        // Update Current Progress
+        updateCurrentProgress();
 
         // Start Transfer Speed Timer
         startTransferSpeedTimer();
@@ -1199,30 +1985,38 @@ void TransferProgressDialog::fileOpProgress(const unsigned int& aID,
                                             const quint64& aCurrProgress,
                                             const quint64& aCurrTotal)
 {
-    Q_UNUSED(aID);
     Q_UNUSED(aOp);
     Q_UNUSED(aCurrFilePath);
     Q_UNUSED(aCurrTotal);
 
     //qDebug() << "DeleteProgressDialog::fileOpProgress - aID: " << aID << " - aOp: " << aOp << " - aCurrFilePath: " << aCurrFilePath << " - aCurrProgress: " << aCurrProgress << " - aCurrTotal: " << aCurrTotal;
 
+    // Find Slot
+    TransferSlot* slot = findSlot(aID);
+
+    // Check Slot
+    if (!slot) {
+        return;
+    }
+
     // Check Queue Model
     if (queueModel) {
         // Set Done
-        queueModel->setProgressStatus(queueIndex, ETPRunning);
+        queueModel->setProgressStatus(slotIndex(slot), ETPRunning);
     }
 
-    // Set Current Progress
-    currentProgress = aCurrProgress;
-
-    // Set Current Transfer Size
-    currTransferedSize = aCurrProgress;
-
-    // Calculate Overall Progress
-    overallProgress += (currTransferedSize - lastTransferedSize);
+    // Check Progress
+    if (aCurrProgress > slot->progress) {
+        // Calculate Overall Progress
+        overallProgress += (aCurrProgress - slot->progress);
+        // Set Current Transfer Size - Accumulated Over All Clients For The Speed Meter
+        currTransferedSize += (aCurrProgress - slot->progress);
+        // Add Device Bytes
+        deviceBytes[slot->targetDevice] += (aCurrProgress - slot->progress);
+    }
 
-    // Set Last Transfer Size
-    lastTransferedSize = currTransferedSize;
+    // Set Slot Progress
+    slot->progress = aCurrProgress;
 
     // Set Current Progress
     //setCurrentProgress(currentProgress, currentSize);
@@ -1281,31 +2075,50 @@ void TransferProgressDialog::fileOpSkipped(const unsigned int& aID,
 
     // Check Operation - Copy/Move File
     if (aOp == DEFAULT_OPERATION_COPY_FILE || aOp == DEFAULT_OPERATION_MOVE_FILE) {
+        // Find Slot
+        TransferSlot* slot = findSlot(aID);
+        // Get Barrier - Unknown Clients Are Treated As The Main One
+        bool barrier = !slot || !slot->active || slot->barrier;
+
         // Check Queue Model
         if (queueModel) {
             // Set Progress State Skipped
-            queueModel->setProgressStatus(queueIndex, ETPSkipped);
+            queueModel->setProgressStatus(slotIndex(slot), ETPSkipped);
         }
 
-        // Init Source Info
-        QFileInfo sourceInfo(aSource);
-
-        // Configure Current Progress
-        configureCurrentProgressBar(1);
-        // Set Current Progress
-        setCurrentProgress(1);
+        // Get Source Size
+        quint64 sourceSize = QFileInfo(aSource).size();
+        // Get Done Size - Already Counted By Progress
+        quint64 doneSize = slot ? slot->progress : 0;
 
         // Calculate Overall Progress
-        overallProgress += sourceInfo.size();
+        overallProgress += sourceSize > doneSize ? sourceSize - doneSize : 0;
 
-        // Set Last Transfer Size
-        lastTransferedSize = 0;
+        // Check Source - Dirs Are Not Counted In The Overall Files
+        if (!QFileInfo(aSource).isDir()) {
+            // Inc Finished Files
+            finishedFiles++;
+        }
 
         // Set Overall Progress
         setOverallProgress(overallProgress);
 
-        // Increase Current Queue Index
-        setQueueIndex(queueIndex + 1);
+        // Transfer Done
+        transferDone(barrier ? transferSlots[0] : slot);
+
+        // Check Active Transfers
+        if (activeTransfers() == 0) {
+            // Configure Current Progress
+            configureCurrentProgressBar(1);
+            // Set Current Progress
+            setCurrentProgress(1);
+        }
+
+        // Check Barrier
+        if (barrier) {
+            // Increase Current Queue Index
+            setQueueIndex(queueIndex + 1);
+        }
     }
 
     // ...
@@ -1327,7 +2140,45 @@ void TransferProgressDialog::fileOpFinished(const unsigned int& aID,
 
     qDebug() << "TransferProgressDialog::fileOpFinished - aID: " << aID << " - aOp: " << aOp << " - aPath: " << aPath << " - aSource: " << aSource << " - aTarget: " << aTarget;
 
-    // ...
+    // Find Slot
+    TransferSlot* slot = findSlot(aID);
+
+    // Check Slot - Parallel Items Finish On Their Own Queue Index
+    if (slot && slot->active && !slot->barrier) {
+        // Check Queue Model
+        if (queueModel) {
+            // Set Progress State Finished
+            queueModel->setProgressStatus(slot->queueIndex, ETPFinished);
+        }
+
+        // Check Progress - The Last Chunk May Not Be Reported
+        if (slot->size > slot->progress) {
+            // Calculate Overall Progress
+            overallProgress += (slot->size - slot->progress);
+        }
+
+        // Inc Finished Files
+        finishedFiles++;
+
+        // Transfer Done
+        transferDone(slot);
+
+        // Check Active Transfers
+        if (activeTransfers() == 0) {
+            // Configure Current Progress
+            configureCurrentProgressBar(1);
+            // Set Current Progress
+            setCurrentProgress(1);
+
+            // Update Label
+            ui->currentFileTitleLabel->setText(tr(DEFAULT_LABEL_CURRENT_FILE_TITLE_FINISHED));
+        }
+
+        // Process Queue
+        processQueue();
+
+        return;
+    }
 
     // Check Operation - Copy
     if (operation == DEFAULT_OPERATION_COPY_FILE) {
@@ -1341,6 +2192,12 @@ void TransferProgressDialog::fileOpFinished(const unsigned int& aID,
                 queueModel->setProgressStatus(queueIndex, ETPFinished);
             }
 
+            // Check Target - Dirs Are Not Counted In The Overall Files
+            if (aOp == DEFAULT_OPERATION_COPY_FILE && !QFileInfo(aTarget).isDir()) {
+                // Inc Finished Files
+                finishedFiles++;
+            }
+
             // Configure Current Progress
             configureCurrentProgressBar(1);
             // Set Current Progress
@@ -1349,6 +2206,9 @@ void TransferProgressDialog::fileOpFinished(const unsigned int& aID,
             // Update Label
             ui->currentFileTitleLabel->setText(tr(DEFAULT_LABEL_CURRENT_FILE_TITLE_FINISHED));
 
+            // Transfer Done
+            transferDone(transferSlots[0]);
+
             // Increase Current Queue Index
             setQueueIndex(queueIndex + 1);
 
@@ -1380,6 +2240,12 @@ void TransferProgressDialog::fileOpFinished(const unsigned int& aID,
                 queueModel->setProgressStatus(queueIndex, ETPFinished);
             }
 
+            // Check Target - Dirs Are Not Counted In The Overall Files
+            if (!QFileInfo(aTarget).isDir()) {
+                // Inc Finished Files
+                finishedFiles++;
+            }
+
             // Configure Current Progress
             configureCurrentProgressBar(1);
             // Set Current Progress
@@ -1407,12 +2273,18 @@ void TransferProgressDialog::fileOpFinished(const unsigned int& aID,
             return;
         }
 
+        // Transfer Done
+        transferDone(transferSlots[0]);
+
         // Process Queue
         processQueue();
 
     // Check Operation - List Dir
     } else if (operation == DEFAULT_OPERATION_EXTRACT_ARCHIVE) {
 
+        // Transfer Done
+        transferDone(transferSlots[0]);
+
         // Increase Current Queue Index
         setQueueIndex(queueIndex + 1);
 
@@ -1440,7 +2312,16 @@ void TransferProgressDialog::fileOpAborted(const unsigned int& aID,
 
     qDebug() << "TransferProgressDialog::fileOpAborted - aID: " << aID << " - aOp: " << aOp << " - aSource: " << aSource << " - aTarget: " << aTarget;
 
-    // ...
+    // Transfer Done
+    transferDone(findSlot(aID));
+
+    // Abort - Other Clients Stop Too
+    abort();
+
+    // Check Active Transfers - Wait For The Rest To Abort
+    if (activeTransfers() > 0) {
+        return;
+    }
 
     // Check Close When Finished
     if (closeWhenFinished) {
@@ -1462,11 +2343,31 @@ void TransferProgressDialog::fileOpError(const unsigned int& aID,
                                          const QString& aTarget,
                                          const int& aError)
 {
-    Q_UNUSED(aPath);
-
     qDebug() << "TransferProgressDialog::fileOpError - aID: " << aID << " - aOp: " << aOp << " - aSource: " << aSource << " - aTarget: " << aTarget << " - aError: " << aError;
 
-    // ...
+    // Find Slot
+    TransferSlot* slot = findSlot(aID);
+    // Get Client
+    RemoteFileUtilClient* client = slot ? slot->client : fileUtil;
+
+    // Check Skip All Errors - Another Client Already Got Skip All
+    if (client && skipAllErrors && aError != DEFAULT_ERROR_NOT_ENOUGH_SPACE) {
+        // Send User Response
+        client->sendUserResponse(DEFAULT_CONFIRM_SKIPALL, aPath);
+
+        return;
+    }
+
+    // Check Confirm Active - Wait For The Shown One
+    if (confirmActive) {
+        // Add Pending Confirm
+        pendingConfirms << new TransferConfirmRequest(aID, aOp, aError, aPath, aSource, aTarget, true);
+
+        return;
+    }
+
+    // Set Confirm Active
+    confirmActive = true;
 
     // Init Confirmation Dialog
     ConfirmDialog confirmDialog;
@@ -1519,10 +2420,16 @@ void TransferProgressDialog::fileOpError(const unsigned int& aID,
             // Get Action Index
             int actionIndex = confirmDialog.getActionIndex();
 
-            // Check File Util
-            if (fileUtil) {
+            // Check Action Index
+            if (actionIndex == DEFAULT_CONFIRM_SKIPALL) {
+                // Set Skip All Errors
+                skipAllErrors = true;
+            }
+
+            // Check Client
+            if (client) {
                 // Send User Response
-                fileUtil->sendUserResponse(actionIndex == -1 ? DEFAULT_CONFIRM_ABORT : actionIndex, confirmDialog.getPath());
+                client->sendUserResponse(actionIndex == -1 ? DEFAULT_CONFIRM_ABORT : actionIndex, confirmDialog.getPath());
             }
         } break;
 
@@ -1540,14 +2447,23 @@ void TransferProgressDialog::fileOpError(const unsigned int& aID,
             // Exec Confirm Dialog
             confirmDialog.exec();
 
-            // Check File Util
-            if (fileUtil) {
+            // Check Client
+            if (client) {
                 // Send User Response
-                fileUtil->sendUserResponse(DEFAULT_CONFIRM_ABORT, "");
+                client->sendUserResponse(DEFAULT_CONFIRM_ABORT, "");
             }
 
         } break;
     }
+
+    // Reset Confirm Active
+    confirmActive = false;
+
+    // Check Pending Confirms
+    if (!pendingConfirms.isEmpty()) {
+        // Process Pending Confirm
+        QTimer::singleShot(0, this, SLOT(processPendingConfirm()));
+    }
 }
 
 //==============================================================================
@@ -1560,10 +2476,33 @@ void TransferProgressDialog::fileOpNeedConfirm(const unsigned int& aID,
                                                const QString& aSource,
                                                const QString& aTarget)
 {
-    Q_UNUSED(aPath);
 
     qDebug() << "TransferProgressDialog::fileOpNeedConfirm - aID: " << aID << " - aOp: " << aOp << " - aSource: " << aSource << " - aTarget: " << aTarget << " - aCode: " << aCode;
 
+    // Find Slot
+    TransferSlot* slot = findSlot(aID);
+    // Get Client
+    RemoteFileUtilClient* client = slot ? slot->client : fileUtil;
+
+    // Check Yes/No To All Responses - Another Client Already Got One For This Code
+    if (client && confirmAllResponses.contains(aCode)) {
+        // Send User Response
+        client->sendUserResponse(confirmAllResponses.value(aCode), aPath);
+
+        return;
+    }
+
+    // Check Confirm Active - Wait For The Shown One
+    if (confirmActive) {
+        // Add Pending Confirm
+        pendingConfirms << new TransferConfirmRequest(aID, aOp, aCode, aPath, aSource, aTarget, false);
+
+        return;
+    }
+
+    // Set Confirm Active
+    confirmActive = true;
+
     // Init Confirmation Dialog
     ConfirmDialog confirmDialog;
 
@@ -1606,14 +2545,26 @@ void TransferProgressDialog::fileOpNeedConfirm(const unsigned int& aID,
     // Get Action Index
     int actionIndex = confirmDialog.getActionIndex();
 
-    // Check File Util
-    if (fileUtil) {
+    // Check Action Index
+    if (actionIndex == DEFAULT_CONFIRM_YESALL || actionIndex == DEFAULT_CONFIRM_NOALL) {
+        // Set Yes/No To All Response
+        confirmAllResponses[aCode] = actionIndex;
+    }
+
+    // Check Client
+    if (client) {
         // Send User Response
-        fileUtil->sendUserResponse(actionIndex == -1 ? DEFAULT_CONFIRM_ABORT : actionIndex, confirmDialog.getPath());
+        client->sendUserResponse(actionIndex == -1 ? DEFAULT_CONFIRM_ABORT : actionIndex, confirmDialog.getPath());
     }
 
-    // ...
+    // Reset Confirm Active
+    confirmActive = false;
 
+    // Check Pending Confirms
+    if (!pendingConfirms.isEmpty()) {
+        // Process Pending Confirm
+        QTimer::singleShot(0, this, SLOT(processPendingConfirm()));
+    }
 }
 
 //==============================================================================
@@ -1644,12 +2595,14 @@ void TransferProgressDialog::fileOpQueueItemFound(const unsigned int& aID,
         // Init Source File Info
         QFileInfo sourceInfo(aSource);
 
-        // Check If Is Dir
-        if (!sourceInfo.isDir() && !sourceInfo.isBundle() && !sourceInfo.isSymLink()) {
+        // Check If Is Dir - Items Inside Scanned Dirs Are Already Counted
+        if (!sourceInfo.isDir() && !sourceInfo.isBundle() && !sourceInfo.isSymLink() && !totalsScanned(aSource)) {
             // Add Size To Overall Size
             overallSize += sourceInfo.size();
             // Configure Overall Progress Bar
             configureOverallProgressBar(overallSize);
+            // Inc Overall Files
+            overallFiles++;
         }
     }
 }
@@ -1699,10 +2652,250 @@ void TransferProgressDialog::dirListItemFound(const unsigned int& aID,
                 overallSize += sourceInfo.size();
                 // Configure Overall Progress Bar
                 configureOverallProgressBar(overallSize);
+                // Inc Overall Files
+                overallFiles++;
+            } else if (sourceInfo.isDir() && !sourceInfo.isSymLink()) {
+                // Scan Totals
+                scanTotals(sourceInfo.absoluteFilePath(), targetFilePath + targetFileName);
+            }
+
+        }
+    }
+}
+
+//==============================================================================
+// Rename Batch Finished Slot
+//==============================================================================
+void TransferProgressDialog::renameBatchFinished()
+{
+    // Get Rename Batch
+    TransferRenameBatch* batch = qobject_cast<TransferRenameBatch*>(sender());
+
+    // Check Rename Batch
+    if (!batch || batch != transferRenameBatch) {
+        return;
+    }
+
+    // Reset Rename Batch
+    transferRenameBatch = NULL;
+
+    // Init Renamed
+    int renamed = 0;
+
+    // Go Thru Items - Renamed Ones Come First
+    for (int i=0; i<batch->count(); ++i) {
+        // Check Error
+        if (batch->errors[i] == 0) {
+            // Set Progress State Finished
+            queueModel->setProgressStatus(batch->indexes[i], ETPFinished);
+
+            // Inc Overall Progress
+            overallProgress += batch->sizes[i];
+
+            // Check Dir - Dirs Are Not Counted In The Overall Files
+            if (!batch->dirs[i]) {
+                // Inc Finished Files
+                finishedFiles++;
+            }
+
+            // Increase Current Queue Index
+            setQueueIndex(batch->indexes[i] + 1);
+
+            // Inc Renamed
+            renamed++;
+
+        } else {
+            // Set Progress State Idle - The File Server Or The Next Batch Takes Over
+            queueModel->setProgressStatus(batch->indexes[i], ETPIdle);
+
+            // Check Error - Attempted Items Go To The File Server For Confirmation
+            if (batch->errors[i] != -2) {
+                // Set Rename Skip Index
+                renameSkipIndex = batch->indexes[i];
             }
+        }
+    }
+
+    qDebug() << "TransferProgressDialog::renameBatchFinished - renamed: " << renamed << " - queueIndex: " << queueIndex;
+
+    // Delete Rename Batch - The Worker May Still Be Returning From Run
+    batch->deleteLater();
+
+    // Set Overall Progress
+    setOverallProgress(overallProgress);
+
+    // Check Aborted
+    if (transferAborted) {
+        // Check Active Transfers - Wait For The Rest To Abort
+        if (activeTransfers() > 0) {
+            return;
+        }
+
+        // Check Close When Finished
+        if (closeWhenFinished) {
+            // Close
+            close();
+        } else {
+            // Configure Buttons
+            configureButtons(QDialogButtonBox::Close);
+        }
+
+        return;
+    }
+
+    // Process Queue
+    processQueue();
+}
+
+//==============================================================================
+// Batch Finished Slot
+//==============================================================================
+void TransferProgressDialog::batchFinished()
+{
+    // Get Batch
+    TransferBatch* batch = qobject_cast<TransferBatch*>(sender());
+
+    // Check Batch
+    if (!batch || !transferBatches.contains(batch)) {
+        return;
+    }
+
+    // Remove Batch
+    transferBatches.removeAll(batch);
+
+    // Init Copied
+    int copied = 0;
+
+    // Go Thru Items
+    for (int i=0; i<batch->count(); ++i) {
+        // Check Result
+        if (batch->results[i] >= 0) {
+            // Set Progress State Finished
+            queueModel->setProgressStatus(batch->indexes[i], ETPFinished);
+
+            // Inc Overall Progress
+            overallProgress += batch->sizes[i];
+            // Inc Current Transfer Size
+            currTransferedSize += batch->sizes[i];
+            // Add Device Bytes
+            deviceBytes[batch->targetDevice] += batch->sizes[i];
+            // Inc Finished Files
+            finishedFiles++;
+
+            // Inc Copied
+            copied++;
+
+        // Check Aborted - Failed And Ineligible Items Go To The File Server
+        } else if (!transferAborted) {
+            // Add Retry Index
+            retryIndexes << batch->indexes[i];
+        } else {
+            // Set Progress State Idle
+            queueModel->setProgressStatus(batch->indexes[i], ETPIdle);
+        }
+    }
+
+    qDebug() << "TransferProgressDialog::batchFinished - copied: " << copied << " - retries: " << retryIndexes.count();
+
+    // Dec Active Transfers For Source Device
+    if (--deviceActive[batch->sourceDevice] <= 0) {
+        // Remove Device
+        deviceActive.remove(batch->sourceDevice);
+    }
+
+    // Check Target Device
+    if (batch->targetDevice != batch->sourceDevice && --deviceActive[batch->targetDevice] <= 0) {
+        // Remove Device
+        deviceActive.remove(batch->targetDevice);
+    }
+
+    // Delete Batch - The Worker May Still Be Returning From Run
+    batch->deleteLater();
+
+    // Set Overall Progress
+    setOverallProgress(overallProgress);
+
+    // Check Active Transfers
+    if (activeTransfers() == 0) {
+        // Configure Current Progress
+        configureCurrentProgressBar(1);
+        // Set Current Progress
+        setCurrentProgress(1);
+
+        // Update Label
+        ui->currentFileTitleLabel->setText(tr(DEFAULT_LABEL_CURRENT_FILE_TITLE_FINISHED));
+    }
+
+    // Check Aborted
+    if (transferAborted) {
+        // Check Active Transfers - Wait For The Rest To Abort
+        if (activeTransfers() > 0) {
+            return;
+        }
 
+        // Check Close When Finished
+        if (closeWhenFinished) {
+            // Close
+            close();
+        } else {
+            // Configure Buttons
+            configureButtons(QDialogButtonBox::Close);
         }
+
+        return;
+    }
+
+    // Process Queue
+    processQueue();
+}
+
+//==============================================================================
+// Totals Scan Progress Slot
+//==============================================================================
+void TransferProgressDialog::totalsScanProgress(const QString& aDirPath, const quint64& aNumDirs, const quint64& aNumFiles, const quint64& aScannedSize)
+{
+    Q_UNUSED(aNumDirs);
+
+    // Check Scanned Sizes
+    if (!scannedSizes.contains(aDirPath)) {
+        return;
+    }
+
+    // Add New Size To Overall Size - Progress Reports Running Totals
+    overallSize += aScannedSize - scannedSizes.value(aDirPath);
+    // Add New Files To Overall Files
+    overallFiles += aNumFiles - scannedFiles.value(aDirPath);
+
+    // Set Scanned Size
+    scannedSizes[aDirPath] = aScannedSize;
+    // Set Scanned Files
+    scannedFiles[aDirPath] = aNumFiles;
+
+    // Configure Overall Progress Bar
+    configureOverallProgressBar(overallSize);
+    // Set Overall Progress
+    setOverallProgress(overallProgress);
+    // Update Overall Title
+    updateOverallTitle();
+}
+
+//==============================================================================
+// Totals Scan Finished Slot
+//==============================================================================
+void TransferProgressDialog::totalsScanFinished(const QString& aDirPath, const quint64& aNumDirs, const quint64& aNumFiles, const quint64& aScannedSize)
+{
+    qDebug() << "TransferProgressDialog::totalsScanFinished - aDirPath: " << aDirPath << " - aNumDirs: " << aNumDirs << " - aNumFiles: " << aNumFiles << " - aScannedSize: " << aScannedSize;
+
+    // Check Scanned Sizes
+    if (!scannedSizes.contains(aDirPath)) {
+        return;
     }
+
+    // Dec Pending Scans
+    pendingScans = qMax(0, pendingScans - 1);
+
+    // Totals Scan Progress - Final Totals
+    totalsScanProgress(aDirPath, aNumDirs, aNumFiles, aScannedSize);
 }
 
 //==============================================================================
@@ -1731,6 +2924,35 @@ void TransferProgressDialog::buttonBoxRejected()
     //emit dialogClosed(this);
 }
 
+//==============================================================================
+// Export Trace Button Clicked Slot
+//==============================================================================
+void TransferProgressDialog::exportTraceButtonClicked()
+{
+    // Check Samples Count
+    if (telemetry.samplesCount() <= 0) {
+        return;
+    }
+
+    // Get File Path
+    QString filePath = QFileDialog::getSaveFileName(this, tr(DEFAULT_TITLE_EXPORT_TRACE), QDir::homePath() + "/" + DEFAULT_TRANSFER_TRACE_FILENAME, DEFAULT_TRANSFER_TRACE_FILTER);
+
+    // Check File Path
+    if (filePath.isEmpty()) {
+        return;
+    }
+
+    qDebug() << "TransferProgressDialog::exportTraceButtonClicked - filePath: " << filePath;
+
+    // Write CSV
+    if (!telemetry.writeCSV(filePath)) {
+        // Init Info Dialog
+        InfoDialog infoDialog(tr(DEFAULT_WARNING_TEXT_CANT_EXPORT_TRACE), EIDTWarning);
+        // Exec Info Dialog
+        infoDialog.exec();
+    }
+}
+
 //==============================================================================
 // Tab Changed Slot
 //==============================================================================
@@ -1774,13 +2996,20 @@ void TransferProgressDialog::timerEvent(QTimerEvent* aEvent)
         // Check Timer ID
         if (aEvent->timerId() == transferSpeedTimerID) {
 
-            // Check File Util Client
-            if (fileUtil && (fileUtil->getStatus() == ECSTBusy || fileUtil->getStatus() == ECSTWaiting)) {
-                //qDebug() << "TransferProgressDialog::timerEvent - currTransferedSize: " << currTransferedSize << " - diff: " << (currTransferedSize - speedMeasureLastSize);
-                // Set Current File name Label
-                setCurrentFileName(currentFileName, currTransferedSize - speedMeasureLastSize);
-                // Set Speed Measure Last Size
-                speedMeasureLastSize = currTransferedSize;
+            // Check Transfer Clients
+            if (transferBusy()) {
+                // Add Telemetry Sample - Rates Come From Running Totals, Not From Tick Deltas
+                telemetry.addSample(currTransferedSize,
+                                    finishedFiles,
+                                    deviceBytes,
+                                    overallSize > overallProgress ? overallSize - overallProgress : 0,
+                                    overallFiles > finishedFiles ? overallFiles - finishedFiles : 0);
+
+                //qDebug() << "TransferProgressDialog::timerEvent - currTransferedSize: " << currTransferedSize << " - speed: " << telemetry.bytesPerSecond();
+                // Set Current File name Label - Smoothed Speed
+                setCurrentFileName(currentFileName, (int)qMin(telemetry.bytesPerSecond(), (quint64)INT_MAX));
+                // Update Telemetry View
+                updateTelemetryView();
             } else {
                 // Set Current File Name
                 setCurrentFileName("");
@@ -1791,12 +3020,16 @@ void TransferProgressDialog::timerEvent(QTimerEvent* aEvent)
             // ...
 
         } else if (aEvent->timerId() == progressRefreshTimerID) {
-            // Check File Util Client
-            if (fileUtil && (fileUtil->getStatus() == ECSTBusy || fileUtil->getStatus() == ECSTWaiting)) {
+            // Check Transfer Clients
+            if (transferBusy()) {
+                // Update Current Progress
+                updateCurrentProgress();
                 // Set Current Progress
                 setCurrentProgress(currentProgress);
                 // Set Overall Progress
                 setOverallProgress(overallProgress);
+                // Update Overall Title
+                updateOverallTitle();
             } else {
                 // Stop Progress Refresh Timer
                 stopProgressRefreshTimer();
@@ -1837,6 +3070,15 @@ TransferProgressDialog::~TransferProgressDialog()
     // Save Settings
     saveSettings();
 
+    // Check Totals Scanner
+    if (totalsScanner) {
+        // Abort Totals Scans
+        totalsScanner->abort();
+        // Delete Totals Scanner
+        delete totalsScanner;
+        totalsScanner = NULL;
+    }
+
     // Check Settings
     if (settings) {
         // Release
@@ -1848,6 +3090,21 @@ TransferProgressDialog::~TransferProgressDialog()
     // Abort
     abort();
 
+    // Wait For Batches - They Stop After The Current File
+    batchPool.waitForDone();
+
+    // Delete Transfer Batches
+    qDeleteAll(transferBatches);
+    // Clear Transfer Batches
+    transferBatches.clear();
+
+    // Check Rename Batch
+    if (transferRenameBatch) {
+        // Delete Rename Batch
+        delete transferRenameBatch;
+        transferRenameBatch = NULL;
+    }
+
     // Clear Queue
     clearQueue();
 
@@ -1864,6 +3121,24 @@ TransferProgressDialog::~TransferProgressDialog()
         queueModel = NULL;
     }
 
+    // Go Thru Transfer Slots - Additional Clients
+    for (int i=1; i<transferSlots.count(); ++i) {
+        // Close
+        transferSlots[i]->client->close();
+        // Delete Client
+        delete transferSlots[i]->client;
+    }
+
+    // Delete Transfer Slots
+    qDeleteAll(transferSlots);
+    // Clear Transfer Slots
+    transferSlots.clear();
+
+    // Delete Pending Confirms
+    qDeleteAll(pendingConfirms);
+    // Clear Pending Confirms
+    pendingConfirms.clear();
+
     // Check File Util
     if (fileUtil) {
         // Close
@@ -9,6 +9,13 @@
 #include <QTimerEvent>
 #include <QDialogButtonBox>
 #include <QImage>
+#include <QHash>
+#include <QList>
+#include <QPushButton>
+#include <QThreadPool>
+#include <QAtomicInt>
+
+#include "transfertelemetry.h"
 
 namespace Ui {
 class TransferProgressDialog;
@@ -17,7 +24,81 @@ class TransferProgressDialog;
 class SettingsController;
 class TransferProgressModel;
 class RemoteFileUtilClient;
+class DirSizeScanner;
 class ConfirmDialog;
+class TransferBatch;
+class TransferRenameBatch;
+class FileListSelection;
+
+
+//==============================================================================
+// Transfer Slot Class - One Queue Item Running On One File Util Client
+//==============================================================================
+class TransferSlot
+{
+public:
+    // Constructor
+    explicit TransferSlot(RemoteFileUtilClient* aClient);
+
+protected:
+    friend class TransferProgressDialog;
+
+    // File Util Client
+    RemoteFileUtilClient*   client;
+    // Active
+    bool                    active;
+    // Barrier - Runs Alone, Queue Index Stays On It
+    bool                    barrier;
+    // Queue Index - Parallel Items Only
+    int                     queueIndex;
+    // Source Device
+    quint64                 sourceDevice;
+    // Target Device
+    quint64                 targetDevice;
+    // Progress
+    quint64                 progress;
+    // Size
+    quint64                 size;
+};
+
+
+
+
+//==============================================================================
+// Transfer Confirm Request Class - Waits While Another Confirm Is Shown
+//==============================================================================
+class TransferConfirmRequest
+{
+public:
+    // Constructor
+    explicit TransferConfirmRequest(const unsigned int& aID,
+                                    const QString& aOp,
+                                    const int& aCode,
+                                    const QString& aPath,
+                                    const QString& aSource,
+                                    const QString& aTarget,
+                                    const bool& aError);
+
+protected:
+    friend class TransferProgressDialog;
+
+    // Client ID
+    unsigned int            cID;
+    // Operation
+    QString                 op;
+    // Code
+    int                     code;
+    // Path
+    QString                 path;
+    // Source
+    QString                 source;
+    // Target
+    QString                 target;
+    // Error
+    bool                    error;
+};
+
+
 
 
 //==============================================================================
@@ -48,7 +129,7 @@ public:
     void setOverallProgress(const quint64& aProgress);
 
     // Launch Progress Dialog
-    void launch(const QString& aSourcePath, const QString& aTargetPath, const QStringList& aSelectedFiles, const int& aOptions = 0);
+    void launch(const QString& aSourcePath, const QString& aTargetPath, const FileListSelection& aSelection, const int& aOptions = 0);
     // Launch Progress Dialog
     void launch(const QString& aSourcePath, const QString& aTargetPath, const QString& aSourcePattern = "*.*", const QString& aTargetPattern = "", const int& aOptions = 0);
     // Launch Progress Dialog
@@ -105,14 +186,56 @@ protected slots:
     void init();
 
     // Build Queue
-    bool buildQueue(const QString& aSourcePath, const QString& aTargetPath, const QStringList& aSelectedFiles);
+    bool buildQueue(const QString& aSourcePath, const QString& aTargetPath, const FileListSelection& aSelection);
     // Build Queue
     bool buildQueue(const QString& aSourcePath, const QString& aTargetPath, const QString& aSourcePattern, const QString& aTargetPattern);
     // Process Queue
     void processQueue();
+    // Start Rename Batch - Same Device Moves, Renamed On A Worker
+    void startRenameBatch();
     // Clear Queue
     void clearQueue();
 
+    // Create Transfer Client
+    RemoteFileUtilClient* createTransferClient();
+    // Find Transfer Slot
+    TransferSlot* findSlot(const unsigned int& aID);
+    // Get Idle Transfer Slot - Adds A Client Below The Limit, Null While It Connects
+    TransferSlot* idleSlot();
+    // Get Active Transfers
+    int activeTransfers();
+    // Check If Any Transfer Client Busy
+    bool transferBusy();
+    // Get Slot Queue Index
+    int slotIndex(TransferSlot* aSlot);
+
+    // Check Device Availability - Per Device Concurrency Limit
+    bool deviceAvailable(const quint64& aSourceDevice, const quint64& aTargetDevice);
+    // Start Transfer
+    void startTransfer(TransferSlot* aSlot, const int& aIndex, const bool& aBarrier);
+    // Transfer Done - Releases The Slot And Its Devices
+    void transferDone(TransferSlot* aSlot);
+
+    // Check If Queue Item Can Be Copied In A Batch
+    bool batchable(const int& aIndex);
+    // Start Batch - Consecutive Small Files On The Same Devices
+    void startBatch(const quint64& aSourceDevice, const quint64& aTargetDevice);
+
+    // Update Current Progress - Aggregated Over Active Transfers
+    void updateCurrentProgress();
+
+    // Scan Totals - Dir Sizes Stream Into The Overall Size While Transfers Run
+    void scanTotals(const QString& aSource, const QString& aTarget);
+    // Check If Path Is Inside A Scanned Dir - Its Size Is Already Counted
+    bool totalsScanned(const QString& aPath);
+    // Update Overall Progress Title
+    void updateOverallTitle();
+    // Update Telemetry View - Graph, Rates And ETA
+    void updateTelemetryView();
+
+    // Process Pending Confirm
+    void processPendingConfirm();
+
     // Restore UI
     void restoreUI();
     // Save Settings
@@ -230,12 +353,28 @@ protected slots: // For RemoteFileUtilClient
                           const QString& aPath,
                           const QString& aFileName);
 
+protected slots: // For TransferBatch
+
+    // Rename Batch Finished Slot
+    void renameBatchFinished();
+    // Batch Finished Slot
+    void batchFinished();
+
+protected slots: // For DirSizeScanner
+
+    // Totals Scan Progress Slot
+    void totalsScanProgress(const QString& aDirPath, const quint64& aNumDirs, const quint64& aNumFiles, const quint64& aScannedSize);
+    // Totals Scan Finished Slot
+    void totalsScanFinished(const QString& aDirPath, const quint64& aNumDirs, const quint64& aNumFiles, const quint64& aScannedSize);
+
 protected slots: // For QDialogButtonBox
 
     // Button Box Accepted Slot
     void buttonBoxAccepted();
     // Button Box Rejected Slot
     void buttonBoxRejected();
+    // Export Trace Button Clicked Slot
+    void exportTraceButtonClicked();
 
 protected slots: // For QTabWidget
 
@@ -295,12 +434,8 @@ private:
 
     // Speed Timer ID
     int                             transferSpeedTimerID;
-    // Last Transfered Size
-    quint64                         lastTransferedSize;
     // Current Transfered Size
     quint64                         currTransferedSize;
-    // Speed Measure Last Size
-    quint64                         speedMeasureLastSize;
     // Transfer Speed
     int                             transferSpeed;
 
@@ -319,6 +454,26 @@ private:
 
     // Overall Progress Scale
     int                             overallProgressScale;
+    // Overall Files
+    quint64                         overallFiles;
+
+    // Totals Scanner
+    DirSizeScanner*                 totalsScanner;
+    // Scanned Sizes By Dir - Last Reported
+    QHash<QString, quint64>         scannedSizes;
+    // Scanned Files By Dir - Last Reported
+    QHash<QString, quint64>         scannedFiles;
+    // Pending Totals Scans
+    int                             pendingScans;
+
+    // Finished Files - Skipped And Renamed Ones Included
+    quint64                         finishedFiles;
+    // Transfered Bytes By Target Device
+    QHash<quint64, quint64>         deviceBytes;
+    // Telemetry
+    TransferTelemetry               telemetry;
+    // Export Trace Button
+    QPushButton*                    exportTraceButton;
 
     // Progress Refresh Timer ID
     int                             progressRefreshTimerID;
@@ -328,6 +483,41 @@ private:
 
     // Supported Image Formats For Queue List
     QStringList                     supportedImageFormats;
+
+    // Transfer Slots - First One Uses The Main File Util Client
+    QList<TransferSlot*>            transferSlots;
+    // Max Concurrent Transfers
+    int                             maxTransfers;
+    // Max Concurrent Transfers Per Device
+    int                             maxPerDevice;
+    // Active Transfers Per Device
+    QHash<quint64, int>             deviceActive;
+    // Transfer Aborted - No New Items Are Started
+    bool                            transferAborted;
+
+    // Transfer Batches - Running Or Queued On The Batch Pool
+    QList<TransferBatch*>           transferBatches;
+    // Batch Pool
+    QThreadPool                     batchPool;
+    // Batch Aborted - Read By The Batch Workers
+    QAtomicInt                      batchAborted;
+    // Batch Threshold - Max File Size, 0 Disables Batching
+    qint64                          batchThreshold;
+    // Retry Indexes - Failed Batch Items Left For The File Server
+    QList<int>                      retryIndexes;
+    // Rename Batch - Runs Alone
+    TransferRenameBatch*            transferRenameBatch;
+    // Rename Skip Index - Failed Rename, Left For The File Server
+    int                             renameSkipIndex;
+
+    // Confirm Active - One Confirm Dialog At A Time
+    bool                            confirmActive;
+    // Pending Confirms
+    QList<TransferConfirmRequest*>  pendingConfirms;
+    // Yes/No To All Responses By Code - Shared By All Clients
+    QHash<int, int>                 confirmAllResponses;
+    // Skip All Errors - Shared By All Clients
+    bool                            skipAllErrors;
 };
 
 #endif // TRANSFERPROGRESSDIALOG_H
@@ -176,6 +176,32 @@ TransferProgressStatus TransferProgressModel::getProgressStatus(const int& aInde
     return (TransferProgressStatus)(data(createIndex(aIndex, ERIDStatus - Qt::UserRole - 1)).toInt());
 }
 
+//==============================================================================
+// Get Is Dir
+//==============================================================================
+bool TransferProgressModel::getIsDir(const int& aIndex)
+{
+    // Check Index
+    if (aIndex >= 0 && aIndex < rowCount()) {
+        return items[aIndex]->fileIsDir;
+    }
+
+    return false;
+}
+
+//==============================================================================
+// Get Is Link
+//==============================================================================
+bool TransferProgressModel::getIsLink(const int& aIndex)
+{
+    // Check Index
+    if (aIndex >= 0 && aIndex < rowCount()) {
+        return items[aIndex]->fileIsLink;
+    }
+
+    return false;
+}
+
 //==============================================================================
 // Get Source
 //==============================================================================
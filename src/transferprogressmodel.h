@@ -81,6 +81,10 @@ public:
     QString getTargetFileName(const int& aIndex);
     // Get Progress Status
     TransferProgressStatus getProgressStatus(const int& aIndex);
+    // Get Is Dir - Stated When The Item Was Added
+    bool getIsDir(const int& aIndex);
+    // Get Is Link - Stated When The Item Was Added
+    bool getIsLink(const int& aIndex);
 
     // Get Source
     QString getSource(const int& aIndex);
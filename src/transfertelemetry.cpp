@@ -0,0 +1,296 @@
+#include <QFile>
+#include <QTextStream>
+#include <QStringList>
+#include <QDebug>
+
+#include <algorithm>
+
+#include "transfertelemetry.h"
+#include "constants.h"
+
+
+//==============================================================================
+// Constructor
+//==============================================================================
+TransferTelemetrySample::TransferTelemetrySample()
+    : elapsed(0)
+    , bytes(0)
+    , files(0)
+    , rate(0)
+    , avgRate(0)
+    , fileRate(0.0)
+    , eta(-1)
+{
+}
+
+
+
+
+
+
+
+//==============================================================================
+// Constructor
+//==============================================================================
+TransferTelemetry::TransferTelemetry()
+    : lastElapsed(0)
+    , lastBytes(0)
+    , avgRate(0.0)
+    , avgFileRate(0.0)
+    , eta(-1)
+{
+    // Reset
+    reset();
+}
+
+//==============================================================================
+// Reset
+//==============================================================================
+void TransferTelemetry::reset()
+{
+    // Restart Timer
+    timer.start();
+
+    // Reset Last Elapsed
+    lastElapsed = 0;
+    // Reset Last Bytes
+    lastBytes = 0;
+    // Clear Last Bytes By Device
+    lastDeviceBytes.clear();
+
+    // Reset Averages
+    avgRate = 0.0;
+    avgFileRate = 0.0;
+    // Clear Device Averages
+    avgDeviceRates.clear();
+    // Reset ETA
+    eta = -1;
+
+    // Clear Samples
+    samples.clear();
+}
+
+//==============================================================================
+// Add Sample
+//==============================================================================
+void TransferTelemetry::addSample(const quint64& aBytes, const quint64& aFiles, const QHash<quint64, quint64>& aDeviceBytes, const quint64& aRemainingBytes, const quint64& aRemainingFiles)
+{
+    // Get Elapsed
+    qint64 elapsed = timer.elapsed();
+    // Get Interval
+    qint64 interval = elapsed - lastElapsed;
+
+    // Check Interval
+    if (interval <= 0) {
+        return;
+    }
+
+    // Check First Sample
+    bool first = samples.isEmpty();
+
+    // Init Sample
+    TransferTelemetrySample sample;
+
+    // Set Elapsed
+    sample.elapsed = elapsed;
+    // Set Bytes
+    sample.bytes = aBytes;
+    // Set Files
+    sample.files = aFiles;
+    // Set Rate - Measured Over The Real Interval, Timer Ticks Drift
+    sample.rate = aBytes > lastBytes ? (aBytes - lastBytes) * 1000 / interval : 0;
+
+    // Update Average
+    avgRate = smooth(avgRate, sample.rate, first);
+    // Set Files Rate - Since Start, Seconds Without A Finished File Don't Drag It Down
+    avgFileRate = (double)aFiles * 1000.0 / elapsed;
+
+    // Go Thru Device Bytes
+    foreach (quint64 device, aDeviceBytes.keys()) {
+        // Get Device Bytes
+        quint64 deviceBytes = aDeviceBytes.value(device);
+        // Get Last Device Bytes
+        quint64 lastBytesOnDevice = lastDeviceBytes.value(device);
+
+        // Update Device Average
+        avgDeviceRates[device] = smooth(avgDeviceRates.value(device), deviceBytes > lastBytesOnDevice ? (double)(deviceBytes - lastBytesOnDevice) * 1000.0 / interval : 0.0, !avgDeviceRates.contains(device));
+        // Set Device Rate
+        sample.deviceRates[device] = (quint64)avgDeviceRates[device];
+    }
+
+    // Init Bytes Time - secs Spent Moving Bytes At The Current Rate
+    double bytesTime = avgRate >= 1.0 ? (double)aBytes / avgRate : 0.0;
+    // Init Per File Overhead - Elapsed Time The Byte Rate Does Not Explain, 0 Until A File Finished
+    double fileOverhead = aFiles > 0 ? qMax(0.0, (double)elapsed / 1000.0 - bytesTime) / aFiles : 0.0;
+
+    // Check Remaining
+    if (aRemainingBytes == 0 && aRemainingFiles == 0) {
+        // Set ETA
+        eta = 0;
+    } else if (avgRate >= 1.0 || aFiles > 0) {
+        // Set ETA - Remaining Bytes At The Current Rate Plus The Per File Overhead Of The Remaining Files
+        eta = (qint64)((avgRate >= 1.0 ? (double)aRemainingBytes / avgRate : 0.0) + (double)aRemainingFiles * fileOverhead);
+    } else {
+        // Reset ETA - Nothing Measured Yet
+        eta = -1;
+    }
+
+    // Set Smoothed Values
+    sample.avgRate = (quint64)avgRate;
+    sample.fileRate = avgFileRate;
+    sample.eta = eta;
+
+    // Add Sample
+    samples << sample;
+
+    // Set Last Values
+    lastElapsed = elapsed;
+    lastBytes = aBytes;
+    lastDeviceBytes = aDeviceBytes;
+}
+
+//==============================================================================
+// Get Smoothed Bytes Per Second
+//==============================================================================
+quint64 TransferTelemetry::bytesPerSecond()
+{
+    return (quint64)avgRate;
+}
+
+//==============================================================================
+// Get Files Per Second
+//==============================================================================
+double TransferTelemetry::filesPerSecond()
+{
+    return avgFileRate;
+}
+
+//==============================================================================
+// Get Estimated Time Left
+//==============================================================================
+qint64 TransferTelemetry::timeLeft()
+{
+    return eta;
+}
+
+//==============================================================================
+// Get Smoothed Bytes Per Second By Target Device
+//==============================================================================
+QHash<quint64, quint64> TransferTelemetry::deviceRates()
+{
+    // Init Rates
+    QHash<quint64, quint64> rates;
+
+    // Go Thru Device Averages
+    foreach (quint64 device, avgDeviceRates.keys()) {
+        // Set Rate
+        rates[device] = (quint64)avgDeviceRates.value(device);
+    }
+
+    return rates;
+}
+
+//==============================================================================
+// Get Rate History
+//==============================================================================
+QList<quint64> TransferTelemetry::history(const int& aCount)
+{
+    // Init History
+    QList<quint64> rates;
+
+    // Go Thru Last Samples
+    for (int i = qMax(0, samples.count() - aCount); i < samples.count(); ++i) {
+        // Add Rate
+        rates << samples[i].rate;
+    }
+
+    return rates;
+}
+
+//==============================================================================
+// Get Samples Count
+//==============================================================================
+int TransferTelemetry::samplesCount()
+{
+    return samples.count();
+}
+
+//==============================================================================
+// Write Trace As CSV
+//==============================================================================
+bool TransferTelemetry::writeCSV(const QString& aFilePath)
+{
+    // Init File
+    QFile file(aFilePath);
+
+    // Open File
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate | QIODevice::Text)) {
+        qDebug() << "TransferTelemetry::writeCSV - aFilePath: " << aFilePath << " - error: " << file.errorString();
+        return false;
+    }
+
+    // Init Devices
+    QList<quint64> devices = avgDeviceRates.keys();
+    // Sort Devices - Stable Column Order
+    std::sort(devices.begin(), devices.end());
+
+    // Init Header
+    QStringList header;
+    // Set Up Header
+    header << "elapsed_ms" << "bytes" << "files" << "bytes_per_sec" << "avg_bytes_per_sec" << "files_per_sec" << "eta_sec";
+
+    // Go Thru Devices
+    foreach (quint64 device, devices) {
+        // Add Device Column
+        header << QString("device_%1_bytes_per_sec").arg(device);
+    }
+
+    // Init Text Stream
+    QTextStream stream(&file);
+
+    // Write Header
+    stream << header.join(",") << "\n";
+
+    // Go Thru Samples
+    foreach (const TransferTelemetrySample& sample, samples) {
+        // Init Row
+        QStringList row;
+        // Set Up Row
+        row << QString::number(sample.elapsed) << QString::number(sample.bytes) << QString::number(sample.files) << QString::number(sample.rate)
+            << QString::number(sample.avgRate) << QString::number(sample.fileRate, 'f', 2) << QString::number(sample.eta);
+
+        // Go Thru Devices
+        foreach (quint64 device, devices) {
+            // Add Device Rate
+            row << QString::number(sample.deviceRates.value(device));
+        }
+
+        // Write Row
+        stream << row.join(",") << "\n";
+    }
+
+    // Flush
+    stream.flush();
+
+    return file.error() == QFile::NoError;
+}
+
+//==============================================================================
+// Get Smoothed Value
+//==============================================================================
+double TransferTelemetry::smooth(const double& aAverage, const double& aValue, const bool& aFirst)
+{
+    // Check First - Seed With The First Measurement Instead Of Ramping Up From 0
+    if (aFirst) {
+        return aValue;
+    }
+
+    return aAverage + (aValue - aAverage) * DEFAULT_TRANSFER_SPEED_EWMA_WEIGHT;
+}
+
+//==============================================================================
+// Destructor
+//==============================================================================
+TransferTelemetry::~TransferTelemetry()
+{
+}
@@ -0,0 +1,105 @@
+#ifndef TRANSFERTELEMETRY_H
+#define TRANSFERTELEMETRY_H
+
+#include <QString>
+#include <QList>
+#include <QHash>
+#include <QElapsedTimer>
+
+
+//==============================================================================
+// Transfer Telemetry Sample Class - One Speed Timer Tick
+//==============================================================================
+class TransferTelemetrySample
+{
+public:
+    // Constructor
+    explicit TransferTelemetrySample();
+
+    // Elapsed Since Start - msecs
+    qint64                      elapsed;
+    // Transfered Bytes - Running Total
+    quint64                     bytes;
+    // Finished Files - Running Total
+    quint64                     files;
+    // Bytes Per Second Since The Previous Sample
+    quint64                     rate;
+    // Smoothed Bytes Per Second
+    quint64                     avgRate;
+    // Files Per Second Since Start
+    double                      fileRate;
+    // Estimated Time Left - secs, -1 If Unknown
+    qint64                      eta;
+    // Smoothed Bytes Per Second By Target Device
+    QHash<quint64, quint64>     deviceRates;
+};
+
+
+
+
+//==============================================================================
+// Transfer Telemetry Class - EWMA Throughput, ETA And Trace
+//==============================================================================
+class TransferTelemetry
+{
+public:
+    // Constructor
+    explicit TransferTelemetry();
+
+    // Reset
+    void reset();
+
+    // Add Sample - Running Totals, Rates Come From The Time Since The Previous Sample
+    void addSample(const quint64& aBytes, const quint64& aFiles, const QHash<quint64, quint64>& aDeviceBytes, const quint64& aRemainingBytes, const quint64& aRemainingFiles);
+
+    // Get Smoothed Bytes Per Second
+    quint64 bytesPerSecond();
+    // Get Files Per Second Since Start
+    double filesPerSecond();
+    // Get Estimated Time Left - secs, -1 If Unknown
+    qint64 timeLeft();
+    // Get Smoothed Bytes Per Second By Target Device
+    QHash<quint64, quint64> deviceRates();
+
+    // Get Rate History - Last Samples, Oldest First
+    QList<quint64> history(const int& aCount);
+
+    // Get Samples Count
+    int samplesCount();
+
+    // Write Trace As CSV
+    bool writeCSV(const QString& aFilePath);
+
+    // Destructor
+    virtual ~TransferTelemetry();
+
+protected:
+
+    // Get Smoothed Value
+    static double smooth(const double& aAverage, const double& aValue, const bool& aFirst);
+
+protected:
+
+    // Timer
+    QElapsedTimer                   timer;
+    // Last Sample Elapsed - msecs
+    qint64                          lastElapsed;
+    // Last Bytes
+    quint64                         lastBytes;
+    // Last Bytes By Target Device
+    QHash<quint64, quint64>         lastDeviceBytes;
+
+    // Smoothed Bytes Per Second
+    double                          avgRate;
+    // Files Per Second Since Start
+    double                          avgFileRate;
+    // Smoothed Bytes Per Second By Target Device
+    QHash<quint64, double>          avgDeviceRates;
+    // Estimated Time Left - secs
+    qint64                          eta;
+
+    // Samples - Whole Transfer, One Per Second
+    QList<TransferTelemetrySample>  samples;
+};
+
+#endif // TRANSFERTELEMETRY_H
@@ -0,0 +1,426 @@
+#include <QDir>
+#include <QFileInfo>
+#include <QDateTime>
+#include <QDebug>
+
+#include "treemapdialog.h"
+#include "ui_treemapdialog.h"
+#include "dirsizescanner.h"
+#include "dirsizeindex.h"
+#include "settingscontroller.h"
+#include "utility.h"
+#include "constants.h"
+
+
+//==============================================================================
+// Constructor
+//==============================================================================
+TreeMapDialog::TreeMapDialog(QWidget* aParent)
+    : QDialog(aParent)
+    , ui(new Ui::TreeMapDialog)
+    , scanner(NULL)
+    , index(DirSizeIndex::getInstance())
+    , listing(false)
+    , dirModified(0)
+    , ownSize(0)
+    , ownFiles(0)
+{
+    // Setup UI
+    ui->setupUi(this);
+
+    // Get Settings
+    SettingsController* settings = SettingsController::getInstance();
+
+    // Create Scanner
+    scanner = new DirSizeScanner(settings->value(SETTINGS_KEY_DIR_SCAN_THREADS, DEFAULT_DIR_SCAN_THREADS).toInt(),
+                                 settings->value(SETTINGS_KEY_DIR_SCAN_DEVICE_THREADS, DEFAULT_DIR_SCAN_DEVICE_THREADS).toInt());
+
+    // Release Settings
+    settings->release();
+
+    // Set List Pool Max Thread Count - One Listing At A Time
+    listPool.setMaxThreadCount(1);
+
+    // Connect Signals
+    connect(scanner, SIGNAL(scanProgress(QString,quint64,quint64,quint64)), this, SLOT(scanProgress(QString,quint64,quint64,quint64)));
+    connect(scanner, SIGNAL(scanFinished(QString,quint64,quint64,quint64)), this, SLOT(scanFinished(QString,quint64,quint64,quint64)));
+    connect(ui->treeMap, SIGNAL(itemActivated(QString)), this, SLOT(setDirPath(QString)));
+}
+
+//==============================================================================
+// Get Dir Path
+//==============================================================================
+QString TreeMapDialog::getDirPath()
+{
+    return dirPath;
+}
+
+//==============================================================================
+// Set Dir Path
+//==============================================================================
+void TreeMapDialog::setDirPath(const QString& aDirPath)
+{
+    qDebug() << "TreeMapDialog::setDirPath - aDirPath: " << aDirPath;
+
+    // Clear Watched Dirs - Running Scans Go On And Store Their Trees In The Index
+    scanner->clearWatches();
+
+    // Set Dir Path
+    dirPath = aDirPath;
+    // Reset Dir Modified
+    dirModified = 0;
+    // Reset Own Size
+    ownSize = 0;
+    // Reset Own Files
+    ownFiles = 0;
+    // Clear Sub Dirs
+    subDirs.clear();
+    // Clear Pending Dirs
+    pendingDirs.clear();
+    // Set Listing
+    listing = true;
+
+    // Clear Tree Map
+    ui->treeMap->clear();
+
+    // Set Path Label
+    ui->pathLabel->setText(dirPath);
+    // Set Up Button Enabled
+    ui->upButton->setEnabled(!QDir(dirPath).isRoot());
+
+    // Create List Task
+    TreeMapListTask* listTask = new TreeMapListTask(dirPath);
+    // Connect Signal
+    connect(listTask, SIGNAL(listFinished()), this, SLOT(listFinished()), Qt::QueuedConnection);
+    // Add To List Tasks
+    listTasks << listTask;
+    // Start List Task
+    listPool.start(listTask);
+
+    // Update Status
+    updateStatus();
+}
+
+//==============================================================================
+// List Finished Slot
+//==============================================================================
+void TreeMapDialog::listFinished()
+{
+    // Get List Task
+    TreeMapListTask* listTask = qobject_cast<TreeMapListTask*>(sender());
+
+    // Check List Task
+    if (!listTask) {
+        return;
+    }
+
+    // Remove From List Tasks
+    listTasks.removeAll(listTask);
+    // Delete List Task Later
+    listTask->deleteLater();
+
+    // Check Dir Path - Listings Of Dirs Left Meanwhile Are Dropped
+    if (!listing || listTask->dirPath != dirPath || !isVisible()) {
+        return;
+    }
+
+    qDebug() << "TreeMapDialog::listFinished - dirPath: " << dirPath << " - entries: " << listTask->entries.count();
+
+    // Reset Listing
+    listing = false;
+    // Set Dir Modified
+    dirModified = listTask->dirModified;
+
+    // Go Thru Entries
+    foreach (const TreeMapListEntry& entry, listTask->entries) {
+        // Check If Dir
+        if (entry.isDir) {
+            // Add Sub Dir
+            subDirs[entry.path] = entry.modified;
+
+            // Init Index Item
+            DirSizeIndexItem indexItem;
+
+            // Lookup Index - Drill Down Into Scanned Trees Needs No Scan
+            if (index->lookup(entry.path, entry.modified, indexItem)) {
+                // Add Item
+                ui->treeMap->addItem(entry.name, entry.path, indexItem.size, true, false);
+            } else {
+                // Add Item
+                ui->treeMap->addItem(entry.name, entry.path, 0, true, true);
+                // Add Pending Dir
+                pendingDirs << entry.path;
+
+                // Watch Dir - Sub Dirs Of A Running Scan Are Reported From Its Records
+                if (!scanner->watchDir(entry.path)) {
+                    // Scan Dir - Reuses Up To Date Sub Trees
+                    scanner->scanDir(entry.path, true);
+                }
+            }
+
+            continue;
+        }
+
+        // Add Item
+        ui->treeMap->addItem(entry.name, entry.path, entry.size, false, false);
+
+        // Add Own Size
+        ownSize += entry.size;
+        // Inc Own Files
+        ownFiles++;
+    }
+
+    // Check Pending Dirs
+    if (pendingDirs.isEmpty()) {
+        // Store Current Dir
+        storeCurrentDir();
+    }
+
+    // Update Status
+    updateStatus();
+}
+
+//==============================================================================
+// Scan Progress Slot
+//==============================================================================
+void TreeMapDialog::scanProgress(const QString& aDirPath, const quint64& aNumDirs, const quint64& aNumFiles, const quint64& aScannedSize)
+{
+    Q_UNUSED(aNumDirs);
+    Q_UNUSED(aNumFiles);
+
+    // Update Item
+    ui->treeMap->updateItem(aDirPath, aScannedSize, true);
+
+    // Update Status
+    updateStatus();
+}
+
+//==============================================================================
+// Scan Finished Slot
+//==============================================================================
+void TreeMapDialog::scanFinished(const QString& aDirPath, const quint64& aNumDirs, const quint64& aNumFiles, const quint64& aScannedSize)
+{
+    Q_UNUSED(aNumDirs);
+    Q_UNUSED(aNumFiles);
+
+    // Update Item
+    ui->treeMap->updateItem(aDirPath, aScannedSize, false);
+
+    // Remove Pending Dir - Scans Started For Dirs Left Earlier Only Fill The Index
+    if (!pendingDirs.remove(aDirPath)) {
+        return;
+    }
+
+    // Check Pending Dirs
+    if (pendingDirs.isEmpty()) {
+        // Store Current Dir
+        storeCurrentDir();
+    }
+
+    // Update Status
+    updateStatus();
+}
+
+//==============================================================================
+// Up Button Clicked Slot
+//==============================================================================
+void TreeMapDialog::on_upButton_clicked()
+{
+    // Init Dir
+    QDir dir(dirPath);
+
+    // Check If Root
+    if (!dir.isRoot() && dir.cdUp()) {
+        // Set Dir Path
+        setDirPath(dir.absolutePath());
+    }
+}
+
+//==============================================================================
+// Update Status
+//==============================================================================
+void TreeMapDialog::updateStatus()
+{
+    // Check Listing
+    if (listing) {
+        // Set Status Text
+        ui->statusLabel->setText(tr("Reading dir..."));
+
+        return;
+    }
+
+    // Get Status Text
+    QString statusText = tr("Total: ") + formattedSize(ui->treeMap->getTotalSize());
+
+    // Check Pending Dirs
+    if (!pendingDirs.isEmpty()) {
+        // Add Pending Dirs
+        statusText += tr(" - Scanning %1 dir(s)...").arg(pendingDirs.count());
+    }
+
+    // Set Status Text
+    ui->statusLabel->setText(statusText);
+}
+
+//==============================================================================
+// Store Current Dir In Index
+//==============================================================================
+void TreeMapDialog::storeCurrentDir()
+{
+    // Init Records
+    QList<DirSizeScanRecord> records;
+
+    // Add Own Record
+    records << DirSizeScanRecord(dirPath, DirSizeIndexItem(ownSize, 1, ownFiles, dirModified));
+
+    // Go Thru Sub Dirs
+    QHash<QString, qint64>::const_iterator it = subDirs.constBegin();
+    while (it != subDirs.constEnd()) {
+        // Init Index Item
+        DirSizeIndexItem indexItem;
+
+        // Lookup Index
+        if (!index->lookup(it.key(), it.value(), indexItem)) {
+            // Sub Dir Changed While Scanning, Totals Would Be Wrong
+            return;
+        }
+
+        // Add Reused Record
+        records << DirSizeScanRecord(it.key(), indexItem, true);
+
+        ++it;
+    }
+
+    // Store Scan
+    index->storeScan(dirPath, records);
+}
+
+//==============================================================================
+// Key Press Event
+//==============================================================================
+void TreeMapDialog::keyPressEvent(QKeyEvent* aEvent)
+{
+    // Check Event
+    if (aEvent && aEvent->key() == Qt::Key_Backspace) {
+        // Go Up
+        on_upButton_clicked();
+
+        return;
+    }
+
+    QDialog::keyPressEvent(aEvent);
+}
+
+//==============================================================================
+// Hide Event
+//==============================================================================
+void TreeMapDialog::hideEvent(QHideEvent* aEvent)
+{
+    // Abort Running Scans
+    scanner->abort();
+    // Clear Pending Dirs
+    pendingDirs.clear();
+    // Reset Listing
+    listing = false;
+
+    QDialog::hideEvent(aEvent);
+}
+
+//==============================================================================
+// Destructor
+//==============================================================================
+TreeMapDialog::~TreeMapDialog()
+{
+    // Wait For List Tasks - Each Reads A Single Dir
+    listPool.waitForDone();
+    // Delete List Tasks
+    qDeleteAll(listTasks);
+    // Clear List Tasks
+    listTasks.clear();
+
+    // Check Scanner
+    if (scanner) {
+        // Delete Scanner
+        delete scanner;
+        scanner = NULL;
+    }
+
+    // Check Index
+    if (index) {
+        // Release Index
+        index->release();
+        index = NULL;
+    }
+
+    // Delete UI
+    delete ui;
+
+    qDebug() << "TreeMapDialog::~TreeMapDialog";
+}
+
+
+
+
+
+
+
+//==============================================================================
+// Constructor
+//==============================================================================
+TreeMapListEntry::TreeMapListEntry(const QString& aName, const QString& aPath, const quint64& aSize, const qint64& aModified, const bool& aIsDir)
+    : name(aName)
+    , path(aPath)
+    , size(aSize)
+    , modified(aModified)
+    , isDir(aIsDir)
+{
+}
+
+
+
+
+
+
+
+//==============================================================================
+// Constructor
+//==============================================================================
+TreeMapListTask::TreeMapListTask(const QString& aDirPath)
+    : QObject(NULL)
+    , QRunnable()
+    , dirPath(aDirPath)
+    , dirModified(0)
+{
+    // Set Auto Delete - Entries Are Read After The Run
+    setAutoDelete(false);
+}
+
+//==============================================================================
+// Run
+//==============================================================================
+void TreeMapListTask::run()
+{
+    // Set Dir Modified
+    dirModified = QFileInfo(dirPath).lastModified().toMSecsSinceEpoch() / 1000;
+
+    // Get Entries
+    QFileInfoList infoList = QDir(dirPath).entryInfoList(QDir::AllEntries | QDir::NoDotAndDotDot | QDir::Hidden | QDir::System, QDir::NoSort);
+
+    // Reserve Entries
+    entries.reserve(infoList.count());
+
+    // Go Thru Entries
+    foreach (const QFileInfo& info, infoList) {
+        // Check If Dir - Links Are Not Followed
+        if (info.isDir() && !info.isSymLink()) {
+            // Add Dir Entry
+            entries << TreeMapListEntry(info.fileName(), info.absoluteFilePath(), 0, info.lastModified().toMSecsSinceEpoch() / 1000, true);
+        } else {
+            // Add File Entry
+            entries << TreeMapListEntry(info.fileName(), info.absoluteFilePath(), info.isSymLink() ? 0 : (quint64)info.size(), 0, false);
+        }
+    }
+
+    // Emit List Finished Signal
+    emit listFinished();
+}
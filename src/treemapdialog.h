@@ -0,0 +1,161 @@
+#ifndef TREEMAPDIALOG_H
+#define TREEMAPDIALOG_H
+
+#include <QDialog>
+#include <QKeyEvent>
+#include <QString>
+#include <QSet>
+#include <QHash>
+#include <QList>
+#include <QRunnable>
+#include <QThreadPool>
+
+namespace Ui {
+class TreeMapDialog;
+}
+
+class DirSizeScanner;
+class DirSizeIndex;
+class TreeMapListTask;
+
+
+//==============================================================================
+// Tree Map Dialog Class - Disk Usage Of A Dir
+//==============================================================================
+class TreeMapDialog : public QDialog
+{
+    Q_OBJECT
+
+public:
+    // Constructor
+    explicit TreeMapDialog(QWidget* aParent = NULL);
+
+    // Get Dir Path
+    QString getDirPath();
+
+    // Destructor
+    virtual ~TreeMapDialog();
+
+public slots:
+
+    // Set Dir Path - Lists The Dir, Scans Sub Dirs Not Up To Date In The Index
+    void setDirPath(const QString& aDirPath);
+
+protected slots:
+
+    // List Finished Slot
+    void listFinished();
+
+    // Scan Progress Slot
+    void scanProgress(const QString& aDirPath, const quint64& aNumDirs, const quint64& aNumFiles, const quint64& aScannedSize);
+    // Scan Finished Slot
+    void scanFinished(const QString& aDirPath, const quint64& aNumDirs, const quint64& aNumFiles, const quint64& aScannedSize);
+
+    // Up Button Clicked Slot
+    void on_upButton_clicked();
+
+protected:
+
+    // Update Status
+    void updateStatus();
+    // Store Current Dir In Index - Makes Going Up Instant
+    void storeCurrentDir();
+
+protected: // From QDialog
+
+    // Key Press Event
+    virtual void keyPressEvent(QKeyEvent* aEvent);
+    // Hide Event
+    virtual void hideEvent(QHideEvent* aEvent);
+
+private:
+    // UI
+    Ui::TreeMapDialog*          ui;
+
+    // Dir Size Scanner
+    DirSizeScanner*             scanner;
+    // Dir Size Index
+    DirSizeIndex*               index;
+
+    // List Thread Pool
+    QThreadPool                 listPool;
+    // List Tasks
+    QList<TreeMapListTask*>     listTasks;
+    // Listing Dir
+    bool                        listing;
+
+    // Dir Path
+    QString                     dirPath;
+    // Dir Last Modified - secs Since Epoch
+    qint64                      dirModified;
+    // Own Files Size
+    quint64                     ownSize;
+    // Own Files Count
+    quint64                     ownFiles;
+
+    // Sub Dirs Last Modified
+    QHash<QString, qint64>      subDirs;
+    // Sub Dirs Being Scanned
+    QSet<QString>               pendingDirs;
+};
+
+
+
+
+//==============================================================================
+// Tree Map List Entry Class
+//==============================================================================
+class TreeMapListEntry
+{
+public:
+    // Constructor
+    explicit TreeMapListEntry(const QString& aName = "", const QString& aPath = "", const quint64& aSize = 0, const qint64& aModified = 0, const bool& aIsDir = false);
+
+    // Name
+    QString     name;
+    // Path
+    QString     path;
+    // Size - 0 For Dirs And Links
+    quint64     size;
+    // Last Modified - secs Since Epoch
+    qint64      modified;
+    // Is Dir - Links Are Not Followed
+    bool        isDir;
+};
+
+
+
+
+//==============================================================================
+// Tree Map List Task Class - Lists A Dir On A Worker Thread
+//==============================================================================
+class TreeMapListTask : public QObject, public QRunnable
+{
+    Q_OBJECT
+
+public:
+    // Constructor
+    explicit TreeMapListTask(const QString& aDirPath);
+
+signals:
+
+    // List Finished Signal - Emitted From The Worker Thread
+    void listFinished();
+
+protected: // From QRunnable
+
+    // Run
+    virtual void run();
+
+protected:
+    friend class TreeMapDialog;
+
+    // Dir Path
+    QString                     dirPath;
+    // Dir Last Modified - secs Since Epoch
+    qint64                      dirModified;
+    // Entries
+    QList<TreeMapListEntry>     entries;
+};
+
+#endif // TREEMAPDIALOG_H
@@ -0,0 +1,474 @@
+#include <QPainter>
+#include <QFileInfo>
+#include <QToolTip>
+#include <QDebug>
+
+#include <algorithm>
+
+#include "treemapwidget.h"
+#include "utility.h"
+#include "constants.h"
+
+
+//==============================================================================
+// Constructor
+//==============================================================================
+TreeMapItem::TreeMapItem(const QString& aName, const QString& aPath, const quint64& aSize, const bool& aIsDir, const bool& aScanning)
+    : name(aName)
+    , path(aPath)
+    , size(aSize)
+    , isDir(aIsDir)
+    , scanning(aScanning)
+{
+}
+
+
+
+
+
+
+
+//==============================================================================
+// Constructor
+//==============================================================================
+TreeMapWidget::TreeMapWidget(QWidget* aParent)
+    : QWidget(aParent)
+    , layoutDirty(false)
+    , hoveredIndex(-1)
+{
+    // Set Mouse Tracking
+    setMouseTracking(true);
+}
+
+//==============================================================================
+// Clear
+//==============================================================================
+void TreeMapWidget::clear()
+{
+    // Clear Items
+    items.clear();
+    // Clear Item Index
+    itemIndex.clear();
+    // Clear Layout Order
+    layoutOrder.clear();
+    // Reset Hovered Index
+    hoveredIndex = -1;
+    // Set Layout Dirty
+    layoutDirty = true;
+
+    // Update
+    update();
+}
+
+//==============================================================================
+// Add Item
+//==============================================================================
+void TreeMapWidget::addItem(const QString& aName, const QString& aPath, const quint64& aSize, const bool& aIsDir, const bool& aScanning)
+{
+    // Add Item Index
+    itemIndex[aPath] = items.count();
+    // Add Item
+    items << TreeMapItem(aName, aPath, aSize, aIsDir, aScanning);
+    // Set Layout Dirty
+    layoutDirty = true;
+
+    // Update
+    update();
+}
+
+//==============================================================================
+// Update Item Size
+//==============================================================================
+void TreeMapWidget::updateItem(const QString& aPath, const quint64& aSize, const bool& aScanning)
+{
+    // Get Index
+    int index = itemIndex.value(aPath, -1);
+
+    // Check Index
+    if (index < 0) {
+        return;
+    }
+
+    // Get Item
+    TreeMapItem& item = items[index];
+
+    // Check Item
+    if (item.size != aSize || item.scanning != aScanning) {
+        // Set Size
+        item.size = aSize;
+        // Set Scanning
+        item.scanning = aScanning;
+        // Set Layout Dirty
+        layoutDirty = true;
+
+        // Update
+        update();
+    }
+}
+
+//==============================================================================
+// Get Total Size
+//==============================================================================
+quint64 TreeMapWidget::getTotalSize()
+{
+    // Init Total Size
+    quint64 totalSize = 0;
+
+    // Go Thru Items
+    foreach (const TreeMapItem& item, items) {
+        // Add Size
+        totalSize += item.size;
+    }
+
+    return totalSize;
+}
+
+//==============================================================================
+// Compare Items By Size - Descending
+//==============================================================================
+struct TreeMapSizeCompare
+{
+    // Constructor
+    explicit TreeMapSizeCompare(const QList<TreeMapItem>& aItems) : items(aItems) { }
+
+    // Compare
+    bool operator()(const int& aLeft, const int& aRight) const
+    {
+        return items[aLeft].size > items[aRight].size;
+    }
+
+    // Items
+    const QList<TreeMapItem>& items;
+};
+
+//==============================================================================
+// Update Layout
+//==============================================================================
+void TreeMapWidget::updateLayout()
+{
+    // Reset Layout Dirty
+    layoutDirty = false;
+
+    // Clear Layout Order
+    layoutOrder.clear();
+
+    // Get Total Size
+    quint64 totalSize = 0;
+
+    // Go Thru Items
+    for (int i = 0; i < items.count(); ++i) {
+        // Reset Rect
+        items[i].rect = QRectF();
+
+        // Check Size
+        if (items[i].size > 0) {
+            // Add To Layout Order
+            layoutOrder << i;
+            // Add Size
+            totalSize += items[i].size;
+        }
+    }
+
+    // Get Layout Rect
+    QRectF layoutRect = QRectF(rect()).adjusted(1, 1, -1, -1);
+
+    // Check Total Size & Layout Rect
+    if (totalSize == 0 || layoutRect.isEmpty()) {
+        return;
+    }
+
+    // Sort Layout Order - Squarified Layout Needs Descending Sizes
+    std::sort(layoutOrder.begin(), layoutOrder.end(), TreeMapSizeCompare(items));
+
+    // Get Area Scale
+    qreal scale = layoutRect.width() * layoutRect.height() / (qreal)totalSize;
+
+    // Get Layout Order Count
+    int loCount = layoutOrder.count();
+    // Init Position
+    int pos = 0;
+
+    // Go Thru Layout Order
+    while (pos < loCount && !layoutRect.isEmpty()) {
+        // Get Short Side
+        qreal side = qMin(layoutRect.width(), layoutRect.height());
+
+        // Init Row
+        QList<int> row;
+        // Get First Area
+        qreal maxArea = items[layoutOrder[pos]].size * scale;
+        // Init Row Area
+        qreal rowArea = maxArea;
+        // Init Min Area
+        qreal minArea = maxArea;
+        // Init Worst Ratio
+        qreal worst = worstRatio(rowArea, minArea, maxArea, side);
+
+        // Add First Item
+        row << layoutOrder[pos++];
+
+        // Go Thru Next Items - Add While Aspect Ratios Improve
+        while (pos < loCount) {
+            // Get Area
+            qreal area = items[layoutOrder[pos]].size * scale;
+            // Get New Worst Ratio
+            qreal newWorst = worstRatio(rowArea + area, area, maxArea, side);
+
+            // Check New Worst Ratio
+            if (newWorst > worst) {
+                break;
+            }
+
+            // Add Item
+            row << layoutOrder[pos++];
+            // Update Row Area
+            rowArea += area;
+            // Update Min Area
+            minArea = area;
+            // Update Worst Ratio
+            worst = newWorst;
+        }
+
+        // Layout Row
+        layoutRow(row, rowArea, layoutRect);
+    }
+}
+
+//==============================================================================
+// Layout Row
+//==============================================================================
+void TreeMapWidget::layoutRow(const QList<int>& aRow, const qreal& aRowArea, QRectF& aRect)
+{
+    // Init Row Size
+    qreal rowSize = 0;
+
+    // Go Thru Row
+    foreach (int index, aRow) {
+        // Add Size
+        rowSize += items[index].size;
+    }
+
+    // Check Orientation - Row Goes Along The Short Side
+    if (aRect.width() >= aRect.height()) {
+        // Get Row Width
+        qreal rowWidth = aRowArea / aRect.height();
+        // Init Y
+        qreal y = aRect.top();
+
+        // Go Thru Row
+        foreach (int index, aRow) {
+            // Get Item Height
+            qreal itemHeight = aRect.height() * items[index].size / rowSize;
+            // Set Rect
+            items[index].rect = QRectF(aRect.left(), y, rowWidth, itemHeight);
+            // Inc Y
+            y += itemHeight;
+        }
+
+        // Adjust Rect
+        aRect.setLeft(aRect.left() + rowWidth);
+    } else {
+        // Get Row Height
+        qreal rowHeight = aRowArea / aRect.width();
+        // Init X
+        qreal x = aRect.left();
+
+        // Go Thru Row
+        foreach (int index, aRow) {
+            // Get Item Width
+            qreal itemWidth = aRect.width() * items[index].size / rowSize;
+            // Set Rect
+            items[index].rect = QRectF(x, aRect.top(), itemWidth, rowHeight);
+            // Inc X
+            x += itemWidth;
+        }
+
+        // Adjust Rect
+        aRect.setTop(aRect.top() + rowHeight);
+    }
+}
+
+//==============================================================================
+// Get Worst Aspect Ratio Of A Row
+//==============================================================================
+qreal TreeMapWidget::worstRatio(const qreal& aRowArea, const qreal& aMinArea, const qreal& aMaxArea, const qreal& aSide)
+{
+    // Check Areas
+    if (aRowArea <= 0 || aMinArea <= 0) {
+        return 1e30;
+    }
+
+    // Get Side Squared
+    qreal side2 = aSide * aSide;
+    // Get Row Area Squared
+    qreal area2 = aRowArea * aRowArea;
+
+    return qMax(side2 * aMaxArea / area2, area2 / (side2 * aMinArea));
+}
+
+//==============================================================================
+// Get Item Index At Position
+//==============================================================================
+int TreeMapWidget::itemAt(const QPoint& aPos)
+{
+    // Go Thru Layout Order
+    foreach (int index, layoutOrder) {
+        // Check Rect
+        if (items[index].rect.contains(aPos)) {
+            return index;
+        }
+    }
+
+    return -1;
+}
+
+//==============================================================================
+// Get Item Color
+//==============================================================================
+QColor TreeMapWidget::itemColor(const TreeMapItem& aItem)
+{
+    // Check If Dir
+    if (aItem.isDir) {
+        return QColor::fromHsv(210, aItem.scanning ? 40 : 110, 220);
+    }
+
+    // Get Suffix Hue - Same Extension, Same Color
+    int hue = qHash(QFileInfo(aItem.name).suffix().toLower()) % 360;
+
+    return QColor::fromHsv(hue, 90, 225);
+}
+
+//==============================================================================
+// Paint Event
+//==============================================================================
+void TreeMapWidget::paintEvent(QPaintEvent* aEvent)
+{
+    // Check Event
+    if (!aEvent) {
+        return;
+    }
+
+    // Check Layout Dirty
+    if (layoutDirty) {
+        // Update Layout
+        updateLayout();
+    }
+
+    // Init Painter
+    QPainter painter(this);
+
+    // Fill Background
+    painter.fillRect(rect(), palette().color(QPalette::Base));
+
+    // Get Font Metrics
+    QFontMetrics fontMetrics = painter.fontMetrics();
+
+    // Go Thru Layout Order
+    foreach (int index, layoutOrder) {
+        // Get Item
+        const TreeMapItem& item = items[index];
+
+        // Check Rect
+        if (item.rect.width() < 1.0 || item.rect.height() < 1.0) {
+            continue;
+        }
+
+        // Get Item Color
+        QColor color = itemColor(item);
+
+        // Check Hovered Index
+        if (index == hoveredIndex) {
+            // Highlight
+            color = color.darker(115);
+        }
+
+        // Set Pen
+        painter.setPen(QColor(Qt::darkGray));
+        // Set Brush
+        painter.setBrush(color);
+        // Draw Rect
+        painter.drawRect(item.rect);
+
+        // Check If There Is Room For Label
+        if (item.rect.width() > 40 && item.rect.height() > fontMetrics.height() + 2) {
+            // Get Label
+            QString label = item.name + QString(" - ") + formattedSize(item.size) + (item.scanning ? QString("...") : QString(""));
+            // Set Pen
+            painter.setPen(QColor(Qt::black));
+            // Draw Label
+            painter.drawText(item.rect.adjusted(3, 1, -3, -1), Qt::AlignLeft | Qt::AlignTop, fontMetrics.elidedText(label, Qt::ElideMiddle, (int)item.rect.width() - 6));
+        }
+    }
+}
+
+//==============================================================================
+// Resize Event
+//==============================================================================
+void TreeMapWidget::resizeEvent(QResizeEvent* aEvent)
+{
+    QWidget::resizeEvent(aEvent);
+
+    // Set Layout Dirty
+    layoutDirty = true;
+}
+
+//==============================================================================
+// Mouse Move Event
+//==============================================================================
+void TreeMapWidget::mouseMoveEvent(QMouseEvent* aEvent)
+{
+    // Check Event
+    if (!aEvent) {
+        return;
+    }
+
+    // Get Item Index
+    int index = itemAt(aEvent->pos());
+
+    // Check Hovered Index
+    if (hoveredIndex != index) {
+        // Set Hovered Index
+        hoveredIndex = index;
+
+        // Check Index
+        if (hoveredIndex >= 0) {
+            // Get Item
+            const TreeMapItem& item = items[hoveredIndex];
+            // Show Tool Tip
+            QToolTip::showText(aEvent->globalPos(), item.path + QString("\n") + formattedSize(item.size) + (item.scanning ? QString(" ...") : QString("")), this);
+        } else {
+            // Hide Tool Tip
+            QToolTip::hideText();
+        }
+
+        // Update
+        update();
+    }
+}
+
+//==============================================================================
+// Mouse Double Click Event
+//==============================================================================
+void TreeMapWidget::mouseDoubleClickEvent(QMouseEvent* aEvent)
+{
+    // Check Event
+    if (!aEvent) {
+        return;
+    }
+
+    // Get Item Index
+    int index = itemAt(aEvent->pos());
+
+    // Check Index
+    if (index >= 0 && items[index].isDir) {
+        // Emit Item Activated Signal
+        emit itemActivated(items[index].path);
+    }
+}
+
+//==============================================================================
+// Destructor
+//==============================================================================
+TreeMapWidget::~TreeMapWidget()
+{
+}
@@ -0,0 +1,110 @@
+#ifndef TREEMAPWIDGET_H
+#define TREEMAPWIDGET_H
+
+#include <QWidget>
+#include <QPaintEvent>
+#include <QMouseEvent>
+#include <QResizeEvent>
+#include <QString>
+#include <QRectF>
+#include <QList>
+#include <QHash>
+
+
+//==============================================================================
+// Tree Map Item Class
+//==============================================================================
+class TreeMapItem
+{
+public:
+    // Constructor
+    explicit TreeMapItem(const QString& aName = "", const QString& aPath = "", const quint64& aSize = 0, const bool& aIsDir = false, const bool& aScanning = false);
+
+    // Name
+    QString         name;
+    // Path
+    QString         path;
+    // Size
+    quint64         size;
+    // Is Dir
+    bool            isDir;
+    // Size Scan In Progress
+    bool            scanning;
+    // Layout Rect
+    QRectF          rect;
+};
+
+
+
+
+//==============================================================================
+// Tree Map Widget Class - Squarified Tree Map Of One Dir Level
+//==============================================================================
+class TreeMapWidget : public QWidget
+{
+    Q_OBJECT
+
+public:
+    // Constructor
+    explicit TreeMapWidget(QWidget* aParent = NULL);
+
+    // Clear
+    void clear();
+
+    // Add Item
+    void addItem(const QString& aName, const QString& aPath, const quint64& aSize, const bool& aIsDir, const bool& aScanning);
+    // Update Item Size - Layout Is Refreshed On Next Paint
+    void updateItem(const QString& aPath, const quint64& aSize, const bool& aScanning);
+
+    // Get Total Size
+    quint64 getTotalSize();
+
+    // Destructor
+    virtual ~TreeMapWidget();
+
+signals:
+
+    // Item Activated Signal - Dirs Only
+    void itemActivated(const QString& aPath);
+
+protected:
+
+    // Update Layout
+    void updateLayout();
+    // Layout Row
+    void layoutRow(const QList<int>& aRow, const qreal& aRowArea, QRectF& aRect);
+    // Get Worst Aspect Ratio Of A Row
+    static qreal worstRatio(const qreal& aRowArea, const qreal& aMinArea, const qreal& aMaxArea, const qreal& aSide);
+
+    // Get Item Index At Position
+    int itemAt(const QPoint& aPos);
+
+    // Get Item Color
+    QColor itemColor(const TreeMapItem& aItem);
+
+protected: // From QWidget
+
+    // Paint Event
+    virtual void paintEvent(QPaintEvent* aEvent);
+    // Resize Event
+    virtual void resizeEvent(QResizeEvent* aEvent);
+    // Mouse Move Event
+    virtual void mouseMoveEvent(QMouseEvent* aEvent);
+    // Mouse Double Click Event
+    virtual void mouseDoubleClickEvent(QMouseEvent* aEvent);
+
+protected:
+
+    // Items
+    QList<TreeMapItem>      items;
+    // Item Index By Path
+    QHash<QString, int>     itemIndex;
+    // Layout Order - Item Indexes By Size Descending
+    QList<int>              layoutOrder;
+    // Layout Dirty
+    bool                    layoutDirty;
+    // Hovered Item Index
+    int                     hoveredIndex;
+};
+
+#endif // TREEMAPWIDGET_H
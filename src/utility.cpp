@@ -42,17 +42,23 @@
 #include <mcwinterface.h>
 
 #include "utility.h"
+#include "ownernamecache.h"
+#include "iconthemeindex.h"
 #include "constants.h"
 
-// Icon Cache
-static QHash<QString, QString> iconCache;
-
 //==============================================================================
 // Get Current User Name
 //==============================================================================
 QString getCurrentUserName()
 {
-    return QFileInfo(QDir::homePath()).owner();
+    // Get Owner Name Cache
+    OwnerNameCache* ownerNames = OwnerNameCache::getInstance();
+    // Get User Name
+    QString userName = ownerNames->userName(QFileInfo(QDir::homePath()).ownerId(), true);
+    // Release Owner Name Cache
+    ownerNames->release();
+
+    return userName;
 }
 
 //==============================================================================
@@ -144,94 +150,16 @@ OSStatus convertMacIcon(const IconRef& aMacIconref, QImage& aIconImage)
 //==============================================================================
 QString searchIconPath(const QString& aFileName, const QString& aFileType, const int& aWidth, const int& aHeight)
 {
-    // Check File Name
-    if (QFile::exists(aFileName) && !aFileType.isEmpty() && aWidth > 0 && aHeight > 0) {
-
-        // Check If Dir
-
-        // Check If It Is A Standard Path
-
-
-        //qDebug() << "searchIconPath - aFileName: " << aFileName << " - type: " << aFileType << " - size: [" << aWidth << "x" << aHeight << "]";
-
-        // Init Icon Path
-        QString iconPath(DEFAULT_ICONS_PATH_LINUX);
-
-        // Get Slash Pos
-        int slashPos = aFileType.indexOf(QChar('/'));
-        // Get Mime Main Type
-        QString mimeMainType = slashPos >= 0 ? aFileType.left(slashPos) : aFileType;
-        // Get Mime Sub Type
-        QString mimeSubType = slashPos >= 0 ? aFileType.right(aFileType.length() - slashPos - 1) : QString("");
-        // Get Mime File Name
-        QString mimeFileName = convertMimeToFileName(aFileType);
-
-        //qDebug() << "searchIconPath - aFileName: " << aFileName << " - mimeMainType: " << mimeMainType << " - mimeSubType: " << mimeSubType << " - mimeFileName: " << mimeFileName;
-
-        // Ini Icon Filters
-        QStringList iconFilters;
-
-        // Adding Filters - ORDER IS IMPORTANT!!
-
-        // Adding Mimetypes Dir Name
-        iconFilters << QString(DEFAULT_ICONS_MIMETYPES_DIR);
-        // Adding Mimes Dir Name
-        iconFilters << QString(DEFAULT_ICONS_MIMES_DIR);
-        // Adding Size
-        iconFilters << QString("%1x%2").arg(aWidth).arg(aHeight);
-        // Adding Full Mime
-        //iconFilters << mimeFileName;
-        // Adding Mime Sub Type
-        iconFilters << mimeSubType;
-
-        // Get Icon Paths
-        QStringList iconPaths = searchDir(iconPath, iconFilters);
-
-        int ipCount = iconPaths.count();
-
-        //qDebug() << " ";
-        //qDebug() << "searchIconPath - found: " << ipCount;
-
-        // Go Thru First For Exact MIME Match
-        for (int i=0; i<ipCount; i++) {
-            //qDebug() << "    - " << iconPaths[i];
-
-            // Check Paths - Not Checking Current Theme
-            if ((iconPaths[i].indexOf(QString(DEFAULT_ICONS_MIMETYPES_DIR)) > 0 || iconPaths[i].indexOf(QString(DEFAULT_ICONS_MIMES_DIR)) > 0) &&   // mimetypes & mimes dir
-                 iconPaths[i].indexOf(iconFilters[2]) > 0 &&                                                                                        // Exact Size
-                 iconPaths[i].indexOf(mimeFileName)   > 0) {                                                                                        // Mime File Name
-
-                return iconPaths[i];
-            }
-        }
-
-        // Go Thru Second Time For Fuzzy MIME Match
-        for (int j=0; j<ipCount; j++) {
-            // Check Paths
-            if ((iconPaths[j].indexOf(QString(DEFAULT_ICONS_MIMETYPES_DIR)) > 0 || iconPaths[j].indexOf(QString(DEFAULT_ICONS_MIMES_DIR)) > 0) &&   // mimetypes & mimes dir
-                 iconPaths[j].indexOf(mimeFileName)   > 0) {                                                                                        // Mime File Name
-
-                return iconPaths[j];
-            }
-        }
-
-        // Check Mime Sub Type
-        if (!mimeSubType.isEmpty()) {
-            // Go Thru Second Time For Fuzzy MIME Match
-            for (int k=0; k<ipCount; k++) {
-                // Check Paths
-                if (iconPaths[k].indexOf(mimeSubType)   > 0) {                                                                                      // Mime Sub Type
-
-                    return iconPaths[k];
-                }
-            }
-        }
+    // Check Parameters
+    if (!aFileType.isEmpty() && aWidth > 0 && aHeight > 0) {
+        // Get Icon Theme Index - Shared With The Image Providers
+        IconThemeIndex* iconThemeIndex = IconThemeIndex::getInstance();
 
-        // ...
+        // Get Icon Path - Hash Probes Into The Prebuilt Theme Index
+        QString iconPath = iconThemeIndex->mimeIconPath(aFileType, aWidth, aHeight);
 
-        //qDebug() << " ";
-
-        // ...
+        // Release Icon Theme Index
+        iconThemeIndex->release();
 
         return iconPath;
 
@@ -274,13 +202,13 @@ QImage getFileIconImage(const QString& aFilePath, const int& aWidth, const int&
     // Init Error
     GError* error = NULL;
     // New File
-    GFile* file = g_file_new_for_path (aFileName.toLocal8Bit().data());
+    GFile* file = g_file_new_for_path (aFilePath.toLocal8Bit().data());
     // Get File Info
     GFileInfo* file_info = g_file_query_info (file, "standard::*", G_FILE_QUERY_INFO_NONE, NULL, &error);
     // Check Error
     if (error) {
 
-        qDebug() << "### getFileIconImage - aFileName: " << aFileName << " - error: " << error->code << " : " << error->message;
+        qDebug() << "### getFileIconImage - aFilePath: " << aFilePath << " - error: " << error->code << " : " << error->message;
 
         // Free Error
         g_free(error);
@@ -311,42 +239,18 @@ QImage getFileIconImage(const QString& aFilePath, const int& aWidth, const int&
         g_free(description);
     }
 
-    // Get Icon Path From Icon Cache
-    QString iconPath = iconCache.value(fileType);
-    // Init Found In Cache
-    bool foundInCache = false;
-
-    // Check Icon Path
-    if (iconPath.isNull()) {
-
-        //qDebug() << "getFileIconImage - aFileName: " << aFileName << " - SEARCH";
-
-        // Search For Icon Path
-        iconPath = searchIconPath(aFileName, fileType, aWidth, aHeight);
-
-    } else {
-
-        //qDebug() << "getFileIconImage - aFileName: " << aFileName << " - CACHED";
-
-        // Set Found In Cache
-        foundInCache = true;
-    }
-
-    // Add Icon Path To Icon Path Cache
-    if (QFile::exists(iconPath) && !foundInCache /*&& fileType != QString()*/ ) {
-
-        //qDebug() << "getFileIconImage - CACHING - type: " << fileType << " - iconPath: " << iconPath;
-
-        // Add Path To Cache
-        iconCache[fileType] = iconPath;
-    }
-
-    // ...
+    // Search For Icon Path - Indexed Paths Need No Existence Check
+    QString iconPath = searchIconPath(aFilePath, fileType, aWidth, aHeight);
 
     // Check Icon Path
-    if (QFile::exists(iconPath)) {
+    if (!iconPath.isEmpty()) {
         // Create New QImage
-        return new QImage(iconPath);
+        QImage iconImage(iconPath);
+
+        // Check Icon Image - The Theme May Have Changed Since Indexing
+        if (!iconImage.isNull()) {
+            return iconImage;
+        }
     }
 
     // ...
@@ -25,6 +25,7 @@
 #include "confirmdialog.h"
 #include "findtextdialog.h"
 #include "settingscontroller.h"
+#include "mimetypecache.h"
 #include "constants.h"
 #include "defaultsettings.h"
 
@@ -36,6 +37,7 @@ ViewerWindow::ViewerWindow(QWidget* aParent)
     : QMainWindow(aParent)
     , ui(new Ui::ViewerWindow)
     , settings(SettingsController::getInstance())
+    , mimeTypes(MimeTypeCache::getInstance())
     , activeWidget(NULL)
     , fileName("")
     , editMode(false)
@@ -175,11 +177,8 @@ bool ViewerWindow::newFile(const QString& aDirPath)
 //==============================================================================
 bool ViewerWindow::loadFile(const QString& aFileName, const QString& aPanelName)
 {
-    // Init Mime Database
-    QMimeDatabase mimeDatabase;
-
-    // Get Mime Tpye
-    mime = mimeDatabase.mimeTypeForFile(aFileName).name();
+    // Get Mime Tpye - Cached Per Path/Inode, Skips Detection On Reopen
+    mime = mimeTypes->mimeType(QFileInfo(aFileName), true);
 
     // Reset File Is New
     fileIsNew = false;
@@ -1042,6 +1041,14 @@ ViewerWindow::~ViewerWindow()
         settings = NULL;
     }
 
+    // Check Mime Type Cache
+    if (mimeTypes) {
+        // Release Instance
+        mimeTypes->release();
+        // Reset Mime Type Cache
+        mimeTypes = NULL;
+    }
+
     // Check Image Browser
     if (imageBrowser) {
         // Delete Image Browser
@@ -1089,6 +1096,7 @@ ViewerWindow::~ViewerWindow()
 ImageBrowser::ImageBrowser(const QString& aFileName, const QString& aPanelName, QObject* aParent)
     : QObject(aParent)
     , fileUtil(NULL)
+    , mimeTypes(MimeTypeCache::getInstance())
     , panelName(aPanelName)
     , currentIndex(-1)
     , currentFile(aFileName)
@@ -1354,10 +1362,8 @@ void ImageBrowser::dirListItemFound(const unsigned int& aID,
 
     // Check Path
     if (currentDir == aPath) {
-        // Init Mime Database
-        QMimeDatabase mimeDatabase;
-        // Get Mime Tpye
-        QString mimeType = mimeDatabase.mimeTypeForFile(aFileName).name();
+        // Get Mime Tpye - Extension Matches Are Served From The Cache
+        QString mimeType = mimeTypes->mimeType(QFileInfo(aFileName), true);
         // Check Mime
         if (mimeType.startsWith(DEFAULT_MIME_PREFIX_IMAGE)) {
             // Add To Image List
@@ -1383,6 +1389,13 @@ ImageBrowser::~ImageBrowser()
         delete fileUtil;
         fileUtil = NULL;
     }
+
+    // Check Mime Type Cache
+    if (mimeTypes) {
+        // Release Instance
+        mimeTypes->release();
+        mimeTypes = NULL;
+    }
 }
 
 
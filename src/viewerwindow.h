@@ -12,6 +12,7 @@ class ViewerWindow;
 }
 
 class SettingsController;
+class MimeTypeCache;
 class ConfirmDialog;
 class RemoteFileUtilClient;
 class ImageBrowser;
@@ -152,6 +153,8 @@ private:
     Ui::ViewerWindow*       ui;
     // Settings
     SettingsController*     settings;
+    // Mime Type Cache
+    MimeTypeCache*          mimeTypes;
     // Active Widget
     QWidget*                activeWidget;
     // File Name
@@ -298,6 +301,8 @@ protected:
 
     // File Util
     RemoteFileUtilClient*   fileUtil;
+    // Mime Type Cache
+    MimeTypeCache*          mimeTypes;
     // Panel Name
     QString                 panelName;
     // Image Files